@@ -19,22 +19,43 @@
 #ifdef _WIN32
 #include "util/include/windows_utils.h"
 #endif // _WIN32
+#include "core/include/gpu_timer.h"
+#include "core/include/job_system.h"
+#include "core/include/perf_hud.h"
+#include "core/include/resource_manager.h"
 #include "core/include/rinvid_gfx.h"
+#include "core/include/texture_loader.h"
 #include "include/application.h"
+#include "util/include/error_handler.h"
+#include "util/include/profiler.h"
 #include "util/include/vector2.h"
 
 namespace rinvid
 {
 
+namespace
+{
+
+// Set on the simulation thread, which reads input gathered for it instead of the current frame's
+thread_local bool on_simulation_thread{false};
+
+} // namespace
+
 Application::Application(std::uint32_t width, std::uint32_t height, const std::string& title,
                          bool fullscreen, std::uint16_t fps)
-    : window_{}, current_screen_{nullptr}, new_screen_{nullptr}, fps_{fps}, running_{false}
+    : window_{}, resource_manager_{std::make_unique<ResourceManager>()}, perf_hud_{nullptr},
+      current_screen_{nullptr}, new_screen_{nullptr}, new_screen_mutex_{}, fixed_time_step_{},
+      frame_pacer_{fps}, frame_time_histogram_{}, frame_time_reports_{}, snapshots_{},
+      input_state_{}, pending_input_state_{}, simulation_input_state_{}, input_mutex_{},
+      input_recorder_{}, input_player_{}, simulation_thread_{}, simulating_{false},
+      simulation_thread_enabled_{false}, simulation_time_step_set_{false}, pending_time_step_{0.0},
+      pending_max_steps_per_frame_{DEFAULT_MAX_STEPS_PER_FRAME}, time_step_changed_{false},
+      time_step_mutex_{}, print_frame_time_reports_{true}, running_{false}, start_time_{}
 {
     if (fullscreen)
     {
         window_.create(sf::VideoMode::getDesktopMode(), title, sf::Style::Fullscreen);
         window_.setVerticalSyncEnabled(true);
-        window_.setFramerateLimit(fps_);
     }
     else
     {
@@ -52,10 +73,16 @@ Application::Application(std::uint32_t width, std::uint32_t height, const std::s
 
 Application::~Application()
 {
+    stop_simulation();
     destroy_current_screen();
 
+    TextureLoader::shutdown();
+    JobSystem::shutdown();
+
     if (window_.setActive(true))
     {
+        perf_hud_.reset();
+        resource_manager_->clear();
         RinvidGfx::shutdown();
     }
 }
@@ -67,46 +94,182 @@ void Application::run()
 
     window_.setActive(true);
 
+    const auto mouse_pos = sf::Mouse::getPosition(window_);
+    input_state_.set_mouse_pos(
+        Vector2f{static_cast<float>(mouse_pos.x), static_cast<float>(mouse_pos.y)});
+    start_time_ = std::chrono::steady_clock::now();
+
     running_ = true;
     activate_pending_screen();
 
     while (running_ == true)
     {
+        RINVID_PROFILE_ZONE("Application::run");
+
         auto start = std::chrono::high_resolution_clock::now();
 
+        // Waits for the slot of this frame, so input is polled only once the frame can start
+        frame_pacer_.begin_frame();
+        auto work_start = std::chrono::high_resolution_clock::now();
+
+        RinvidGfx::reset_frame_stats();
+
         handle_events(window_, event);
 
-        if (current_screen_ != nullptr)
+        double delta_time = total_frame_time.count();
+        if (!update_input(delta_time))
         {
-            current_screen_->update(total_frame_time.count());
+            break;
+        }
+
+        if (simulation_thread_.joinable())
+        {
+            RINVID_PROFILE_ZONE("Screen::render");
+            current_screen_->render(snapshots_.acquire_latest());
+        }
+        else if (current_screen_ != nullptr)
+        {
+            update_screen(delta_time);
+        }
+
+        // GPU frame ends before the overlay is drawn, so the overlay isn't part of the GPU times
+        // it shows
+        RINVID_GPU_END_FRAME();
+
+        // Drawn last, on top of the screen, without screens having to know about it
+        if (perf_hud_ != nullptr)
+        {
+            perf_hud_->draw();
         }
 
         window_.display();
+        frame_pacer_.end_frame();
+
+        // Upload textures decoded in the background and run OpenGL jobs once the frame is submitted
+        TextureLoader::process_uploads();
+        JobSystem::process_main_thread_jobs();
+
+        if (current_screen_ != nullptr)
+        {
+            std::chrono::duration<double> work_time =
+                std::chrono::high_resolution_clock::now() - work_start;
+            frame_time_histogram_.record(work_time.count());
+        }
 
         if (running_ == true)
         {
             activate_pending_screen();
+            apply_simulation_thread();
         }
 
         auto end         = std::chrono::high_resolution_clock::now();
         total_frame_time = end - start;
+
+        if (perf_hud_ != nullptr)
+        {
+            perf_hud_->add_frame(total_frame_time.count());
+        }
     }
 
+    stop_simulation();
+    finish_frame_time_report();
     destroy_current_screen();
     new_screen_.reset();
+    input_recorder_.close();
+    input_player_.close();
 
+    TextureLoader::shutdown();
+    JobSystem::shutdown();
+    perf_hud_.reset();
+    resource_manager_->clear();
     RinvidGfx::shutdown();
 }
 
 void Application::set_screen(std::unique_ptr<Screen> screen)
 {
+    // Screens switch screens from the simulation thread too
+    std::lock_guard<std::mutex> lock{new_screen_mutex_};
     new_screen_ = std::move(screen);
 }
 
 void Application::set_fps(std::uint16_t fps)
 {
-    fps_ = fps;
-    window_.setFramerateLimit(fps_);
+    frame_pacer_.set_fps(fps);
+}
+
+void Application::set_low_latency(bool low_latency)
+{
+    frame_pacer_.set_low_latency(low_latency);
+}
+
+std::uint64_t Application::get_missed_deadlines() const
+{
+    return frame_pacer_.get_missed_deadlines();
+}
+
+void Application::set_fixed_time_step(double time_step, std::uint32_t max_steps_per_frame)
+{
+    // Simulation thread may be stepping right now, so the change is left for the thread owning
+    // fixed_time_step_ to apply (see apply_fixed_time_step)
+    std::lock_guard<std::mutex> lock{time_step_mutex_};
+    pending_time_step_           = time_step;
+    pending_max_steps_per_frame_ = max_steps_per_frame;
+    time_step_changed_           = true;
+}
+
+FrameTimeReport Application::get_frame_time_report() const
+{
+    const char* name = (current_screen_ != nullptr) ? current_screen_->get_name() : "no screen";
+
+    return frame_time_histogram_.get_report(name);
+}
+
+const std::vector<FrameTimeReport>& Application::get_frame_time_reports() const
+{
+    return frame_time_reports_;
+}
+
+void Application::set_print_frame_time_reports(bool print)
+{
+    print_frame_time_reports_ = print;
+}
+
+void Application::set_simulation_thread(bool enabled)
+{
+    // Simulation thread steps by wall clock time, so a recording of it couldn't be replayed
+    if (enabled && input_recorder_.is_open())
+    {
+        errors::put_error_to_log("Application: simulation thread can't run while recording input");
+        return;
+    }
+
+    simulation_thread_enabled_ = enabled;
+}
+
+const system::InputState& Application::get_input_state() const
+{
+    if (on_simulation_thread)
+    {
+        return simulation_input_state_;
+    }
+
+    return input_state_;
+}
+
+bool Application::record_input(const std::string& file_name)
+{
+    if (simulation_thread_enabled_)
+    {
+        errors::put_error_to_log("Application: can't record input with simulation thread enabled");
+        return false;
+    }
+
+    return input_recorder_.open(file_name);
+}
+
+bool Application::replay_input(const std::string& file_name)
+{
+    return input_player_.open(file_name);
 }
 
 void Application::exit()
@@ -114,18 +277,50 @@ void Application::exit()
     running_ = false;
 }
 
+ResourceManager& Application::get_resource_manager()
+{
+    return *resource_manager_;
+}
+
+void Application::toggle_perf_hud()
+{
+    // Created on first use, so applications which never show it don't pay for it
+    if (perf_hud_ == nullptr)
+    {
+        perf_hud_ = std::make_unique<PerfHud>();
+    }
+
+    perf_hud_->set_visible(!perf_hud_->is_visible());
+}
+
 void Application::activate_pending_screen()
 {
-    if (!new_screen_)
+    std::unique_ptr<Screen> screen{};
+    {
+        std::lock_guard<std::mutex> lock{new_screen_mutex_};
+        screen = std::move(new_screen_);
+    }
+
+    if (!screen)
     {
         return;
     }
 
+    stop_simulation();
+    finish_frame_time_report();
     destroy_current_screen();
 
-    current_screen_ = std::move(new_screen_);
+    current_screen_ = std::move(screen);
     current_screen_->set_application(this);
     current_screen_->create();
+
+    // New screen starts its simulation from scratch
+    fixed_time_step_.reset();
+
+    // Done after the new screen is created, so resources shared with the old one are not reloaded
+    resource_manager_->purge_unused();
+
+    start_simulation();
 }
 
 void Application::destroy_current_screen()
@@ -137,10 +332,211 @@ void Application::destroy_current_screen()
     }
 }
 
+void Application::finish_frame_time_report()
+{
+    if ((current_screen_ == nullptr) || (frame_time_histogram_.get_count() == 0U))
+    {
+        return;
+    }
+
+    frame_time_reports_.push_back(get_frame_time_report());
+    if (print_frame_time_reports_)
+    {
+        std::cout << frame_time_reports_.back() << '\n';
+    }
+    frame_time_histogram_.clear();
+}
+
+void Application::update_screen(double delta_time)
+{
+    apply_fixed_time_step();
+
+    if (fixed_time_step_.is_enabled())
+    {
+        RINVID_PROFILE_ZONE("Screen::fixed_update");
+
+        const auto steps = fixed_time_step_.advance(delta_time);
+        for (std::uint32_t step{0U}; step < steps; ++step)
+        {
+            current_screen_->fixed_update(fixed_time_step_.get_time_step());
+        }
+    }
+    current_screen_->interpolation_alpha_ = fixed_time_step_.get_alpha();
+
+    RINVID_PROFILE_ZONE("Screen::update");
+    current_screen_->update(delta_time);
+}
+
+void Application::apply_simulation_thread()
+{
+    if (simulation_thread_enabled_ && !simulation_thread_.joinable())
+    {
+        start_simulation();
+    }
+    else if (!simulation_thread_enabled_ && simulation_thread_.joinable())
+    {
+        stop_simulation();
+    }
+}
+
+void Application::apply_fixed_time_step()
+{
+    std::lock_guard<std::mutex> lock{time_step_mutex_};
+    if (!time_step_changed_)
+    {
+        return;
+    }
+
+    fixed_time_step_.set_time_step(pending_time_step_);
+    fixed_time_step_.set_max_steps_per_frame(pending_max_steps_per_frame_);
+    time_step_changed_ = false;
+
+    // Time step chosen by the user is kept once simulation thread stops
+    simulation_time_step_set_ = false;
+}
+
+void Application::start_simulation()
+{
+    if (!simulation_thread_enabled_ || (current_screen_ == nullptr) || input_player_.is_open())
+    {
+        return;
+    }
+
+    // Thread isn't running yet, so fixed_time_step_ is still owned by this one
+    apply_fixed_time_step();
+
+    if (!fixed_time_step_.is_enabled())
+    {
+        fixed_time_step_.set_time_step(DEFAULT_SIMULATION_TIME_STEP);
+        simulation_time_step_set_ = true;
+    }
+
+    // First snapshot is written here, so there is something to draw before the first step is done
+    auto& snapshot = snapshots_.get_write_buffer();
+    snapshot.clear();
+    current_screen_->write_snapshot(snapshot, 0.0);
+    snapshots_.publish();
+
+    // Simulation starts with keys and buttons already down, but without edges it has already seen
+    pending_input_state_ = input_state_;
+    pending_input_state_.begin_frame();
+    simulation_input_state_ = pending_input_state_;
+
+    simulating_        = true;
+    simulation_thread_ = std::thread{&Application::simulate, this};
+}
+
+void Application::stop_simulation()
+{
+    if (!simulation_thread_.joinable())
+    {
+        return;
+    }
+
+    simulating_ = false;
+    simulation_thread_.join();
+
+    // A change made while the thread was stopping hasn't been applied yet
+    apply_fixed_time_step();
+
+    // Snapshots point to objects of the screen, which may be destroyed next
+    snapshots_.reset();
+
+    // Screen goes back to variable time step if that is what it had before simulation started
+    if (simulation_time_step_set_)
+    {
+        fixed_time_step_.set_time_step(0.0);
+        simulation_time_step_set_ = false;
+    }
+}
+
+void Application::simulate()
+{
+    on_simulation_thread = true;
+    auto previous_step = std::chrono::steady_clock::now();
+
+    while (simulating_)
+    {
+        apply_fixed_time_step();
+
+        const auto                          now        = std::chrono::steady_clock::now();
+        const std::chrono::duration<double> frame_time = now - previous_step;
+        previous_step                                  = now;
+
+        const double time_step = fixed_time_step_.get_time_step();
+        const auto   steps     = fixed_time_step_.advance(frame_time.count());
+        if (steps > 0U)
+        {
+            RINVID_PROFILE_ZONE("Application::simulate");
+
+            take_simulation_input();
+            for (std::uint32_t step{0U}; step < steps; ++step)
+            {
+                current_screen_->fixed_update(time_step);
+            }
+
+            auto& snapshot = snapshots_.get_write_buffer();
+            snapshot.clear();
+            current_screen_->write_snapshot(snapshot, steps * time_step);
+            snapshots_.publish();
+        }
+
+        // Sleeps until the next step is due
+        const double time_to_next_step = (1.0 - fixed_time_step_.get_alpha()) * time_step;
+        std::this_thread::sleep_for(std::chrono::duration<double>{time_to_next_step});
+    }
+}
+
+void Application::take_simulation_input()
+{
+    std::lock_guard<std::mutex> lock{input_mutex_};
+    simulation_input_state_ = pending_input_state_;
+    pending_input_state_.begin_frame();
+}
+
+bool Application::update_input(double& delta_time)
+{
+    // Replayed frames get their recorded delta time, so simulation takes the same steps again
+    if (input_player_.is_open() && !input_player_.next_frame(delta_time, input_state_))
+    {
+        running_ = false;
+        return false;
+    }
+
+    // View of the previous frame, the one the user saw when moving the mouse
+    input_state_.update_mouse_world_pos(RinvidGfx::get_view());
+
+    input_recorder_.record_frame(delta_time, input_state_);
+
+    if (simulation_thread_.joinable())
+    {
+        std::lock_guard<std::mutex> lock{input_mutex_};
+        pending_input_state_.add(input_state_);
+    }
+
+    return true;
+}
+
 void Application::handle_events(sf::Window& window, sf::Event& event)
 {
+    RINVID_PROFILE_ZONE("Application::handle_events");
+
+    // Devices are ignored while replaying, input comes from the recording
+    const bool read_input = !input_player_.is_open();
+    if (read_input)
+    {
+        input_state_.begin_frame();
+    }
+
     while (window.pollEvent(event))
     {
+        if (read_input)
+        {
+            const std::chrono::duration<double> time =
+                std::chrono::steady_clock::now() - start_time_;
+            input_state_.handle_event(event, time.count());
+        }
+
         switch (event.type)
         {
             case sf::Event::Closed:
@@ -149,6 +545,12 @@ void Application::handle_events(sf::Window& window, sf::Event& event)
             case sf::Event::Resized:
                 rinvid::RinvidGfx::set_viewport(0, 0, event.size.width, event.size.height);
                 break;
+            case sf::Event::KeyPressed:
+                if (event.key.code == sf::Keyboard::F3)
+                {
+                    toggle_perf_hud();
+                }
+                break;
             default:
                 break;
         }
@@ -0,0 +1,333 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+
+#include "include/body_store.h"
+#include "platformers/include/world.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+constexpr std::uint32_t ACTIVE{0x4U};
+
+/**************************************************************************************************
+ * @brief Moves bodies along one axis, as Object::update_motion does. Loop has no branches, every
+ * condition is a select and results are written back even for bodies which don't move, so it is
+ * vectorised. That takes -fno-trapping-math, otherwise GCC won't turn float conditions to selects.
+ *
+ *************************************************************************************************/
+void integrate_axis(std::uint32_t count, float delta_time, float gravity, std::uint32_t axis,
+                    float* position, float* velocity, const float* acceleration,
+                    const float* drag, const float* max_velocity, const float* gravity_scale,
+                    const std::uint32_t* flags)
+{
+    const std::uint32_t mask = ACTIVE | axis;
+
+    for (std::uint32_t i{0U}; i < count; ++i)
+    {
+        const float old_position = position[i];
+        const float old_velocity = velocity[i];
+        const float max          = max_velocity[i];
+        const float scale        = gravity_scale[i];
+
+        const float dragged = (old_velocity - drag[i] > 0.0F)   ? old_velocity - drag[i]
+                              : (old_velocity + drag[i] < 0.0F) ? old_velocity + drag[i]
+                                                                : 0.0F;
+        float new_velocity =
+            (acceleration[i] != 0.0F) ? old_velocity + acceleration[i] * delta_time : dragged;
+        new_velocity += (scale > 0.0F) ? gravity * scale * delta_time : 0.0F;
+        new_velocity = (max != 0.0F) ? std::min(std::max(new_velocity, -max), max) : new_velocity;
+
+        const float velocity_delta = (new_velocity - old_velocity) / 2.0F;
+        const float mid_velocity   = old_velocity + velocity_delta;
+
+        const bool moves = (flags[i] & mask) == mask;
+        position[i]      = moves ? old_position + mid_velocity * delta_time : old_position;
+        velocity[i]      = moves ? mid_velocity + velocity_delta : old_velocity;
+    }
+}
+
+} // namespace
+
+BodyStore::BodyStore()
+    : position_x_{}, position_y_{}, previous_x_{}, previous_y_{}, velocity_x_{}, velocity_y_{},
+      acceleration_x_{}, acceleration_y_{}, drag_x_{}, drag_y_{}, max_velocity_{}, gravity_scale_{},
+      flags_{}, slot_indices_{}, owners_{}, slots_{}, free_slots_{}
+{
+}
+
+BodyStore::~BodyStore()
+{
+    clear();
+}
+
+BodyHandle BodyStore::create(Vector2f position)
+{
+    std::uint32_t slot{};
+    if (free_slots_.empty())
+    {
+        slot = static_cast<std::uint32_t>(slots_.size());
+        slots_.push_back(Slot{0U, 0U});
+    }
+    else
+    {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+
+    slots_[slot].dense_index = get_count();
+
+    // Same defaults as Object has
+    position_x_.push_back(position.x);
+    position_y_.push_back(position.y);
+    previous_x_.push_back(position.x);
+    previous_y_.push_back(position.y);
+    velocity_x_.push_back(0.0F);
+    velocity_y_.push_back(0.0F);
+    acceleration_x_.push_back(0.0F);
+    acceleration_y_.push_back(0.0F);
+    drag_x_.push_back(800.0F);
+    drag_y_.push_back(0.0F);
+    max_velocity_.push_back(0.0F);
+    gravity_scale_.push_back(1.0F);
+    flags_.push_back(ACTIVE | YES);
+    slot_indices_.push_back(slot);
+    owners_.push_back(nullptr);
+
+    return BodyHandle{slot, slots_[slot].generation};
+}
+
+void BodyStore::destroy(BodyHandle body)
+{
+    if (!is_valid(body))
+    {
+        return;
+    }
+
+    const std::uint32_t index = dense(body);
+    const std::uint32_t last  = get_count() - 1U;
+
+    if (owners_[index] != nullptr)
+    {
+        owners_[index]->body_store_ = nullptr;
+    }
+
+    position_x_[index]     = position_x_[last];
+    position_y_[index]     = position_y_[last];
+    previous_x_[index]     = previous_x_[last];
+    previous_y_[index]     = previous_y_[last];
+    velocity_x_[index]     = velocity_x_[last];
+    velocity_y_[index]     = velocity_y_[last];
+    acceleration_x_[index] = acceleration_x_[last];
+    acceleration_y_[index] = acceleration_y_[last];
+    drag_x_[index]         = drag_x_[last];
+    drag_y_[index]         = drag_y_[last];
+    max_velocity_[index]   = max_velocity_[last];
+    gravity_scale_[index]  = gravity_scale_[last];
+    flags_[index]          = flags_[last];
+    slot_indices_[index]   = slot_indices_[last];
+    owners_[index]         = owners_[last];
+
+    slots_[slot_indices_[index]].dense_index = index;
+
+    position_x_.pop_back();
+    position_y_.pop_back();
+    previous_x_.pop_back();
+    previous_y_.pop_back();
+    velocity_x_.pop_back();
+    velocity_y_.pop_back();
+    acceleration_x_.pop_back();
+    acceleration_y_.pop_back();
+    drag_x_.pop_back();
+    drag_y_.pop_back();
+    max_velocity_.pop_back();
+    gravity_scale_.pop_back();
+    flags_.pop_back();
+    slot_indices_.pop_back();
+    owners_.pop_back();
+
+    // Handles still holding the old generation no longer match
+    ++slots_[body.index].generation;
+    free_slots_.push_back(body.index);
+}
+
+bool BodyStore::is_valid(BodyHandle body) const
+{
+    return (body.index < slots_.size()) && (slots_[body.index].generation == body.generation);
+}
+
+std::uint32_t BodyStore::get_count() const
+{
+    return static_cast<std::uint32_t>(flags_.size());
+}
+
+void BodyStore::clear()
+{
+    while (get_count() > 0U)
+    {
+        const std::uint32_t slot = slot_indices_.back();
+        destroy(BodyHandle{slot, slots_[slot].generation});
+    }
+}
+
+void BodyStore::integrate(double delta_time)
+{
+    RINVID_PROFILE_ZONE("BodyStore::integrate");
+
+    const std::uint32_t count = get_count();
+    const float         step  = static_cast<float>(delta_time);
+
+    float*               position_x = position_x_.data();
+    float*               position_y = position_y_.data();
+    float*               previous_x = previous_x_.data();
+    float*               previous_y = previous_y_.data();
+    const std::uint32_t* flags      = flags_.data();
+
+    // Everything is loaded up front, a load under a condition would stop vectorisation
+    for (std::uint32_t i{0U}; i < count; ++i)
+    {
+        const bool  active = (flags[i] & ACTIVE) != 0U;
+        const float x      = position_x[i];
+        const float y      = position_y[i];
+        const float old_x  = previous_x[i];
+        const float old_y  = previous_y[i];
+        previous_x[i]      = active ? x : old_x;
+        previous_y[i]      = active ? y : old_y;
+    }
+
+    // Only y axis is affected by gravity
+    integrate_axis(count, step, 0.0F, HORIZONTALLY, position_x, velocity_x_.data(),
+                   acceleration_x_.data(), drag_x_.data(), max_velocity_.data(),
+                   gravity_scale_.data(), flags);
+    integrate_axis(count, step, World::gravity, VERTICALLY, position_y, velocity_y_.data(),
+                   acceleration_y_.data(), drag_y_.data(), max_velocity_.data(),
+                   gravity_scale_.data(), flags);
+}
+
+void BodyStore::set_position(BodyHandle body, Vector2f position)
+{
+    const std::uint32_t index = dense(body);
+    position_x_[index]        = position.x;
+    position_y_[index]        = position.y;
+    previous_x_[index]        = position.x;
+    previous_y_[index]        = position.y;
+}
+
+Vector2f BodyStore::get_position(BodyHandle body) const
+{
+    const std::uint32_t index = dense(body);
+    return Vector2f{position_x_[index], position_y_[index]};
+}
+
+Vector2f BodyStore::get_interpolated_position(BodyHandle body, float alpha) const
+{
+    const std::uint32_t index = dense(body);
+    return Vector2f{previous_x_[index] + (position_x_[index] - previous_x_[index]) * alpha,
+                    previous_y_[index] + (position_y_[index] - previous_y_[index]) * alpha};
+}
+
+void BodyStore::set_velocity(BodyHandle body, Vector2f velocity)
+{
+    const std::uint32_t index = dense(body);
+    velocity_x_[index]        = velocity.x;
+    velocity_y_[index]        = velocity.y;
+}
+
+Vector2f BodyStore::get_velocity(BodyHandle body) const
+{
+    const std::uint32_t index = dense(body);
+    return Vector2f{velocity_x_[index], velocity_y_[index]};
+}
+
+void BodyStore::set_acceleration(BodyHandle body, Vector2f acceleration)
+{
+    const std::uint32_t index = dense(body);
+    acceleration_x_[index]    = acceleration.x;
+    acceleration_y_[index]    = acceleration.y;
+}
+
+Vector2f BodyStore::get_acceleration(BodyHandle body) const
+{
+    const std::uint32_t index = dense(body);
+    return Vector2f{acceleration_x_[index], acceleration_y_[index]};
+}
+
+void BodyStore::set_drag(BodyHandle body, Vector2f drag)
+{
+    const std::uint32_t index = dense(body);
+    drag_x_[index]            = drag.x;
+    drag_y_[index]            = drag.y;
+}
+
+Vector2f BodyStore::get_drag(BodyHandle body) const
+{
+    const std::uint32_t index = dense(body);
+    return Vector2f{drag_x_[index], drag_y_[index]};
+}
+
+void BodyStore::set_max_velocity(BodyHandle body, float max_velocity)
+{
+    max_velocity_[dense(body)] = max_velocity;
+}
+
+float BodyStore::get_max_velocity(BodyHandle body) const
+{
+    return max_velocity_[dense(body)];
+}
+
+void BodyStore::set_gravity_scale(BodyHandle body, float gravity_scale)
+{
+    gravity_scale_[dense(body)] = gravity_scale;
+}
+
+float BodyStore::get_gravity_scale(BodyHandle body) const
+{
+    return gravity_scale_[dense(body)];
+}
+
+void BodyStore::set_movable(BodyHandle body, std::uint8_t movable)
+{
+    std::uint32_t& flags = flags_[dense(body)];
+    flags                = (flags & ACTIVE) | (movable & YES);
+}
+
+bool BodyStore::is_movable(BodyHandle body, std::uint8_t axes) const
+{
+    const std::uint32_t movable = flags_[dense(body)] & YES;
+
+    if ((axes == YES) || (axes == NOT))
+    {
+        return movable == axes;
+    }
+
+    return (movable & axes) != NOT;
+}
+
+void BodyStore::set_active(BodyHandle body, bool active)
+{
+    std::uint32_t& flags = flags_[dense(body)];
+    flags                = active ? (flags | ACTIVE) : (flags & ~ACTIVE);
+}
+
+bool BodyStore::is_active(BodyHandle body) const
+{
+    return (flags_[dense(body)] & ACTIVE) != 0U;
+}
+
+std::uint32_t BodyStore::dense(BodyHandle body) const
+{
+    return slots_[body.index].dense_index;
+}
+
+} // namespace rinvid
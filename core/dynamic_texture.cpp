@@ -0,0 +1,164 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "core/include/dynamic_texture.h"
+#include "core/include/rinvid_gfx.h"
+#include "util/include/error_handler.h"
+
+namespace rinvid
+{
+
+constexpr std::size_t BYTES_PER_PIXEL{4U};
+
+DynamicTexture::DynamicTexture(std::int32_t width, std::int32_t height,
+                               std::uint32_t pixel_buffer_count)
+    : Texture{width, height}, pixel_buffer_objects_(std::max(pixel_buffer_count, 1U), 0U),
+      fences_(std::max(pixel_buffer_count, 1U), nullptr), next_buffer_{0U}, orphan_count_{0U},
+      buffer_size_{static_cast<std::size_t>(width) * static_cast<std::size_t>(height) *
+                   BYTES_PER_PIXEL}
+{
+    GL_CALL(glGenBuffers(static_cast<GLsizei>(pixel_buffer_objects_.size()),
+                         pixel_buffer_objects_.data()));
+
+    for (auto pixel_buffer_object : pixel_buffer_objects_)
+    {
+        GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixel_buffer_object));
+        GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, buffer_size_, nullptr, GL_STREAM_DRAW));
+    }
+
+    GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+}
+
+DynamicTexture::~DynamicTexture()
+{
+    release_pixel_buffers();
+}
+
+void DynamicTexture::release_pixel_buffers()
+{
+    for (auto& fence : fences_)
+    {
+        if (fence != nullptr)
+        {
+            GL_CALL(glDeleteSync(fence));
+            fence = nullptr;
+        }
+    }
+
+    if (!pixel_buffer_objects_.empty())
+    {
+        GL_CALL(glDeleteBuffers(static_cast<GLsizei>(pixel_buffer_objects_.size()),
+                                pixel_buffer_objects_.data()));
+        pixel_buffer_objects_.clear();
+    }
+}
+
+void DynamicTexture::update(const Rect& region, const std::uint8_t* pixels,
+                            std::int32_t row_length)
+{
+    if (pixels == nullptr)
+    {
+        return;
+    }
+
+    if (row_length == 0)
+    {
+        row_length = region.width;
+    }
+
+    // Clip region to the texture, skipping source pixels which fall outside of it
+    const auto   region_x = static_cast<std::int32_t>(region.position.x);
+    const auto   region_y = static_cast<std::int32_t>(region.position.y);
+    std::int32_t x        = std::max(region_x, 0);
+    std::int32_t y        = std::max(region_y, 0);
+    std::int32_t width    = std::min(region_x + region.width, width_) - x;
+    std::int32_t height   = std::min(region_y + region.height, height_) - y;
+    if ((width <= 0) || (height <= 0))
+    {
+        return;
+    }
+
+    pixels += (static_cast<std::size_t>(y - region_y) * row_length + (x - region_x)) *
+              BYTES_PER_PIXEL;
+
+    auto& fence = fences_[next_buffer_];
+    GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixel_buffer_objects_[next_buffer_]));
+
+    // If GPU is still reading this buffer, orphan it: driver hands out fresh storage and frees the
+    // old one once it is no longer used, instead of making us wait
+    if (fence != nullptr)
+    {
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if ((status != GL_ALREADY_SIGNALED) && (status != GL_CONDITION_SATISFIED))
+        {
+            GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, buffer_size_, nullptr, GL_STREAM_DRAW));
+            ++orphan_count_;
+        }
+
+        GL_CALL(glDeleteSync(fence));
+        fence = nullptr;
+    }
+
+    const std::size_t row_size    = static_cast<std::size_t>(width) * BYTES_PER_PIXEL;
+    const std::size_t upload_size = row_size * static_cast<std::size_t>(height);
+
+    auto* destination = static_cast<std::uint8_t*>(glMapBufferRange(
+        GL_PIXEL_UNPACK_BUFFER, 0, upload_size,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+
+    if (destination == nullptr)
+    {
+        GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        errors::put_error_to_log("Dynamic texture: could not map pixel buffer");
+        return;
+    }
+
+    // Pixel buffer holds tightly packed rows of the clipped region
+    for (std::int32_t row{0}; row < height; ++row)
+    {
+        std::memcpy(destination + row * row_size,
+                    pixels + static_cast<std::size_t>(row) * row_length * BYTES_PER_PIXEL,
+                    row_size);
+    }
+
+    GL_CALL(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+    RinvidGfx::count_buffer_upload(upload_size);
+
+    // Source is the bound pixel buffer, so this returns immediately and the copy happens on GPU
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture_id_));
+    RinvidGfx::count_texture_bind();
+    GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE,
+                            nullptr));
+
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+    if (mipmaps_)
+    {
+        GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+    }
+
+    next_buffer_ = (next_buffer_ + 1U) % static_cast<std::uint32_t>(pixel_buffer_objects_.size());
+}
+
+void DynamicTexture::update(const std::uint8_t* pixels)
+{
+    update(Rect{Vector2f{0.0F, 0.0F}, width_, height_}, pixels);
+}
+
+std::uint32_t DynamicTexture::get_orphan_count() const
+{
+    return orphan_count_;
+}
+
+} // namespace rinvid
@@ -0,0 +1,93 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "include/fixed_time_step.h"
+
+namespace rinvid
+{
+
+FixedTimeStep::FixedTimeStep(double time_step, std::uint32_t max_steps_per_frame)
+    : time_step_{std::max(time_step, 0.0)},
+      max_steps_per_frame_{std::max(max_steps_per_frame, 1U)}, accumulator_{0.0},
+      dropped_steps_{0U}
+{
+}
+
+void FixedTimeStep::set_time_step(double time_step)
+{
+    time_step_   = std::max(time_step, 0.0);
+    accumulator_ = 0.0;
+}
+
+double FixedTimeStep::get_time_step() const
+{
+    return time_step_;
+}
+
+void FixedTimeStep::set_max_steps_per_frame(std::uint32_t max_steps_per_frame)
+{
+    max_steps_per_frame_ = std::max(max_steps_per_frame, 1U);
+}
+
+bool FixedTimeStep::is_enabled() const
+{
+    return time_step_ > 0.0;
+}
+
+std::uint32_t FixedTimeStep::advance(double frame_time)
+{
+    if (!is_enabled())
+    {
+        return 0U;
+    }
+
+    accumulator_ += std::max(frame_time, 0.0);
+
+    const double  pending_steps = std::floor(accumulator_ / time_step_);
+    std::uint32_t steps         = max_steps_per_frame_;
+    if (pending_steps <= max_steps_per_frame_)
+    {
+        steps = static_cast<std::uint32_t>(pending_steps);
+    }
+    else
+    {
+        // Keep only the fraction of a step, so that rendering still interpolates smoothly
+        dropped_steps_ += static_cast<std::uint64_t>(pending_steps) - max_steps_per_frame_;
+        accumulator_ = std::fmod(accumulator_, time_step_) + steps * time_step_;
+    }
+
+    accumulator_ -= steps * time_step_;
+
+    return steps;
+}
+
+double FixedTimeStep::get_alpha() const
+{
+    if (!is_enabled())
+    {
+        return 1.0;
+    }
+
+    return std::clamp(accumulator_ / time_step_, 0.0, 1.0);
+}
+
+std::uint64_t FixedTimeStep::get_dropped_steps() const
+{
+    return dropped_steps_;
+}
+
+void FixedTimeStep::reset()
+{
+    accumulator_ = 0.0;
+}
+
+} // namespace rinvid
@@ -0,0 +1,139 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <fstream>
+#include <utility>
+
+#include "core/include/font.h"
+#include "core/include/rinvid_gl.h"
+#include "core/include/ttf_lib.h"
+#include "util/include/error_handler.h"
+
+namespace rinvid
+{
+
+Font::Font(const std::string& font_path)
+{
+    const auto* ft_lib = TTFLib::get_instance();
+
+    auto error = FT_New_Face(*ft_lib, font_path.c_str(), 0, &ft_face_);
+    if (error)
+    {
+        TTFLib::release();
+        throw error;
+    }
+
+    std::ifstream file{font_path, std::ios::binary | std::ios::ate};
+    if (file.is_open())
+    {
+        file_size_ = static_cast<std::size_t>(file.tellg());
+    }
+}
+
+Font::~Font()
+{
+    for (const auto& [size, glyphs] : glyphs_)
+    {
+        (void)size;
+        for (const auto& [character_key, glyph] : glyphs)
+        {
+            (void)character_key;
+            GL_CALL(glDeleteTextures(1, &glyph.texture_id));
+        }
+    }
+
+    if (ft_face_ != nullptr)
+    {
+        FT_Done_Face(ft_face_);
+    }
+
+    TTFLib::release();
+}
+
+FT_Face Font::get_face() const
+{
+    return ft_face_;
+}
+
+std::size_t Font::get_file_size() const
+{
+    return file_size_;
+}
+
+const Font::Glyphs& Font::get_glyphs(std::uint32_t size)
+{
+    const auto found = glyphs_.find(size);
+    if (found != glyphs_.end())
+    {
+        return found->second;
+    }
+
+    Glyphs      new_glyphs{};
+    std::size_t new_glyph_memory{0U};
+    new_glyphs.reserve(128U);
+
+    FT_Set_Pixel_Sizes(ft_face_, 0, size);
+
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+    try
+    {
+        for (unsigned char c = 0; c < 128; c++)
+        {
+            if (FT_Load_Char(ft_face_, c, FT_LOAD_RENDER))
+            {
+                throw "Freetype: Failed to load Glyph";
+            }
+
+            std::uint32_t texture{};
+            GL_CALL(glGenTextures(1, &texture));
+            GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+            GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, ft_face_->glyph->bitmap.width,
+                                 ft_face_->glyph->bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE,
+                                 ft_face_->glyph->bitmap.buffer));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+
+            Glyph glyph = {
+                texture, glm::ivec2(ft_face_->glyph->bitmap.width, ft_face_->glyph->bitmap.rows),
+                glm::ivec2(ft_face_->glyph->bitmap_left, ft_face_->glyph->bitmap_top),
+                static_cast<unsigned int>(ft_face_->glyph->advance.x)};
+            new_glyphs.emplace(static_cast<char>(c), glyph);
+
+            // One byte per pixel
+            const auto& bitmap = ft_face_->glyph->bitmap;
+            new_glyph_memory += static_cast<std::size_t>(bitmap.width) * bitmap.rows;
+        }
+    }
+    catch (...)
+    {
+        for (auto& [character_key, glyph] : new_glyphs)
+        {
+            (void)character_key;
+            GL_CALL(glDeleteTextures(1, &glyph.texture_id));
+        }
+
+        throw;
+    }
+
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+
+    glyph_memory_ += new_glyph_memory;
+
+    return glyphs_.emplace(size, std::move(new_glyphs)).first->second;
+}
+
+std::size_t Font::get_glyph_memory() const
+{
+    return glyph_memory_;
+}
+
+} // namespace rinvid
@@ -0,0 +1,147 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <thread>
+
+#include "include/frame_pacer.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+// Initial spin time, enough to cover sleep overshoot on most Linux systems
+constexpr std::chrono::microseconds INITIAL_SPIN_TIME{1000};
+// Low latency mode starts frames this much earlier than estimated, in case a frame takes longer
+constexpr std::chrono::microseconds LOW_LATENCY_MARGIN{1000};
+// Share of the work time estimate kept each frame, the rest decays towards the latest frame
+constexpr double WORK_TIME_DECAY{0.95};
+// Share of the spin time kept each frame, so a single long overshoot isn't paid for forever
+constexpr double SPIN_TIME_DECAY{0.95};
+
+} // namespace
+
+FramePacer::FramePacer(std::uint16_t fps)
+    : frame_period_{}, spin_time_{INITIAL_SPIN_TIME}, estimated_work_time_{}, slot_start_{},
+      work_start_{}, missed_deadlines_{0U}, fps_{0U}, low_latency_{false}, started_{false}
+{
+    set_fps(fps);
+}
+
+void FramePacer::set_fps(std::uint16_t fps)
+{
+    fps_          = fps;
+    frame_period_ = (fps == 0U) ? Clock::duration::zero()
+                                : std::chrono::duration_cast<Clock::duration>(
+                                      std::chrono::duration<double>{1.0 / fps});
+    started_      = false;
+}
+
+std::uint16_t FramePacer::get_fps() const
+{
+    return fps_;
+}
+
+void FramePacer::set_low_latency(bool low_latency)
+{
+    low_latency_ = low_latency;
+}
+
+bool FramePacer::is_low_latency() const
+{
+    return low_latency_;
+}
+
+void FramePacer::begin_frame()
+{
+    if (fps_ == 0U)
+    {
+        work_start_ = Clock::now();
+        return;
+    }
+
+    if (!started_)
+    {
+        slot_start_ = Clock::now();
+        started_    = true;
+    }
+
+    auto start = slot_start_;
+    if (low_latency_)
+    {
+        const auto lead =
+            estimated_work_time_ + std::chrono::duration_cast<Clock::duration>(LOW_LATENCY_MARGIN);
+        start += std::max(frame_period_ - lead, Clock::duration::zero());
+    }
+
+    wait_until(start);
+    work_start_ = Clock::now();
+}
+
+void FramePacer::end_frame()
+{
+    const auto now       = Clock::now();
+    const auto work_time = now - work_start_;
+
+    const auto decayed_work_time =
+        std::chrono::duration_cast<Clock::duration>(estimated_work_time_ * WORK_TIME_DECAY);
+    estimated_work_time_ = std::max(work_time, decayed_work_time);
+
+    if (fps_ == 0U)
+    {
+        return;
+    }
+
+    const auto deadline = slot_start_ + frame_period_;
+    if (now > deadline)
+    {
+        ++missed_deadlines_;
+        slot_start_ = now;
+    }
+    else
+    {
+        slot_start_ = deadline;
+    }
+}
+
+std::uint64_t FramePacer::get_missed_deadlines() const
+{
+    return missed_deadlines_;
+}
+
+double FramePacer::get_estimated_work_time() const
+{
+    return std::chrono::duration<double>(estimated_work_time_).count();
+}
+
+void FramePacer::wait_until(Clock::time_point time)
+{
+    const auto wake_time = time - spin_time_;
+    if (Clock::now() < wake_time)
+    {
+        std::this_thread::sleep_until(wake_time);
+
+        // Sleeping past the time itself would miss it, spin longer from now on (but never for more
+        // than half a frame). Without overshoots spin time decays back to its initial value.
+        const auto overshoot = Clock::now() - wake_time;
+        const auto decayed_spin_time =
+            std::chrono::duration_cast<Clock::duration>(spin_time_ * SPIN_TIME_DECAY);
+        spin_time_ = std::max({overshoot, decayed_spin_time,
+                               std::chrono::duration_cast<Clock::duration>(INITIAL_SPIN_TIME)});
+        spin_time_ = std::min(spin_time_, frame_period_ / 2);
+    }
+
+    while (Clock::now() < time)
+    {
+    }
+}
+
+} // namespace rinvid
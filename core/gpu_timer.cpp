@@ -0,0 +1,216 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "core/include/rinvid_gl.h"
+#include "include/gpu_timer.h"
+#include "util/include/error_handler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+constexpr std::size_t NUMBER_OF_PASSES{static_cast<std::size_t>(GpuPass::Count)};
+
+// Results of a frame are read when its slot is reused, i.e. this many frames later
+constexpr std::size_t FRAMES_IN_FLIGHT{4U};
+
+using PassTimes = std::array<double, NUMBER_OF_PASSES>;
+
+struct FrameQueries
+{
+    // Queries are reused across frames, the pool only grows when a frame switches passes more
+    // often than any frame before it
+    std::vector<std::uint32_t> queries{};
+    std::vector<GpuPass>       passes{};
+    std::size_t                used{0U};
+};
+
+std::array<FrameQueries, FRAMES_IN_FLIGHT> frames{};
+std::size_t                                current_frame{0U};
+GpuPass                                    active_pass{GpuPass::Count};
+PassTimes                                  last_pass_times{};
+PassTimes                                  logged_pass_times{};
+std::uint32_t                              logged_frames{0U};
+std::uint32_t                              dropped_frames{0U};
+double                                     log_interval{0.0};
+std::chrono::steady_clock::time_point      last_log_time{};
+
+void end_active_query()
+{
+    if (active_pass != GpuPass::Count)
+    {
+        GL_CALL(glEndQuery(GL_TIME_ELAPSED));
+        active_pass = GpuPass::Count;
+    }
+}
+
+void collect(FrameQueries& frame)
+{
+    if (frame.used == 0U)
+    {
+        return;
+    }
+
+    // Queries complete in order, if the last one is available so are all the others
+    GLint available{GL_FALSE};
+    GL_CALL(glGetQueryObjectiv(frame.queries[frame.used - 1U], GL_QUERY_RESULT_AVAILABLE,
+                               &available));
+    if (available != GL_TRUE)
+    {
+        ++dropped_frames;
+        frame.used = 0U;
+        return;
+    }
+
+    last_pass_times.fill(0.0);
+    for (std::size_t i{0U}; i < frame.used; ++i)
+    {
+        GLuint64 elapsed_ns{0U};
+        GL_CALL(glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &elapsed_ns));
+        last_pass_times[static_cast<std::size_t>(frame.passes[i])] +=
+            static_cast<double>(elapsed_ns) / 1000000.0;
+    }
+    frame.used = 0U;
+
+    for (std::size_t pass{0U}; pass < NUMBER_OF_PASSES; ++pass)
+    {
+        logged_pass_times[pass] += last_pass_times[pass];
+    }
+    ++logged_frames;
+}
+
+void log_pass_times()
+{
+    auto                          now     = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed = now - last_log_time;
+    if ((log_interval <= 0.0) || (elapsed.count() < log_interval) || (logged_frames == 0U))
+    {
+        return;
+    }
+
+    std::cout << "GPU time per frame (ms):";
+    for (std::size_t pass{0U}; pass < NUMBER_OF_PASSES; ++pass)
+    {
+        std::cout << ' ' << get_gpu_pass_name(static_cast<GpuPass>(pass)) << ' '
+                  << logged_pass_times[pass] / logged_frames;
+    }
+    std::cout << " (" << dropped_frames << " frames dropped)\n";
+
+    logged_pass_times.fill(0.0);
+    logged_frames = 0U;
+    last_log_time = now;
+}
+
+} // namespace
+
+void GpuTimer::begin_pass(GpuPass pass)
+{
+    if (pass == active_pass)
+    {
+        return;
+    }
+
+    end_active_query();
+
+    auto& frame = frames[current_frame];
+    if (frame.used == frame.queries.size())
+    {
+        std::uint32_t query{};
+        GL_CALL(glGenQueries(1, &query));
+        frame.queries.push_back(query);
+        frame.passes.push_back(pass);
+    }
+
+    frame.passes[frame.used] = pass;
+    GL_CALL(glBeginQuery(GL_TIME_ELAPSED, frame.queries[frame.used]));
+    ++frame.used;
+    active_pass = pass;
+}
+
+void GpuTimer::end_frame()
+{
+    end_active_query();
+
+    current_frame = (current_frame + 1U) % FRAMES_IN_FLIGHT;
+    collect(frames[current_frame]);
+
+    log_pass_times();
+}
+
+double GpuTimer::get_pass_time(GpuPass pass)
+{
+    if (pass == GpuPass::Count)
+    {
+        return 0.0;
+    }
+
+    return last_pass_times[static_cast<std::size_t>(pass)];
+}
+
+std::uint32_t GpuTimer::get_dropped_frame_count()
+{
+    return dropped_frames;
+}
+
+void GpuTimer::set_log_interval(double seconds)
+{
+    log_interval  = seconds;
+    last_log_time = std::chrono::steady_clock::now();
+    logged_pass_times.fill(0.0);
+    logged_frames = 0U;
+}
+
+void GpuTimer::shutdown()
+{
+    end_active_query();
+
+    for (auto& frame : frames)
+    {
+        if (!frame.queries.empty())
+        {
+            GL_CALL(glDeleteQueries(static_cast<GLsizei>(frame.queries.size()),
+                                    frame.queries.data()));
+        }
+        frame.queries.clear();
+        frame.passes.clear();
+        frame.used = 0U;
+    }
+
+    current_frame = 0U;
+    last_pass_times.fill(0.0);
+}
+
+const char* get_gpu_pass_name(GpuPass pass)
+{
+    switch (pass)
+    {
+        case GpuPass::Shapes:
+            return "shapes";
+        case GpuPass::Textures:
+            return "textures";
+        case GpuPass::Text:
+            return "text";
+        case GpuPass::Particles:
+            return "particles";
+        case GpuPass::Other:
+            return "other";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace rinvid
@@ -10,22 +10,35 @@
 #ifndef CORE_INCLUDE_APPLICATION_H
 #define CORE_INCLUDE_APPLICATION_H
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <SFML/Window.hpp>
 
+#include "core/include/fixed_time_step.h"
+#include "core/include/frame_pacer.h"
+#include "core/include/render_snapshot.h"
 #include "core/include/screen.h"
+#include "system/include/input_recording.h"
+#include "system/include/input_state.h"
+#include "util/include/frame_time_histogram.h"
+#include "util/include/triple_buffer.h"
 #include "util/include/vector2.h"
 
 namespace rinvid
 {
 
-namespace system
-{
-class Mouse;
-}
+/// Time step used by simulation thread if application doesn't have one set, in seconds.
+constexpr double DEFAULT_SIMULATION_TIME_STEP{1.0 / 60.0};
+
+class PerfHud;
+class ResourceManager;
 
 class Application
 {
@@ -62,29 +75,202 @@ class Application
     /**************************************************************************************************
      * @brief Sets the framerate of the application
      *
+     * Must be called from the rendering thread (see set_simulation_thread).
+     *
      * @param fps The framerate to set expressed in frames per second. Pass 0 to have uncapped
      * framerate.
      *
      *************************************************************************************************/
     void set_fps(std::uint16_t fps);
 
+    /**************************************************************************************************
+     * @brief Enables or disables low latency mode. Frames then start as late as they can while
+     * still finishing in time, so input is polled right before rendering (see FramePacer). Has no
+     * effect with uncapped framerate. Must be called from the rendering thread.
+     *
+     * @param low_latency Should frames start as late as possible
+     *
+     *************************************************************************************************/
+    void set_low_latency(bool low_latency);
+
+    /**************************************************************************************************
+     * @brief Returns the number of frames that took longer than 1 / fps seconds.
+     *
+     * @return Number of missed frame deadlines
+     *
+     *************************************************************************************************/
+    std::uint64_t get_missed_deadlines() const;
+
+    /**************************************************************************************************
+     * @brief Returns frame times of the current screen so far. Frame time covers the work of a
+     * frame (events, update, drawing and presenting), not waiting for the next frame.
+     *
+     * @return Frame time report, named after the screen
+     *
+     *************************************************************************************************/
+    FrameTimeReport get_frame_time_report() const;
+
+    /**************************************************************************************************
+     * @brief Returns frame time reports of screens that were switched from, in order. Report of
+     * the last screen is added when run returns.
+     *
+     * @return Frame time reports
+     *
+     *************************************************************************************************/
+    const std::vector<FrameTimeReport>& get_frame_time_reports() const;
+
+    /**************************************************************************************************
+     * @brief Sets whether frame time report of a screen is printed when it is switched from and
+     * when run returns. Reports are printed by default.
+     *
+     * @param print Should reports be printed
+     *
+     *************************************************************************************************/
+    void set_print_frame_time_reports(bool print);
+
+    /**************************************************************************************************
+     * @brief Makes the application simulate with a fixed time step. Each frame, screen's
+     * fixed_update is called as many times as fit into the elapsed time, before update is called
+     * once to draw. Steps that don't fit into max_steps_per_frame are dropped, so a slow frame
+     * can't make simulation fall further behind.
+     *
+     * Safe to call from fixed_update on the simulation thread, change is applied before the next
+     * step on whichever thread steps the simulation.
+     *
+     * @param time_step Length of a step in seconds, pass 0 to disable fixed stepping (default)
+     * @param max_steps_per_frame Maximum number of fixed updates per frame
+     *
+     *************************************************************************************************/
+    void set_fixed_time_step(double        time_step,
+                             std::uint32_t max_steps_per_frame = DEFAULT_MAX_STEPS_PER_FRAME);
+
+    /**************************************************************************************************
+     * @brief Runs simulation on its own thread, so a slow simulation step doesn't hold back
+     * rendering and the two run at the same time on different cores. Simulation thread calls
+     * screen's fixed_update with a fixed time step (1 / 60 s if none is set) and then has the
+     * screen write a render snapshot (see Screen::write_snapshot). Rendering thread handles window
+     * events and draws the latest snapshot with Screen::render, update isn't called.
+     *
+     * Screens are still created and destroyed on the rendering thread, with simulation stopped.
+     * Can be called at any time, thread is started or stopped at the end of the current frame. If
+     * no fixed time step was set, the screen goes back to a variable one once the thread stops.
+     * Can't be enabled while recording input (see record_input).
+     *
+     * While the thread runs, fixed_update is called on it, so from there only set_screen,
+     * set_fixed_time_step, set_simulation_thread, get_input_state and exit may be called. Other
+     * setters, e.g. set_fps and set_low_latency, must be called from the rendering thread.
+     *
+     * @param enabled Should simulation run on its own thread
+     *
+     *************************************************************************************************/
+    void set_simulation_thread(bool enabled);
+
+    /**************************************************************************************************
+     * @brief Returns keyboard and mouse state of the current frame, captured from window events
+     * before the screen is updated. On the simulation thread, returns input gathered over the
+     * frames since its previous step instead, so no press is missed (see set_simulation_thread).
+     *
+     * @return Input state
+     *
+     *************************************************************************************************/
+    const system::InputState& get_input_state() const;
+
+    /**************************************************************************************************
+     * @brief Records input and delta time of every frame to a file, until run returns. Replaying
+     * the file reproduces the session, so a slow stretch can be rerun under a profiler.
+     * Simulation only repeats exactly if it depends on nothing but input and delta time, e.g. uses
+     * a fixed time step. Refused while simulation thread is enabled, as that one steps by wall
+     * clock time.
+     *
+     * @param file_name Path to the recording file (.rinp), replaced if it exists
+     *
+     * @return true if recording has started, false if the file couldn't be created or simulation
+     * thread is enabled
+     *
+     *************************************************************************************************/
+    bool record_input(const std::string& file_name);
+
+    /**************************************************************************************************
+     * @brief Replays a recording made with record_input instead of reading keyboard and mouse.
+     * Each frame is updated with its recorded delta time, whatever time it really takes, and the
+     * application exits once the recording ends. Simulation runs on the rendering thread while
+     * replaying, as the simulation thread steps by wall clock time. Call it before run.
+     *
+     * @param file_name Path to the recording file (.rinp)
+     *
+     * @return true if the recording has been loaded, false otherwise
+     *
+     *************************************************************************************************/
+    bool replay_input(const std::string& file_name);
+
     /**************************************************************************************************
      * @brief Exits the application.
      *
      *************************************************************************************************/
     void exit();
 
+    /**************************************************************************************************
+     * @brief Returns the resource cache shared by all screens of this application. Unused
+     * resources are purged on every screen switch.
+     *
+     * @return Resource manager
+     *
+     *************************************************************************************************/
+    ResourceManager& get_resource_manager();
+
+    /**************************************************************************************************
+     * @brief Shows or hides the performance overlay (see PerfHud). F3 toggles it too.
+     *
+     *************************************************************************************************/
+    void toggle_perf_hud();
+
   private:
-    friend class rinvid::system::Mouse;
     void activate_pending_screen();
     void destroy_current_screen();
     void handle_events(sf::Window& window, sf::Event& event);
+    bool update_input(double& delta_time);
+    void take_simulation_input();
+    void update_screen(double delta_time);
+    void finish_frame_time_report();
+    void apply_simulation_thread();
+    void apply_fixed_time_step();
+    void start_simulation();
+    void stop_simulation();
+    void simulate();
+
+    sf::Window                       window_;
+    std::unique_ptr<ResourceManager> resource_manager_;
+    std::unique_ptr<PerfHud>         perf_hud_;
+    std::unique_ptr<Screen>          current_screen_;
+    std::unique_ptr<Screen>          new_screen_;
+    std::mutex                       new_screen_mutex_;
+    FixedTimeStep                    fixed_time_step_;
+    FramePacer                       frame_pacer_;
+    FrameTimeHistogram               frame_time_histogram_;
+    std::vector<FrameTimeReport>     frame_time_reports_;
+    TripleBuffer<RenderSnapshot>     snapshots_;
+    system::InputState               input_state_;
+    // Input of frames the simulation thread hasn't taken yet, and input of its current step
+    system::InputState               pending_input_state_;
+    system::InputState               simulation_input_state_;
+    std::mutex                       input_mutex_;
+    system::InputRecorder            input_recorder_;
+    system::InputPlayer              input_player_;
+    std::thread                      simulation_thread_;
+    std::atomic<bool>                simulating_;
+    std::atomic<bool>                simulation_thread_enabled_;
+    // Whether start_simulation had to enable the fixed time step, so stop_simulation disables it
+    bool                             simulation_time_step_set_;
+    // Time step set by set_fixed_time_step, applied by the thread stepping the simulation
+    double                           pending_time_step_;
+    std::uint32_t                    pending_max_steps_per_frame_;
+    bool                             time_step_changed_;
+    std::mutex                       time_step_mutex_;
+    bool                             print_frame_time_reports_;
+    std::atomic<bool>                running_;
 
-    sf::Window              window_;
-    std::unique_ptr<Screen> current_screen_;
-    std::unique_ptr<Screen> new_screen_;
-    std::uint16_t           fps_;
-    bool                    running_;
+    // Input events are timed from the start of run
+    std::chrono::steady_clock::time_point start_time_;
 };
 
 } // namespace rinvid
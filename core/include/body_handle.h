@@ -0,0 +1,31 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_BODY_HANDLE_H
+#define CORE_INCLUDE_BODY_HANDLE_H
+
+#include <cstdint>
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Refers to a body in a BodyStore. A handle of a destroyed body never refers to another
+ * body, even one reusing its slot.
+ *
+ *************************************************************************************************/
+struct BodyHandle
+{
+    std::uint32_t index;
+    std::uint32_t generation;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_BODY_HANDLE_H
@@ -0,0 +1,313 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_BODY_STORE_H
+#define CORE_INCLUDE_BODY_STORE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "core/include/body_handle.h"
+#include "core/include/object.h"
+#include "util/include/vector2.h"
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Motion state of many bodies, stored as one array per field. Moves bodies the same way
+ * Object::update moves objects (velocity, acceleration, drag, gravity, maximum velocity), for all
+ * bodies in one pass which the compiler turns into SIMD code. Suits large numbers of simple
+ * bodies, e.g. bullets or debris, which don't need a whole Object each.
+ *
+ * Bodies are kept packed, destroying one moves the last body into its place, so handles are the
+ * way to refer to bodies. Functions taking a handle expect a valid one (see is_valid).
+ *
+ * An Object attached to a store (see Object::attach_body) keeps its motion in it, and is moved by
+ * World::integrate together with all other bodies, so it can still collide through World.
+ *
+ *************************************************************************************************/
+class BodyStore
+{
+  public:
+    BodyStore();
+
+    BodyStore(const BodyStore& other) = delete;
+
+    BodyStore& operator=(const BodyStore& other) = delete;
+
+    BodyStore(BodyStore&& other) = delete;
+
+    BodyStore& operator=(BodyStore&& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Destructor. Detaches objects still attached to the store.
+     *
+     *************************************************************************************************/
+    ~BodyStore();
+
+    /**************************************************************************************************
+     * @brief Adds a body, with the same defaults as Object has.
+     *
+     * @param position Position of the top left corner
+     *
+     * @return Handle of the body
+     *
+     *************************************************************************************************/
+    BodyHandle create(Vector2f position);
+
+    /**************************************************************************************************
+     * @brief Removes a body. Does nothing if handle is not valid. Object attached to the body, if
+     * any, is detached.
+     *
+     * @param body Handle of the body
+     *
+     *************************************************************************************************/
+    void destroy(BodyHandle body);
+
+    /**************************************************************************************************
+     * @brief Checks whether a handle refers to a body.
+     *
+     * @param body Handle to check
+     *
+     * @return true if body exists, false if it has been destroyed
+     *
+     *************************************************************************************************/
+    bool is_valid(BodyHandle body) const;
+
+    /**************************************************************************************************
+     * @brief Returns number of bodies.
+     *
+     * @return Number of bodies
+     *
+     *************************************************************************************************/
+    std::uint32_t get_count() const;
+
+    /**************************************************************************************************
+     * @brief Removes all bodies. Handles of removed bodies become invalid.
+     *
+     *************************************************************************************************/
+    void clear();
+
+    /**************************************************************************************************
+     * @brief Moves all active bodies by one step, as Object::update would. Gravity is taken from
+     * World::gravity.
+     *
+     * @param delta_time Length of the step in seconds
+     *
+     *************************************************************************************************/
+    void integrate(double delta_time);
+
+    /**************************************************************************************************
+     * @brief Moves a body to a position, without it moving there in between (interpolated position
+     * is the new one until the next step).
+     *
+     * @param body Handle of the body
+     * @param position New position of the top left corner
+     *
+     *************************************************************************************************/
+    void set_position(BodyHandle body, Vector2f position);
+
+    /**************************************************************************************************
+     * @brief Returns current position of a body.
+     *
+     * @param body Handle of the body
+     *
+     * @return Current position.
+     *
+     *************************************************************************************************/
+    Vector2f get_position(BodyHandle body) const;
+
+    /**************************************************************************************************
+     * @brief Returns position between the one before the last step and the current one.
+     *
+     * @param body Handle of the body
+     * @param alpha 0 gives position before the last step, 1 the current position (see
+     * Screen::get_interpolation_alpha)
+     *
+     * @return Interpolated position.
+     *
+     *************************************************************************************************/
+    Vector2f get_interpolated_position(BodyHandle body, float alpha) const;
+
+    /**************************************************************************************************
+     * @brief Sets the velocity of a body.
+     *
+     * @param body Handle of the body
+     * @param velocity New velocity.
+     *
+     *************************************************************************************************/
+    void set_velocity(BodyHandle body, Vector2f velocity);
+
+    /**************************************************************************************************
+     * @brief Returns current velocity of a body.
+     *
+     * @param body Handle of the body
+     *
+     * @return Current velocity.
+     *
+     *************************************************************************************************/
+    Vector2f get_velocity(BodyHandle body) const;
+
+    /**************************************************************************************************
+     * @brief Sets the acceleration of a body.
+     *
+     * @param body Handle of the body
+     * @param acceleration New acceleration.
+     *
+     *************************************************************************************************/
+    void set_acceleration(BodyHandle body, Vector2f acceleration);
+
+    /**************************************************************************************************
+     * @brief Returns current acceleration of a body.
+     *
+     * @param body Handle of the body
+     *
+     * @return Current acceleration.
+     *
+     *************************************************************************************************/
+    Vector2f get_acceleration(BodyHandle body) const;
+
+    /**************************************************************************************************
+     * @brief Sets drag (the rate of slowing down of a body).
+     *
+     * @param body Handle of the body
+     * @param drag Drag in pixels per second on each axis, not negative.
+     *
+     *************************************************************************************************/
+    void set_drag(BodyHandle body, Vector2f drag);
+
+    /**************************************************************************************************
+     * @brief Returns drag (the rate of slowing down of a body).
+     *
+     * @param body Handle of the body
+     *
+     * @return Drag in pixels per second on each axis.
+     *
+     *************************************************************************************************/
+    Vector2f get_drag(BodyHandle body) const;
+
+    /**************************************************************************************************
+     * @brief Sets the max_velocity of a body.
+     *
+     * @param body Handle of the body
+     * @param max_velocity New max_velocity, 0 for no limit.
+     *
+     *************************************************************************************************/
+    void set_max_velocity(BodyHandle body, float max_velocity);
+
+    /**************************************************************************************************
+     * @brief Returns current max_velocity of a body.
+     *
+     * @param body Handle of the body
+     *
+     * @return Current max_velocity.
+     *
+     *************************************************************************************************/
+    float get_max_velocity(BodyHandle body) const;
+
+    /**************************************************************************************************
+     * @brief Changes scale to which a body is affected by gravity.
+     *
+     * @param body Handle of the body
+     * @param gravity_scale Scale to which extent is the body affected by gravity, 0.0 being
+     * minimum.
+     *
+     *************************************************************************************************/
+    void set_gravity_scale(BodyHandle body, float gravity_scale);
+
+    /**************************************************************************************************
+     * @brief Returns scale to which a body is affected by gravity.
+     *
+     * @param body Handle of the body
+     *
+     * @return Gravity scale.
+     *
+     *************************************************************************************************/
+    float get_gravity_scale(BodyHandle body) const;
+
+    /**************************************************************************************************
+     * @brief Changes whether a body can be moved.
+     *
+     * @param body Handle of the body
+     * @param movable Directions in which the body can be moved. Possible values: NOT, YES,
+     * VERTICALLY, HORIZONTALLY
+     *
+     *************************************************************************************************/
+    void set_movable(BodyHandle body, std::uint8_t movable);
+
+    /**************************************************************************************************
+     * @brief Checks whether a body can be moved.
+     *
+     * @param body Handle of the body
+     * @param axes On which axes to perform the check. Possible values: NOT, YES, VERTICALLY,
+     * HORIZONTALLY
+     *
+     * @return true if the body is movable on given axes, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_movable(BodyHandle body, std::uint8_t axes = YES) const;
+
+    /**************************************************************************************************
+     * @brief Changes whether a body is active. Inactive bodies are not moved by integrate.
+     *
+     * @param body Handle of the body
+     * @param active New state
+     *
+     *************************************************************************************************/
+    void set_active(BodyHandle body, bool active);
+
+    /**************************************************************************************************
+     * @brief Checks whether a body is active.
+     *
+     * @param body Handle of the body
+     *
+     * @return true if the body is active, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_active(BodyHandle body) const;
+
+  private:
+    friend class Object;
+    friend class World;
+
+    struct Slot
+    {
+        std::uint32_t generation;
+        /// Index into the arrays, while the body exists
+        std::uint32_t dense_index;
+    };
+
+    std::uint32_t dense(BodyHandle body) const;
+
+    std::vector<float>         position_x_;
+    std::vector<float>         position_y_;
+    std::vector<float>         previous_x_;
+    std::vector<float>         previous_y_;
+    std::vector<float>         velocity_x_;
+    std::vector<float>         velocity_y_;
+    std::vector<float>         acceleration_x_;
+    std::vector<float>         acceleration_y_;
+    std::vector<float>         drag_x_;
+    std::vector<float>         drag_y_;
+    std::vector<float>         max_velocity_;
+    std::vector<float>         gravity_scale_;
+    /// Movable axes and active flag, as wide as floats so the integrator vectorises well
+    std::vector<std::uint32_t> flags_;
+    /// Slot of the body at each index
+    std::vector<std::uint32_t> slot_indices_;
+    /// Object attached to the body at each index, null for bodies without one
+    std::vector<Object*>       owners_;
+    std::vector<Slot>          slots_;
+    std::vector<std::uint32_t> free_slots_;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_BODY_STORE_H
@@ -0,0 +1,103 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_DYNAMIC_TEXTURE_H
+#define CORE_INCLUDE_DYNAMIC_TEXTURE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "core/include/rinvid_gl.h"
+#include "core/include/texture.h"
+#include "util/include/rect.h"
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief A texture whose contents can be changed every frame, e.g. a minimap, fog of war or a
+ * paint layer. Only changed (dirty) rectangles are uploaded.
+ *
+ * Updates are streamed through a ring of pixel buffer objects, the copy into the texture happens
+ * asynchronously on the GPU. A pixel buffer is reused only once the GPU is done with it, if it is
+ * still busy, its storage is orphaned instead of waiting, so the CPU never stalls on an upload.
+ *
+ *************************************************************************************************/
+class DynamicTexture : public Texture
+{
+  public:
+    /**************************************************************************************************
+     * @brief Constructor. Creates a fully transparent texture.
+     *
+     * @param width Width of the texture in pixels
+     * @param height Height of the texture in pixels
+     * @param pixel_buffer_count Number of pixel buffers in the ring. Three is enough for one
+     * update per frame with the GPU running up to two frames behind.
+     *
+     *************************************************************************************************/
+    DynamicTexture(std::int32_t width, std::int32_t height, std::uint32_t pixel_buffer_count = 3U);
+
+    DynamicTexture(const DynamicTexture& other) = delete;
+
+    DynamicTexture& operator=(const DynamicTexture& other) = delete;
+
+    DynamicTexture(DynamicTexture&& other) = delete;
+
+    DynamicTexture& operator=(DynamicTexture&& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Destructor. Releases pixel buffers.
+     *
+     *************************************************************************************************/
+    ~DynamicTexture();
+
+    /**************************************************************************************************
+     * @brief Replaces contents of a rectangle in the texture. Parts of the rectangle outside of the
+     * texture are ignored.
+     *
+     * @param region Rectangle to update, in pixels, origin (0, 0) is top left point of the texture
+     * @param pixels RGBA8 pixels of the top left corner of the region
+     * @param row_length Number of pixels in a row of source image. Allows passing a rectangle out
+     * of a bigger image, e.g. a CPU copy of the whole texture. Pass 0 if pixels are tightly packed
+     * (row length equals region width).
+     *
+     *************************************************************************************************/
+    void update(const Rect& region, const std::uint8_t* pixels, std::int32_t row_length = 0);
+
+    /**************************************************************************************************
+     * @brief Replaces contents of the whole texture.
+     *
+     * @param pixels RGBA8 pixels, width * height of them
+     *
+     *************************************************************************************************/
+    void update(const std::uint8_t* pixels);
+
+    /**************************************************************************************************
+     * @brief Returns number of uploads which had to orphan a busy pixel buffer. If this keeps
+     * growing, more pixel buffers would help.
+     *
+     * @return Number of orphaned pixel buffers
+     *
+     *************************************************************************************************/
+    std::uint32_t get_orphan_count() const;
+
+  private:
+    void release_pixel_buffers();
+
+    std::vector<std::uint32_t> pixel_buffer_objects_;
+    // Signaled once GPU is done reading the pixel buffer with the same index
+    std::vector<GLsync> fences_;
+    std::uint32_t       next_buffer_;
+    std::uint32_t       orphan_count_;
+    std::size_t         buffer_size_;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_DYNAMIC_TEXTURE_H
@@ -24,6 +24,7 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include "core/include/gpu_timer.h"
 #include "core/include/rinvid_gfx.h"
 #include "core/include/shape.h"
 #include "util/include/error_handler.h"
@@ -229,6 +230,7 @@ void FixedPolygonShape<number_of_vertices, draw_mode>::update_gl_buffer_data()
 
     GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_object_));
     GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(gl_vertices_), gl_vertices_, GL_DYNAMIC_DRAW));
+    RinvidGfx::count_buffer_upload(sizeof(gl_vertices_));
 }
 
 template <typename std::uint32_t number_of_vertices, GLenum draw_mode>
@@ -249,6 +251,7 @@ void FixedPolygonShape<number_of_vertices, draw_mode>::init_vertex_buffer()
     GL_CALL(glGenBuffers(1, &vertex_buffer_object_));
     GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_object_));
     GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(gl_vertices_), gl_vertices_, GL_DYNAMIC_DRAW));
+    RinvidGfx::count_buffer_upload(sizeof(gl_vertices_));
 
     GL_CALL(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0));
     GL_CALL(glEnableVertexAttribArray(0));
@@ -266,12 +269,16 @@ void FixedPolygonShape<number_of_vertices, draw_mode>::draw()
 template <typename std::uint32_t number_of_vertices, GLenum draw_mode>
 void FixedPolygonShape<number_of_vertices, draw_mode>::draw(Shader shader)
 {
+    RINVID_GPU_PASS(GpuPass::Shapes);
+
     shader.use();
     RinvidGfx::update_mvp_matrix(get_transform(), shader.get_id());
     shader.set_float4("in_color", color_.r, color_.g, color_.b, color_.a);
 
     GL_CALL(glBindVertexArray(vertex_array_object_));
     GL_CALL(glDrawArrays(draw_mode, 0, number_of_vertices_));
+    RinvidGfx::count_draw_call((draw_mode == GL_TRIANGLES) ? number_of_vertices_ / 3U
+                                                           : number_of_vertices_ - 2U);
     GL_CALL(glBindVertexArray(0));
 }
 
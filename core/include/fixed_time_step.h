@@ -0,0 +1,119 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_FIXED_TIME_STEP_H
+#define CORE_INCLUDE_FIXED_TIME_STEP_H
+
+#include <cstdint>
+
+namespace rinvid
+{
+
+/// Default limit on the number of simulation steps taken in a single frame.
+constexpr std::uint32_t DEFAULT_MAX_STEPS_PER_FRAME{5U};
+
+/**************************************************************************************************
+ * @brief Accumulates frame time and splits it into simulation steps of a fixed length, so that
+ * simulation doesn't depend on the frame rate. Time left over after the last step carries over to
+ * the next frame, and its fraction of a step is the alpha to interpolate rendering with.
+ *
+ * To keep simulation cost bounded after a slow frame, at most max_steps_per_frame steps are taken
+ * per frame. Time that would need more steps is dropped, so the simulation slows down instead of
+ * falling further and further behind.
+ *
+ *************************************************************************************************/
+class FixedTimeStep
+{
+  public:
+    /**************************************************************************************************
+     * @brief Constructor.
+     *
+     * @param time_step Length of a simulation step in seconds, 0 disables fixed stepping
+     * @param max_steps_per_frame Maximum number of steps taken in a single frame
+     *
+     *************************************************************************************************/
+    FixedTimeStep(double        time_step           = 0.0,
+                  std::uint32_t max_steps_per_frame = DEFAULT_MAX_STEPS_PER_FRAME);
+
+    /**************************************************************************************************
+     * @brief Sets the length of a simulation step. Accumulated time is discarded.
+     *
+     * @param time_step Length of a step in seconds, 0 disables fixed stepping
+     *
+     *************************************************************************************************/
+    void set_time_step(double time_step);
+
+    /**************************************************************************************************
+     * @brief Returns the length of a simulation step.
+     *
+     * @return Length of a step in seconds, 0 if fixed stepping is disabled
+     *
+     *************************************************************************************************/
+    double get_time_step() const;
+
+    /**************************************************************************************************
+     * @brief Sets the maximum number of steps taken in a single frame.
+     *
+     * @param max_steps_per_frame Maximum number of steps, at least 1
+     *
+     *************************************************************************************************/
+    void set_max_steps_per_frame(std::uint32_t max_steps_per_frame);
+
+    /**************************************************************************************************
+     * @brief Checks whether fixed stepping is enabled.
+     *
+     * @return True if time step is greater than 0, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_enabled() const;
+
+    /**************************************************************************************************
+     * @brief Adds time of a frame and returns how many steps to simulate for it.
+     *
+     * @param frame_time Duration of the frame in seconds
+     *
+     * @return Number of steps to take, 0 if fixed stepping is disabled
+     *
+     *************************************************************************************************/
+    std::uint32_t advance(double frame_time);
+
+    /**************************************************************************************************
+     * @brief Returns how far time has progressed past the last step, as a fraction of a step. Use
+     * it to interpolate rendering between the previous and current simulation state.
+     *
+     * @return Alpha in range [0, 1), 1 if fixed stepping is disabled
+     *
+     *************************************************************************************************/
+    double get_alpha() const;
+
+    /**************************************************************************************************
+     * @brief Returns the number of steps dropped because of the per frame limit, since
+     * construction.
+     *
+     * @return Number of dropped steps
+     *
+     *************************************************************************************************/
+    std::uint64_t get_dropped_steps() const;
+
+    /**************************************************************************************************
+     * @brief Discards accumulated time, e.g. when simulation starts over.
+     *
+     *************************************************************************************************/
+    void reset();
+
+  private:
+    double        time_step_;
+    std::uint32_t max_steps_per_frame_;
+    double        accumulator_;
+    std::uint64_t dropped_steps_;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_FIXED_TIME_STEP_H
@@ -0,0 +1,116 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_FONT_H
+#define CORE_INCLUDE_FONT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "extern/glm/glm/glm.hpp"
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief A font face loaded from file. Can be shared between many Text objects. Glyphs of each
+ * size are rendered once and shared by all texts of that size.
+ *
+ *************************************************************************************************/
+class Font
+{
+  public:
+    /**************************************************************************************************
+     * @brief A glyph rendered into a texture.
+     *
+     *************************************************************************************************/
+    struct Glyph
+    {
+        std::uint32_t texture_id;
+        glm::ivec2    size;
+        glm::ivec2    bearing;
+        std::uint32_t advance;
+    };
+
+    using Glyphs = std::unordered_map<char, Glyph>;
+
+    /**************************************************************************************************
+     * @brief Constructor. Throws FreeType error code if font could not be loaded.
+     *
+     * @param font_path Path to font on the filesystem.
+     *
+     *************************************************************************************************/
+    Font(const std::string& font_path);
+
+    Font(const Font& other) = delete;
+
+    Font& operator=(const Font& other) = delete;
+
+    Font(Font&& other) = delete;
+
+    Font& operator=(Font&& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Destructor. Releases font face and glyph textures.
+     *
+     *************************************************************************************************/
+    ~Font();
+
+    /**************************************************************************************************
+     * @brief Returns FreeType face of this font.
+     *
+     * @return FreeType face.
+     *
+     *************************************************************************************************/
+    FT_Face get_face() const;
+
+    /**************************************************************************************************
+     * @brief Returns size of font file, used as an estimate of memory held by the font.
+     *
+     * @return Size in bytes.
+     *
+     *************************************************************************************************/
+    std::size_t get_file_size() const;
+
+    /**************************************************************************************************
+     * @brief Returns glyphs of ASCII characters at a size. Glyphs of a size are rendered and
+     * uploaded on first request and kept until the font is destroyed. Throws if a glyph could not
+     * be rendered.
+     *
+     * @param size Font size in pixels.
+     *
+     * @return Glyphs, valid as long as the font.
+     *
+     *************************************************************************************************/
+    const Glyphs& get_glyphs(std::uint32_t size);
+
+    /**************************************************************************************************
+     * @brief Returns memory held by textures of all rendered glyphs.
+     *
+     * @return Size in bytes.
+     *
+     *************************************************************************************************/
+    std::size_t get_glyph_memory() const;
+
+  private:
+    FT_Face                         ft_face_{nullptr};
+    std::size_t                     file_size_{};
+    std::size_t                     glyph_memory_{};
+    std::map<std::uint32_t, Glyphs> glyphs_{};
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_FONT_H
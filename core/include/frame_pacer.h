@@ -0,0 +1,123 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_FRAME_PACER_H
+#define CORE_INCLUDE_FRAME_PACER_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Limits the frame rate by giving each frame a time slot of 1 / fps seconds. Waiting for a
+ * slot sleeps for most of the time and spins for the rest, since sleeping alone can overshoot by
+ * the OS scheduler granularity. Spin time grows to cover overshoots and decays back when they stop.
+ *
+ * Call begin_frame before polling input and end_frame after presenting the frame. A frame which
+ * ends after its slot is counted as a missed deadline, and the next slot starts right away instead
+ * of trying to catch up.
+ *
+ * In low latency mode a frame starts as late as possible, so that its work is estimated to end
+ * just before the end of its slot. Input is then polled right before rendering instead of up to a
+ * whole frame earlier.
+ *
+ *************************************************************************************************/
+class FramePacer
+{
+  public:
+    /**************************************************************************************************
+     * @brief Constructor.
+     *
+     * @param fps Frames per second, 0 for uncapped framerate
+     *
+     *************************************************************************************************/
+    explicit FramePacer(std::uint16_t fps = 0U);
+
+    /**************************************************************************************************
+     * @brief Sets the framerate. Next slot starts with the next frame.
+     *
+     * @param fps Frames per second, 0 for uncapped framerate
+     *
+     *************************************************************************************************/
+    void set_fps(std::uint16_t fps);
+
+    /**************************************************************************************************
+     * @brief Returns the framerate.
+     *
+     * @return Frames per second, 0 if framerate is uncapped
+     *
+     *************************************************************************************************/
+    std::uint16_t get_fps() const;
+
+    /**************************************************************************************************
+     * @brief Enables or disables low latency mode.
+     *
+     * @param low_latency Should frames start as late as possible
+     *
+     *************************************************************************************************/
+    void set_low_latency(bool low_latency);
+
+    /**************************************************************************************************
+     * @brief Checks whether low latency mode is enabled.
+     *
+     * @return True if low latency mode is enabled, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_low_latency() const;
+
+    /**************************************************************************************************
+     * @brief Waits for the start of the frame.
+     *
+     *************************************************************************************************/
+    void begin_frame();
+
+    /**************************************************************************************************
+     * @brief Ends the frame, checking whether it met its deadline.
+     *
+     *************************************************************************************************/
+    void end_frame();
+
+    /**************************************************************************************************
+     * @brief Returns the number of frames that ended after their slot, since construction.
+     *
+     * @return Number of missed deadlines
+     *
+     *************************************************************************************************/
+    std::uint64_t get_missed_deadlines() const;
+
+    /**************************************************************************************************
+     * @brief Returns the estimated time a frame takes between begin_frame and end_frame. It is
+     * a decaying maximum of recent frames, so a single slow frame raises it at once.
+     *
+     * @return Estimated work time in seconds
+     *
+     *************************************************************************************************/
+    double get_estimated_work_time() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    void wait_until(Clock::time_point time);
+
+    Clock::duration   frame_period_;
+    Clock::duration   spin_time_;
+    Clock::duration   estimated_work_time_;
+    Clock::time_point slot_start_;
+    Clock::time_point work_start_;
+    std::uint64_t     missed_deadlines_;
+    std::uint16_t     fps_;
+    bool              low_latency_;
+    bool              started_;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_FRAME_PACER_H
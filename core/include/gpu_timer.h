@@ -0,0 +1,123 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_GPU_TIMER_H
+#define CORE_INCLUDE_GPU_TIMER_H
+
+#include <cstdint>
+
+/// Rinvid draw calls are only timed if RINVID_GPU_TIMING is defined (CMake option of the same
+/// name). Otherwise the macros below expand to nothing and timing costs nothing.
+#ifdef RINVID_GPU_TIMING
+#define RINVID_GPU_PASS(pass) rinvid::GpuTimer::begin_pass(pass)
+#define RINVID_GPU_END_FRAME() rinvid::GpuTimer::end_frame()
+#else
+#define RINVID_GPU_PASS(pass) ((void)0)
+#define RINVID_GPU_END_FRAME() ((void)0)
+#endif
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Category GPU work is attributed to.
+ *
+ *************************************************************************************************/
+enum class GpuPass
+{
+    /// Shapes drawn with FixedPolygonShape (rectangles, circles, triangles, quads).
+    Shapes = 0U,
+    /// Textures, including sprites and animations drawn through them.
+    Textures,
+    /// Text.
+    Text,
+    /// Particle simulation and drawing.
+    Particles,
+    /// Anything marked by the user.
+    Other,
+    /// Number of passes, not a pass.
+    Count
+};
+
+/**************************************************************************************************
+ * @brief Measures how GPU time of a frame splits between passes, using GL_TIME_ELAPSED queries.
+ * Consecutive draws of the same pass share one query, a new query starts whenever the pass
+ * changes. Queries of a frame are only read back a few frames later, from a ring of frames, so
+ * reading results never waits for the GPU.
+ *
+ * All functions and members are static. Application ends frames itself, applications not using
+ * Application should call end_frame after each frame.
+ *
+ *************************************************************************************************/
+class GpuTimer
+{
+  public:
+    /**************************************************************************************************
+     * @brief Attributes GPU work submitted from now on to a pass. Rinvid draw calls do this
+     * through RINVID_GPU_PASS, user code should use the macro as well.
+     *
+     * @param pass Pass to attribute GPU work to
+     *
+     *************************************************************************************************/
+    static void begin_pass(GpuPass pass);
+
+    /**************************************************************************************************
+     * @brief Ends current frame and collects results of the oldest frame in the ring, if the GPU
+     * has finished it. Results not ready by then are dropped instead of waited for.
+     *
+     *************************************************************************************************/
+    static void end_frame();
+
+    /**************************************************************************************************
+     * @brief Returns GPU time of a pass in the most recently collected frame.
+     *
+     * @param pass Pass to return time of
+     *
+     * @return GPU time in milliseconds
+     *
+     *************************************************************************************************/
+    static double get_pass_time(GpuPass pass);
+
+    /**************************************************************************************************
+     * @brief Returns number of frames whose results were dropped because the GPU didn't finish them
+     * in time.
+     *
+     * @return Number of dropped frames
+     *
+     *************************************************************************************************/
+    static std::uint32_t get_dropped_frame_count();
+
+    /**************************************************************************************************
+     * @brief Sets how often average pass times are printed to console.
+     *
+     * @param seconds Interval in seconds, 0 disables printing (default)
+     *
+     *************************************************************************************************/
+    static void set_log_interval(double seconds);
+
+    /**************************************************************************************************
+     * @brief Releases all queries. Called by RinvidGfx::shutdown.
+     *
+     *************************************************************************************************/
+    static void shutdown();
+};
+
+/**************************************************************************************************
+ * @brief Returns printable name of a pass.
+ *
+ * @param pass Pass
+ *
+ * @return Name of the pass
+ *
+ *************************************************************************************************/
+const char* get_gpu_pass_name(GpuPass pass);
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_GPU_TIMER_H
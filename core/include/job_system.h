@@ -0,0 +1,177 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_JOB_SYSTEM_H
+#define CORE_INCLUDE_JOB_SYSTEM_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace rinvid
+{
+
+using Job = std::function<void()>;
+
+/**************************************************************************************************
+ * @brief Counts unfinished jobs. Pass it when running jobs to wait for them, or to run other jobs
+ * after them. Must outlive the jobs it counts.
+ *
+ *************************************************************************************************/
+class JobCounter
+{
+  public:
+    JobCounter();
+
+    JobCounter(const JobCounter& other) = delete;
+
+    JobCounter& operator=(const JobCounter& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Checks whether all counted jobs are finished.
+     *
+     * @return true if no counted job is left, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_done() const;
+
+  private:
+    friend class JobSystem;
+
+    struct Continuation
+    {
+        Job         job;
+        JobCounter* counter;
+        bool        on_main_thread;
+    };
+
+    // Count is only changed and read with the mutex locked, so a waiter can't see it drop to zero
+    // and destroy the counter while the finishing job still uses it
+    std::uint32_t             pending_;
+    std::vector<Continuation> continuations_;
+    mutable std::mutex        mutex_;
+};
+
+/**************************************************************************************************
+ * @brief Runs jobs on worker threads. Each worker has its own queue, takes the newest job from it
+ * and steals the oldest one from another worker when it runs out. Jobs needing the OpenGL context
+ * go to a separate queue, run on the rendering thread when it calls process_main_thread_jobs.
+ *
+ * All functions and members are static. Workers are started on first use, one per core except the
+ * one left to the rendering thread. Application processes main thread jobs once per frame,
+ * applications not using Application should call process_main_thread_jobs themselves.
+ *
+ *************************************************************************************************/
+class JobSystem
+{
+  public:
+    /**************************************************************************************************
+     * @brief Queues a job for a worker thread.
+     *
+     * @param job Job to run
+     * @param counter Counter to count the job in, can be nullptr
+     *
+     *************************************************************************************************/
+    static void run(Job job, JobCounter* counter = nullptr);
+
+    /**************************************************************************************************
+     * @brief Queues a job for a worker thread once all jobs counted by dependency are finished.
+     *
+     * @param dependency Counter of jobs which have to finish first
+     * @param job Job to run
+     * @param counter Counter to count the job in, can be nullptr. It counts the job from this call
+     * on, not just from when it is queued.
+     *
+     *************************************************************************************************/
+    static void run_after(JobCounter& dependency, Job job, JobCounter* counter = nullptr);
+
+    /**************************************************************************************************
+     * @brief Queues a job for the rendering thread.
+     *
+     * @param job Job to run
+     * @param counter Counter to count the job in, can be nullptr. Don't wait on it from the
+     * rendering thread, main thread jobs only run in process_main_thread_jobs.
+     *
+     *************************************************************************************************/
+    static void run_on_main_thread(Job job, JobCounter* counter = nullptr);
+
+    /**************************************************************************************************
+     * @brief Queues a job for the rendering thread once all jobs counted by dependency are
+     * finished.
+     *
+     * @param dependency Counter of jobs which have to finish first
+     * @param job Job to run
+     * @param counter Counter to count the job in, can be nullptr
+     *
+     *************************************************************************************************/
+    static void run_on_main_thread_after(JobCounter& dependency, Job job,
+                                         JobCounter* counter = nullptr);
+
+    /**************************************************************************************************
+     * @brief Waits until all jobs counted by counter are finished. Calling thread runs queued jobs
+     * in the meantime instead of sleeping.
+     *
+     * @param counter Counter to wait on
+     *
+     *************************************************************************************************/
+    static void wait(JobCounter& counter);
+
+    /**************************************************************************************************
+     * @brief Calls body for each batch of indices in [0, count) in parallel, and waits for all of
+     * them. Calling thread runs batches too. Ranges no bigger than a batch are run directly,
+     * without any jobs.
+     *
+     * @param count Number of indices
+     * @param batch_size Number of indices per call of body, big enough to outweigh the cost of a
+     * job (a few microseconds of work)
+     * @param body Function taking the first index of a batch and the index past its last
+     *
+     *************************************************************************************************/
+    static void parallel_for(std::uint32_t count, std::uint32_t batch_size,
+                             const std::function<void(std::uint32_t, std::uint32_t)>& body);
+
+    /**************************************************************************************************
+     * @brief Runs jobs queued for the rendering thread. Must be called from the thread owning the
+     * OpenGL context.
+     *
+     * @return Number of jobs run
+     *
+     *************************************************************************************************/
+    static std::uint32_t process_main_thread_jobs();
+
+    /**************************************************************************************************
+     * @brief Returns number of worker threads, starting them if they are not running.
+     *
+     * @return Number of workers
+     *
+     *************************************************************************************************/
+    static std::uint32_t get_worker_count();
+
+    /**************************************************************************************************
+     * @brief Runs the jobs still queued for workers and stops worker threads. Jobs queued for the
+     * rendering thread are dropped.
+     *
+     *************************************************************************************************/
+    static void shutdown();
+
+  private:
+    static void start_workers();
+    static void work(std::int32_t worker_index);
+    static bool run_queued_job(std::int32_t worker_index);
+    static void count(JobCounter* counter);
+    static void queue(Job job, JobCounter* counter, bool on_main_thread);
+    static void queue_after(JobCounter& dependency, Job job, JobCounter* counter,
+                            bool on_main_thread);
+    static void finish(JobCounter* counter);
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_JOB_SYSTEM_H
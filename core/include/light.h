@@ -110,6 +110,8 @@ class Light
     void update(Vector2f camera_pos = {0.0F, 0.0F});
 
   private:
+    friend class RenderSnapshot;
+
     /**************************************************************************************************
      * @brief Helper function to remap a floating point value from one range to another.
      *
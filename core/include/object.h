@@ -12,6 +12,7 @@
 
 #include <cstdint>
 
+#include "core/include/body_handle.h"
 #include "data_types/include/rect_pod.h"
 #include "util/include/rect.h"
 #include "util/include/vector2.h"
@@ -19,6 +20,7 @@
 namespace rinvid
 {
 
+class BodyStore;
 class World;
 
 // Constants related to 'touching' property
@@ -52,16 +54,69 @@ class Object : public virtual RectPOD
      *************************************************************************************************/
     Object(bool kinematic = false);
 
-    virtual ~Object()
-    {
-    }
+    /**************************************************************************************************
+     * @brief Copy constructor. Copy is not attached to a BodyStore, even if the original is.
+     *
+     *************************************************************************************************/
+    Object(const Object& other);
+
+    /**************************************************************************************************
+     * @brief Copy assignment. Object stays attached to its own BodyStore, if any.
+     *
+     *************************************************************************************************/
+    Object& operator=(const Object& other);
+
+    /**************************************************************************************************
+     * @brief Move constructor. Takes over the body of the other object, if attached.
+     *
+     *************************************************************************************************/
+    Object(Object&& other) noexcept;
 
     /**************************************************************************************************
-     * @brief Updates object state. Should be called each frame.
+     * @brief Move assignment. Takes over the body of the other object, if attached.
+     *
+     *************************************************************************************************/
+    Object& operator=(Object&& other) noexcept;
+
+    /**************************************************************************************************
+     * @brief Destructor. Detaches the object from its BodyStore, if attached.
+     *
+     *************************************************************************************************/
+    virtual ~Object();
+
+    /**************************************************************************************************
+     * @brief Updates object state. Should be called each frame. Objects attached to a BodyStore
+     * are moved by World::integrate instead, for them this does nothing.
      *
      *************************************************************************************************/
     virtual void update(double delta_time);
 
+    /**************************************************************************************************
+     * @brief Keeps motion of the object in a BodyStore, so it is moved together with all bodies of
+     * the store by World::integrate. Position, velocity and touching flags of the object are
+     * updated after each step, so it collides through World as before. Store must outlive the
+     * object or the object has to be detached first.
+     *
+     * @param store Store to keep the motion in
+     *
+     *************************************************************************************************/
+    void attach_body(BodyStore& store);
+
+    /**************************************************************************************************
+     * @brief Removes the body of the object from its BodyStore, object is moved by update again.
+     * Does nothing if the object is not attached.
+     *
+     *************************************************************************************************/
+    void detach_body();
+
+    /**************************************************************************************************
+     * @brief Checks whether the object keeps its motion in a BodyStore.
+     *
+     * @return true if attached, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_body_attached() const;
+
     /**************************************************************************************************
      * @brief Returns current position of the object.
      *
@@ -70,6 +125,17 @@ class Object : public virtual RectPOD
      *************************************************************************************************/
     Vector2f get_position();
 
+    /**************************************************************************************************
+     * @brief Returns position between the one before the last update and the current one.
+     *
+     * @param alpha 0 gives position before the last update, 1 the current position (see
+     * Screen::get_interpolation_alpha)
+     *
+     * @return Interpolated position.
+     *
+     *************************************************************************************************/
+    Vector2f get_interpolated_position(float alpha);
+
     /**************************************************************************************************
      * @brief Sets the velocity of the object.
      *
@@ -268,12 +334,17 @@ class Object : public virtual RectPOD
     void kill();
 
   protected:
+    friend class BodyStore;
     friend class World;
     float compute_velocity(double delta_time, float velocity, float acceleration, float drag,
                            float max_velocity, bool gravity = false);
 
     void update_motion(double delta_time);
 
+    void copy_motion(const Object& other);
+
+    void update_body();
+
     Vector2f     previous_position_;
     Vector2f     velocity_;
     Vector2f     acceleration_;
@@ -286,6 +357,8 @@ class Object : public virtual RectPOD
     std::uint8_t movable_;
     std::uint8_t touching_;
     std::uint8_t allowed_collisions_;
+    BodyStore*   body_store_;
+    BodyHandle   body_;
 };
 
 } // namespace rinvid
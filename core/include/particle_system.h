@@ -0,0 +1,203 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_PARTICLE_SYSTEM_H
+#define CORE_INCLUDE_PARTICLE_SYSTEM_H
+
+#include <cstdint>
+#include <vector>
+
+#include "core/include/drawable.h"
+#include "core/include/shader.h"
+#include "util/include/color.h"
+#include "util/include/vector2.h"
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Where particles are simulated.
+ *
+ *************************************************************************************************/
+enum class ParticleBackend
+{
+    /// Particles are updated on the CPU and uploaded to the GPU each frame.
+    Cpu = 0U,
+    /// Particles are updated on the GPU with transform feedback, ping-ponging between two buffers.
+    /// Particle data is only read back by get_positions.
+    TransformFeedback
+};
+
+/**************************************************************************************************
+ * @brief Parameters controlling how particles are spawned and how they move. Set from the CPU,
+ * they are passed to the simulation as uniforms when the transform feedback backend is used.
+ *
+ *************************************************************************************************/
+struct ParticleEmitterParams
+{
+    /// Center of the spawn area in pixels.
+    Vector2f position{0.0F, 0.0F};
+    /// Half extents of the rectangular spawn area in pixels.
+    Vector2f spawn_area{0.0F, 0.0F};
+    /// Lower bound of the initial velocity in pixels per second.
+    Vector2f min_velocity{-50.0F, -50.0F};
+    /// Upper bound of the initial velocity in pixels per second.
+    Vector2f max_velocity{50.0F, 50.0F};
+    /// Constant acceleration (e.g. gravity or wind) in pixels per second squared.
+    Vector2f acceleration{0.0F, 0.0F};
+    /// Shortest lifetime of a particle in seconds.
+    float min_lifetime{1.0F};
+    /// Longest lifetime of a particle in seconds.
+    float max_lifetime{2.0F};
+    /// Point size in pixels.
+    float size{2.0F};
+    /// Color of a freshly spawned particle.
+    Color start_color{1.0F, 1.0F, 1.0F, 1.0F};
+    /// Color of a particle at the end of its life.
+    Color end_color{1.0F, 1.0F, 1.0F, 0.0F};
+};
+
+/**************************************************************************************************
+ * @brief A fixed capacity particle system for large effects like rain, snow and sparks. Every slot
+ * is respawned as soon as its particle dies, so the emission rate is capacity / average lifetime.
+ *
+ *************************************************************************************************/
+class ParticleSystem : public Drawable
+{
+  public:
+    /**************************************************************************************************
+     * @brief Constructor.
+     *
+     * @param max_particles Number of particle slots.
+     * @param backend Where particles are simulated.
+     *
+     *************************************************************************************************/
+    ParticleSystem(std::uint32_t   max_particles,
+                   ParticleBackend backend = ParticleBackend::TransformFeedback);
+
+    ParticleSystem(const ParticleSystem& other) = delete;
+
+    ParticleSystem& operator=(const ParticleSystem& other) = delete;
+
+    ParticleSystem(ParticleSystem&& other) = delete;
+
+    ParticleSystem& operator=(ParticleSystem&& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Destructor. Releases OpenGL resources.
+     *
+     *************************************************************************************************/
+    ~ParticleSystem();
+
+    /**************************************************************************************************
+     * @brief Sets emission parameters. Takes effect for particles spawned from now on.
+     *
+     * @param params New emission parameters.
+     *
+     *************************************************************************************************/
+    void set_emitter(const ParticleEmitterParams& params);
+
+    /**************************************************************************************************
+     * @brief Returns current emission parameters.
+     *
+     * @return Emission parameters.
+     *
+     *************************************************************************************************/
+    const ParticleEmitterParams& get_emitter() const;
+
+    /**************************************************************************************************
+     * @brief Advances the simulation. Should be called each frame.
+     *
+     * @param delta_time Time passed in seconds since last frame.
+     *
+     *************************************************************************************************/
+    void update(double delta_time);
+
+    /**************************************************************************************************
+     * @brief Draws the particles.
+     *
+     *************************************************************************************************/
+    virtual void draw() override;
+
+    /**************************************************************************************************
+     * @brief Draws the particles with shader. Vertex attribute 0 is particle position (vec2) and
+     * attribute 2 is particle age and lifetime in seconds (vec2).
+     *
+     * @param shader Shader to be used.
+     *
+     *************************************************************************************************/
+    virtual void draw(const Shader shader) override;
+
+    /**************************************************************************************************
+     * @brief Returns the backend particles are simulated with.
+     *
+     * @return Particle backend.
+     *
+     *************************************************************************************************/
+    ParticleBackend get_backend() const;
+
+    /**************************************************************************************************
+     * @brief Returns number of particle slots.
+     *
+     * @return Number of particle slots.
+     *
+     *************************************************************************************************/
+    std::uint32_t get_max_particles() const;
+
+    /**************************************************************************************************
+     * @brief Reads positions of all particle slots back from the GPU, including slots whose
+     * particle is not yet born. Waits for the GPU to finish updating, so it is meant for tests and
+     * debugging, not for use every frame.
+     *
+     * @return Particle positions in pixels, one per slot.
+     *
+     *************************************************************************************************/
+    std::vector<Vector2f> get_positions() const;
+
+  private:
+    struct Particle
+    {
+        float position[2];
+        float velocity[2];
+        // Age and lifetime in seconds, negative age means particle is not yet born
+        float life[2];
+        float seed;
+    };
+
+    void init_particles();
+
+    void init_buffers();
+
+    void release_gl_resources();
+
+    void update_on_cpu(float delta_time);
+
+    void update_on_gpu(float delta_time);
+
+    void respawn_on_cpu(Particle& particle);
+
+    ParticleEmitterParams params_;
+    ParticleBackend       backend_;
+    std::uint32_t         max_particles_;
+    double                time_;
+    Shader                update_shader_;
+    Shader                render_shader_;
+    std::vector<Particle> particles_;
+
+    // Buffer that holds the latest particle state, the other one is written during the next update
+    std::uint32_t current_buffer_;
+
+    // OpenGl object id's
+    std::uint32_t vertex_array_objects_[2]{};
+    std::uint32_t vertex_buffer_objects_[2]{};
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_PARTICLE_SYSTEM_H
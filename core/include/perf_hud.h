@@ -0,0 +1,158 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_PERF_HUD_H
+#define CORE_INCLUDE_PERF_HUD_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/include/job_system.h"
+#include "core/include/shader.h"
+#include "util/include/color.h"
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Performance overlay showing frame time and GPU time graphs, frame time percentiles, frame
+ * stats and the most expensive profiling zones. Text uses a built-in bitmap font and everything
+ * is drawn with a single draw call. Samples are kept in fixed size rings, so the overlay doesn't
+ * allocate per frame.
+ *
+ * Application owns one and toggles it with F3, screens don't have to do anything. GPU times are
+ * only shown if RINVID_GPU_TIMING is defined, zones only if RINVID_PROFILING is. Overlay leaves
+ * itself out of what it shows: its drawing is not counted in frame stats nor GPU times, and zones
+ * are summed up on a worker thread.
+ *
+ *************************************************************************************************/
+class PerfHud
+{
+  public:
+    /// Number of frames shown in graphs and used for percentiles.
+    static constexpr std::uint32_t NUMBER_OF_SAMPLES{240U};
+
+    /// Number of profiling zones shown.
+    static constexpr std::uint32_t NUMBER_OF_ZONES{5U};
+
+    /**************************************************************************************************
+     * @brief Constructor. Creates OpenGL resources, so a context must be active.
+     *
+     *************************************************************************************************/
+    PerfHud();
+
+    PerfHud(const PerfHud& other) = delete;
+
+    PerfHud& operator=(const PerfHud& other) = delete;
+
+    PerfHud(PerfHud&& other) = delete;
+
+    PerfHud& operator=(PerfHud&& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Destructor. Releases OpenGL resources.
+     *
+     *************************************************************************************************/
+    ~PerfHud();
+
+    /**************************************************************************************************
+     * @brief Records a finished frame. Should be called once per frame, whether the overlay is
+     * visible or not.
+     *
+     * @param frame_time Duration of the frame in seconds
+     *
+     *************************************************************************************************/
+    void add_frame(double frame_time);
+
+    /**************************************************************************************************
+     * @brief Draws the overlay in the top left corner of the screen, if visible.
+     *
+     *************************************************************************************************/
+    void draw();
+
+    /**************************************************************************************************
+     * @brief Shows or hides the overlay.
+     *
+     * @param visible True to show, false to hide
+     *
+     *************************************************************************************************/
+    void set_visible(bool visible);
+
+    /**************************************************************************************************
+     * @brief Checks whether the overlay is visible.
+     *
+     * @return true if visible, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_visible() const;
+
+    /**************************************************************************************************
+     * @brief Returns a frame time percentile over the last NUMBER_OF_SAMPLES frames.
+     *
+     * @param percentile Percentile in 0 - 100 range
+     *
+     * @return Frame time in seconds, 0 if no frames were recorded yet
+     *
+     *************************************************************************************************/
+    double get_frame_time_percentile(double percentile) const;
+
+  private:
+    struct Vertex
+    {
+        float x;
+        float y;
+        float u;
+        float v;
+        float r;
+        float g;
+        float b;
+        float a;
+    };
+
+    void add_quad(float x, float y, float width, float height, const Color& color,
+                  std::uint32_t glyph);
+
+    float add_text(float x, float y, const char* text, const Color& color);
+
+    float add_graph(float x, float y, const std::array<float, NUMBER_OF_SAMPLES>& samples);
+
+    void update_zone_lines();
+
+    void build_vertices();
+
+    std::array<float, NUMBER_OF_SAMPLES> frame_times_;
+    std::array<float, NUMBER_OF_SAMPLES> gpu_times_;
+    // Scratch space for percentiles, so that computing them doesn't allocate
+    mutable std::array<float, NUMBER_OF_SAMPLES> sorted_frame_times_;
+    std::uint32_t                                next_sample_;
+    std::uint32_t                                number_of_samples_;
+    bool                                         visible_;
+
+    std::vector<std::string> zone_lines_;
+    // Written by the zone job, swapped into zone_lines_ once it is done
+    std::vector<std::string> pending_zone_lines_;
+    bool                     zone_lines_pending_;
+    JobCounter               zone_job_;
+    std::uint64_t            zone_period_start_;
+    std::uint32_t            zone_period_frames_;
+
+    std::vector<Vertex> vertices_;
+    Shader              shader_;
+
+    // OpenGl object id's
+    std::uint32_t vertex_array_object_;
+    std::uint32_t vertex_buffer_object_;
+    std::uint32_t font_texture_;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_PERF_HUD_H
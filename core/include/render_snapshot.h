@@ -0,0 +1,164 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_RENDER_SNAPSHOT_H
+#define CORE_INCLUDE_RENDER_SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "extern/glm/glm/mat4x4.hpp"
+#include "util/include/color.h"
+#include "util/include/vector2.h"
+
+namespace rinvid
+{
+
+class Light;
+class Sprite;
+class Text;
+class Texture;
+
+/**************************************************************************************************
+ * @brief Everything needed to draw a frame, copied out of simulation state. Simulation thread
+ * writes a snapshot and rendering thread draws it, so the two can run at the same time (see
+ * Application::set_simulation_thread).
+ *
+ * Sprites are copied whole, so simulation may keep changing them while the snapshot is drawn.
+ * Texts and lights make OpenGL calls or are read while drawing, so simulation keeps their state in
+ * its own variables and passes it here; the objects themselves are only touched when the snapshot
+ * is drawn. Memory of a snapshot is reused when it is cleared, so writing one doesn't allocate
+ * once it has seen a frame of the same size.
+ *
+ *************************************************************************************************/
+class RenderSnapshot
+{
+  public:
+    RenderSnapshot();
+
+    /**************************************************************************************************
+     * @brief Removes everything from the snapshot.
+     *
+     *************************************************************************************************/
+    void clear();
+
+    /**************************************************************************************************
+     * @brief Makes the snapshot clear the screen before drawing anything.
+     *
+     * @param color Color to clear the screen with
+     *
+     *************************************************************************************************/
+    void set_clear_color(Color color);
+
+    /**************************************************************************************************
+     * @brief Adds a sprite as it is now. Advances sprite's animation, the same way drawing it
+     * would.
+     *
+     * @param sprite Sprite to draw
+     * @param delta_time Time since the previous snapshot in seconds, used to advance animation
+     *
+     *************************************************************************************************/
+    void add(Sprite& sprite, double delta_time = 0.0);
+
+    /**************************************************************************************************
+     * @brief Adds a text.
+     *
+     * @param text Text to draw
+     * @param content What the text should say
+     * @param position Where to draw the text
+     * @param color Color of the text
+     *
+     *************************************************************************************************/
+    void add(Text& text, const std::string& content, Vector2f position, Color color);
+
+    /**************************************************************************************************
+     * @brief Adds a light. Lights are applied before anything is drawn, regardless of the order
+     * they were added in.
+     *
+     * @param light Light to update
+     * @param position Position of the light
+     * @param intensity Intensity in range [0.0, 1.0]
+     * @param camera_pos Position of the camera if there is any
+     *
+     *************************************************************************************************/
+    void add(Light& light, Vector2f position, float intensity,
+             Vector2f camera_pos = {0.0F, 0.0F});
+
+    /**************************************************************************************************
+     * @brief Returns the number of sprites and texts in the snapshot.
+     *
+     * @return Number of things to draw
+     *
+     *************************************************************************************************/
+    std::uint32_t get_draw_count() const;
+
+    /**************************************************************************************************
+     * @brief Draws the snapshot, in the order things were added. Must be called on the rendering
+     * thread.
+     *
+     *************************************************************************************************/
+    void draw() const;
+
+  private:
+    struct SpriteState
+    {
+        Texture*      texture;
+        glm::mat4     transform;
+        float         opacity;
+        bool          animated;
+        Vector2f      region_offset;
+        std::uint32_t region_width;
+        std::uint32_t region_height;
+    };
+
+    struct TextState
+    {
+        Text*       text;
+        std::string content;
+        Vector2f    position;
+        Color       color;
+    };
+
+    struct LightState
+    {
+        Light*   light;
+        Vector2f position;
+        float    intensity;
+        Vector2f camera_pos;
+    };
+
+    enum class Kind
+    {
+        Sprite,
+        Text
+    };
+
+    struct DrawEntry
+    {
+        Kind          kind;
+        std::uint32_t index;
+    };
+
+    // Vectors only grow, counts say how many elements are in use
+    std::vector<SpriteState> sprites_;
+    std::vector<TextState>   texts_;
+    std::vector<LightState>  lights_;
+    std::vector<DrawEntry>   draw_order_;
+    std::uint32_t            sprite_count_;
+    std::uint32_t            text_count_;
+    std::uint32_t            light_count_;
+    std::uint32_t            draw_count_;
+    Color                    clear_color_;
+    bool                     clears_screen_;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_RENDER_SNAPSHOT_H
@@ -0,0 +1,153 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_RESOURCE_MANAGER_H
+#define CORE_INCLUDE_RESOURCE_MANAGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Audio.hpp>
+
+#include "core/include/font.h"
+#include "core/include/texture.h"
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Approximate memory held by cached resources, per resource type.
+ *
+ *************************************************************************************************/
+struct ResourceMemoryUsage
+{
+    /// Texture pixel data in bytes (RGBA8, on the GPU).
+    std::size_t textures{0U};
+    /// Font files and glyph textures in bytes.
+    std::size_t fonts{0U};
+    /// Sound samples in bytes.
+    std::size_t sounds{0U};
+};
+
+/**************************************************************************************************
+ * @brief Caches textures, fonts and sound buffers by canonical file path, so that an asset used in
+ * many places is decoded and uploaded only once.
+ *
+ * Resources are handed out as shared handles. The cache holds a handle of its own, so a resource
+ * stays loaded after all users drop theirs, until purge_unused is called. Application purges
+ * unused resources on every screen switch, after the new screen has been created, which means
+ * assets shared between the two screens are not reloaded.
+ *
+ *************************************************************************************************/
+class ResourceManager
+{
+  public:
+    /**************************************************************************************************
+     * @brief Returns texture loaded from file, loading it if it is not cached yet.
+     *
+     * @param file_path Path to texture image file
+     * @param async If true, texture is loaded in the background (see Texture::load_async)
+     *
+     * @return Shared texture handle.
+     *
+     *************************************************************************************************/
+    std::shared_ptr<Texture> get_texture(const std::string& file_path, bool async = false);
+
+    /**************************************************************************************************
+     * @brief Returns font loaded from file, loading it if it is not cached yet. Throws FreeType
+     * error code if font could not be loaded.
+     *
+     * @param file_path Path to font file
+     *
+     * @return Shared font handle.
+     *
+     *************************************************************************************************/
+    std::shared_ptr<Font> get_font(const std::string& file_path);
+
+    /**************************************************************************************************
+     * @brief Returns sound buffer loaded from file, loading it if it is not cached yet. Throws if
+     * sound could not be loaded.
+     *
+     * @param file_path Path to sound file
+     *
+     * @return Shared sound buffer handle, to be played with sound::Sound.
+     *
+     *************************************************************************************************/
+    std::shared_ptr<const sf::SoundBuffer> get_sound_buffer(const std::string& file_path);
+
+    /**************************************************************************************************
+     * @brief Loads textures ahead of time, so that later get_texture calls are cache hits. Meant
+     * to be called from Screen::create.
+     *
+     * @param file_paths Paths to texture image files
+     * @param async If true, textures are loaded in the background
+     *
+     *************************************************************************************************/
+    void preload_textures(const std::vector<std::string>& file_paths, bool async = false);
+
+    /**************************************************************************************************
+     * @brief Loads fonts ahead of time.
+     *
+     * @param file_paths Paths to font files
+     *
+     *************************************************************************************************/
+    void preload_fonts(const std::vector<std::string>& file_paths);
+
+    /**************************************************************************************************
+     * @brief Loads sound buffers ahead of time.
+     *
+     * @param file_paths Paths to sound files
+     *
+     *************************************************************************************************/
+    void preload_sound_buffers(const std::vector<std::string>& file_paths);
+
+    /**************************************************************************************************
+     * @brief Releases cached resources which are not used anywhere outside of the cache.
+     *
+     * @return Number of released resources
+     *
+     *************************************************************************************************/
+    std::uint32_t purge_unused();
+
+    /**************************************************************************************************
+     * @brief Drops all cached handles. Resources still in use are released once their last user
+     * drops them.
+     *
+     *************************************************************************************************/
+    void clear();
+
+    /**************************************************************************************************
+     * @brief Returns approximate memory held by cached resources.
+     *
+     * @return Memory usage per resource type
+     *
+     *************************************************************************************************/
+    ResourceMemoryUsage get_memory_usage() const;
+
+    /**************************************************************************************************
+     * @brief Returns number of cached resources of all types.
+     *
+     * @return Number of cached resources
+     *
+     *************************************************************************************************/
+    std::uint32_t get_resource_count() const;
+
+  private:
+    std::unordered_map<std::string, std::shared_ptr<Texture>>         textures_;
+    std::unordered_map<std::string, std::shared_ptr<Font>>            fonts_;
+    std::unordered_map<std::string, std::shared_ptr<sf::SoundBuffer>> sound_buffers_;
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_RESOURCE_MANAGER_H
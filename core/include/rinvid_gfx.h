@@ -10,7 +10,9 @@
 #ifndef CORE_INCLUDE_RINFID_GFX_H
 #define CORE_INCLUDE_RINFID_GFX_H
 
+#include <cstddef>
 #include <cstdint>
+#include <iosfwd>
 #include <memory>
 
 #include "core/include/application.h"
@@ -21,6 +23,37 @@
 namespace rinvid
 {
 
+/**************************************************************************************************
+ * @brief Rendering work done by Rinvid during a frame.
+ *
+ *************************************************************************************************/
+struct FrameStats
+{
+    /// Number of draw calls.
+    std::uint32_t draw_calls{0U};
+    /// Number of triangles drawn (points and lines are not counted).
+    std::uint64_t triangles{0U};
+    /// Number of times a different shader program was put in use.
+    std::uint32_t program_switches{0U};
+    /// Number of texture binds.
+    std::uint32_t texture_binds{0U};
+    /// Bytes uploaded to buffer objects (vertex and pixel buffers).
+    std::uint64_t buffer_upload_bytes{0U};
+    /// Number of uniforms set.
+    std::uint32_t uniform_sets{0U};
+};
+
+/**************************************************************************************************
+ * @brief Writes frame stats in a single line, e.g. for logging.
+ *
+ * @param stream Stream to write to
+ * @param stats Frame stats to write
+ *
+ * @return Stream written to
+ *
+ *************************************************************************************************/
+std::ostream& operator<<(std::ostream& stream, const FrameStats& stats);
+
 /**************************************************************************************************
  * @brief A class that holds global objects and functions.
  *
@@ -214,6 +247,97 @@ class RinvidGfx
      *************************************************************************************************/
     static const Application* get_application();
 
+    /**************************************************************************************************
+     * @brief Returns rendering work done since frame stats were last reset, i.e. so far in the
+     * current frame.
+     *
+     * @return Frame stats of the current frame
+     *
+     *************************************************************************************************/
+    static const FrameStats& get_frame_stats();
+
+    /**************************************************************************************************
+     * @brief Returns rendering work done in the previous frame.
+     *
+     * @return Frame stats of the previous frame
+     *
+     *************************************************************************************************/
+    static const FrameStats& get_last_frame_stats();
+
+    /**************************************************************************************************
+     * @brief Ends counting for the current frame, it becomes the previous frame. Application calls
+     * this at the start of every frame.
+     *
+     *************************************************************************************************/
+    static void reset_frame_stats();
+
+    /**************************************************************************************************
+     * @brief Sets counts of the current frame back to ones taken earlier with get_frame_stats, so
+     * work done since then is not counted. Used by the performance overlay, so the numbers it shows
+     * don't include its own drawing.
+     *
+     * @param stats Frame stats taken earlier in the current frame
+     *
+     *************************************************************************************************/
+    static void restore_frame_stats(const FrameStats& stats);
+
+    /**************************************************************************************************
+     * @brief Counts a draw call. Intended for internal Rinvid use.
+     *
+     * @param triangles Number of triangles drawn
+     *
+     *************************************************************************************************/
+    static void count_draw_call(std::uint32_t triangles)
+    {
+        ++frame_stats_.draw_calls;
+        frame_stats_.triangles += triangles;
+    }
+
+    /**************************************************************************************************
+     * @brief Counts putting a shader program in use, which is a switch if it differs from the
+     * previously used one. Intended for internal Rinvid use.
+     *
+     * @param program_id OpenGL handle of the program
+     *
+     *************************************************************************************************/
+    static void count_program_use(std::uint32_t program_id)
+    {
+        if (program_id != current_program_id_)
+        {
+            ++frame_stats_.program_switches;
+            current_program_id_ = program_id;
+        }
+    }
+
+    /**************************************************************************************************
+     * @brief Counts a texture bind. Intended for internal Rinvid use.
+     *
+     *************************************************************************************************/
+    static void count_texture_bind()
+    {
+        ++frame_stats_.texture_binds;
+    }
+
+    /**************************************************************************************************
+     * @brief Counts an upload to a buffer object. Intended for internal Rinvid use.
+     *
+     * @param bytes Number of bytes uploaded
+     *
+     *************************************************************************************************/
+    static void count_buffer_upload(std::size_t bytes)
+    {
+        frame_stats_.buffer_upload_bytes += bytes;
+    }
+
+    /**************************************************************************************************
+     * @brief Counts setting a uniform. Intended for internal Rinvid use.
+     *
+     *************************************************************************************************/
+    static void count_uniform_set()
+    {
+        ++frame_stats_.uniform_sets;
+    }
+
   private:
     static void init_default_shaders();
 
@@ -226,6 +350,9 @@ class RinvidGfx
     static std::int32_t       width_;
     static std::int32_t       height_;
     static const Application* application_;
+    static FrameStats         frame_stats_;
+    static FrameStats         last_frame_stats_;
+    static std::uint32_t      current_program_id_;
 };
 
 } // namespace rinvid
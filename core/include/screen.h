@@ -10,6 +10,10 @@
 #ifndef CORE_INCLUDE_SCREEN_H
 #define CORE_INCLUDE_SCREEN_H
 
+#include <typeinfo>
+
+#include "core/include/render_snapshot.h"
+
 namespace rinvid
 {
 
@@ -43,6 +47,32 @@ class Screen
      *************************************************************************************************/
     virtual void destroy() = 0;
 
+    /**************************************************************************************************
+     * @brief Returns the name of the screen, used in frame time reports. Defaults to the name of
+     * its type as given by the compiler, override it to give the screen a readable name.
+     *
+     * @return Name of the screen
+     *
+     *************************************************************************************************/
+    virtual const char* get_name() const
+    {
+        return typeid(*this).name();
+    }
+
+  protected:
+    /**************************************************************************************************
+     * @brief Returns how far the current frame is between the last two fixed updates, as a fraction
+     * of the time step. Draw objects at their position interpolated by it (see
+     * SpriteObject::draw_interpolated) to move smoothly when frame rate and time step differ.
+     *
+     * @return Alpha in range [0, 1], 1 if application doesn't use a fixed time step
+     *
+     *************************************************************************************************/
+    double get_interpolation_alpha() const
+    {
+        return interpolation_alpha_;
+    }
+
   private:
     friend class Application;
     void set_application(Application* application)
@@ -50,9 +80,56 @@ class Screen
         application_ = application;
     }
 
+    /**************************************************************************************************
+     * @brief Called once per frame, after fixed updates of the frame (if any). Should draw the
+     * screen, and advance simulation too if application doesn't use a fixed time step. Not called
+     * when application runs simulation on its own thread, render is called instead.
+     *
+     * @param delta_time Duration of the previous frame in seconds
+     *
+     *************************************************************************************************/
     virtual void update(double delta_time) = 0;
 
+    /**************************************************************************************************
+     * @brief Called zero or more times per frame with a constant time step, if the application has
+     * one set (see Application::set_fixed_time_step). Should advance simulation (e.g. physics) and
+     * not draw anything. Called on the simulation thread if application has one.
+     *
+     * @param time_step Length of the step in seconds
+     *
+     *************************************************************************************************/
+    virtual void fixed_update(double /*time_step*/)
+    {
+    }
+
+    /**************************************************************************************************
+     * @brief Called on the simulation thread after the fixed updates of a step (see
+     * Application::set_simulation_thread). Should add everything there is to draw to the snapshot,
+     * which is empty when passed in. Must not make any OpenGL calls.
+     *
+     * @param snapshot Snapshot to fill
+     * @param delta_time Time since the previous snapshot in seconds
+     *
+     *************************************************************************************************/
+    virtual void write_snapshot(RenderSnapshot& /*snapshot*/, double /*delta_time*/)
+    {
+    }
+
+    /**************************************************************************************************
+     * @brief Called once per frame on the rendering thread instead of update, when application
+     * runs simulation on its own thread. Draws the latest snapshot by default, override it to draw
+     * something that isn't in snapshots as well.
+     *
+     * @param snapshot Latest snapshot written by the simulation thread
+     *
+     *************************************************************************************************/
+    virtual void render(const RenderSnapshot& snapshot)
+    {
+        snapshot.draw();
+    }
+
     Application* application_{nullptr};
+    double       interpolation_alpha_{1.0};
 };
 
 } // namespace rinvid
@@ -12,10 +12,31 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "core/include/rinvid_gl.h"
 #include "util/include/error_handler.h"
 
+/**************************************************************************************************
+ * @brief Sources of one shader program, see Shader::compile_batch.
+ *
+ *************************************************************************************************/
+struct ShaderSource
+{
+    /// Raw code of the vertex shader.
+    const char* vert_code{nullptr};
+    /// Raw code of the fragment shader, nullptr for transform feedback only programs.
+    const char* frag_code{nullptr};
+    /// Names of vertex shader outputs captured with transform feedback, if any.
+    std::vector<std::string> feedback_varyings{};
+};
+
+/**************************************************************************************************
+ * @brief Shader program. Compiling and linking is only submitted to the driver on construction,
+ * link status is checked (and failures are logged) when the program is first used, so that the
+ * driver can do the work in the background where GL_KHR_parallel_shader_compile is supported.
+ *
+ *************************************************************************************************/
 class Shader
 {
   public:
@@ -36,6 +57,20 @@ class Shader
      *************************************************************************************************/
     Shader(const char* vert_code, const char* frag_code);
 
+    /**************************************************************************************************
+     * @brief Shader constructor for programs whose vertex shader outputs are captured with
+     * transform feedback.
+     *
+     * @param vert_code Raw code of the vertex shader.
+     * @param frag_code Raw code of the fragment shader. Pass nullptr for programs that are only
+     * used with rasterization disabled.
+     * @param feedback_varyings Names of vertex shader outputs to capture, in the order they are
+     * written (interleaved) to the transform feedback buffer.
+     *
+     *************************************************************************************************/
+    Shader(const char* vert_code, const char* frag_code,
+           const std::vector<std::string>& feedback_varyings);
+
     ~Shader() = default;
 
     Shader(const Shader& other) = default;
@@ -47,11 +82,33 @@ class Shader
     Shader& operator=(Shader&& other) = default;
 
     /**************************************************************************************************
-     * @brief Use this shader program.
+     * @brief Creates multiple shader programs. All of them are submitted for compilation before any
+     * is linked, and no status is queried in between, which lets drivers supporting
+     * GL_KHR_parallel_shader_compile build them concurrently.
+     *
+     * @param sources Sources of programs to create.
+     *
+     * @return Shader programs, in the same order as sources.
+     *
+     *************************************************************************************************/
+    static std::vector<Shader> compile_batch(const std::vector<ShaderSource>& sources);
+
+    /**************************************************************************************************
+     * @brief Use this shader program. On first use waits for linking to finish and logs an error if
+     * compiling or linking failed.
      *
      *************************************************************************************************/
     void use() const;
 
+    /**************************************************************************************************
+     * @brief Checks whether the driver has finished compiling and linking this program, i.e.
+     * whether first use() will not stall. Always true without GL_KHR_parallel_shader_compile.
+     *
+     * @return true if program is ready, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_ready() const;
+
     /**************************************************************************************************
      * @brief Sets bool uniform.
      *
@@ -104,10 +161,46 @@ class Shader
 
     std::uint32_t get_id() const;
 
+    /**************************************************************************************************
+     * @brief Checks whether this program has been loaded from the program binary cache instead of
+     * being compiled from source.
+     *
+     * @return true if loaded from cache, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_loaded_from_cache() const;
+
+    /**************************************************************************************************
+     * @brief Enables caching of linked program binaries on disk. Binaries are keyed by a hash of
+     * shader sources and the driver (vendor, renderer and version strings), later runs load them
+     * instead of compiling. Binaries rejected by the driver (e.g. after a driver update) are
+     * recompiled and replaced. A compiled binary is saved when the program is first used. Should be
+     * called before creating any shaders, including the default ones created by RinvidGfx::init
+     * (i.e. before constructing Application).
+     *
+     * @param directory Directory to store binaries in, created if it doesn't exist. Pass an empty
+     * string to disable caching (default).
+     *
+     *************************************************************************************************/
+    static void set_cache_directory(const std::string& directory);
+
   private:
     struct ProgramHandle;
 
+    bool submit_compile(const char* vert_code, const char* frag_code,
+                        const std::vector<std::string>& feedback_varyings);
+
+    void submit_link(const std::vector<std::string>& feedback_varyings);
+
+    void check_link_status() const;
+
+    bool load_from_cache(const std::string& cache_file);
+
+    void save_to_cache(const std::string& cache_file) const;
+
     std::shared_ptr<ProgramHandle> program_handle_;
+
+    static std::string cache_directory_;
 };
 
 #endif // CORE_INCLUDE_SHADER_H
@@ -147,6 +147,23 @@ class Sprite : public virtual RectPOD, public Transformable, public DrawableAnim
     SpriteAnimation sprite_animation_;
 
   private:
+    friend class RenderSnapshot;
+
+    /**************************************************************************************************
+     * @brief Moves origin to the center of the sprite and advances animation, getting the sprite
+     * ready to be drawn.
+     *
+     * @param delta_time Time since the sprite was last drawn in seconds
+     * @param offset Set to top left corner of texture region of the current animation frame
+     * @param width Set to width of texture region of the current animation frame
+     * @param height Set to height of texture region of the current animation frame
+     *
+     * @return true if sprite is animated and region was set, false otherwise
+     *
+     *************************************************************************************************/
+    bool prepare_draw(double delta_time, Vector2f& offset, std::uint32_t& width,
+                      std::uint32_t& height);
+
     Texture* texture_;
     Vector2f texture_offset_;
     float    opacity_;
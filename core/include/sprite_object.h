@@ -54,6 +54,16 @@ class SpriteObject : public Sprite, public Object
      *
      *************************************************************************************************/
     Rect bounding_rect() override;
+
+    /**************************************************************************************************
+     * @brief Draws the sprite at its position interpolated between the last two updates, leaving
+     * the simulated position as it is.
+     *
+     * @param alpha Interpolation alpha (see Object::get_interpolated_position)
+     * @param delta_time Time passed since the last draw, advances animation
+     *
+     *************************************************************************************************/
+    void draw_interpolated(float alpha, double delta_time = 0.0);
 };
 
 } // namespace rinvid
@@ -10,15 +10,11 @@
 #ifndef CORE_INCLUDE_TEXT_H
 #define CORE_INCLUDE_TEXT_H
 
+#include <memory>
 #include <string>
-#include <unordered_map>
-
-#include <ft2build.h>
-#include FT_FREETYPE_H
-
-#include "extern/glm/glm/glm.hpp"
 
 #include "core/include/drawable.h"
+#include "core/include/font.h"
 #include "util/include/color.h"
 #include "util/include/vector2.h"
 
@@ -41,6 +37,20 @@ class Text : public Drawable
     Text(std::string text, const std::string& font_path, Vector2f position, Color color,
          std::uint32_t size);
 
+    /**************************************************************************************************
+     * @brief Constructor. Uses an already loaded font, which can be shared with other texts (see
+     * ResourceManager).
+     *
+     * @param text The contents.
+     * @param font Font to render text with.
+     * @param position Position where to draw the text.
+     * @param color Color of the text.
+     * @param size Font size.
+     *
+     *************************************************************************************************/
+    Text(std::string text, std::shared_ptr<Font> font, Vector2f position, Color color,
+         std::uint32_t size);
+
     Text(const Text& other) = delete;
 
     Text& operator=(const Text& other) = delete;
@@ -50,7 +60,7 @@ class Text : public Drawable
     Text& operator=(Text&& other) = delete;
 
     /**************************************************************************************************
-     * @brief Destructor. Releases font related resources.
+     * @brief Destructor. Releases vertex buffer, glyphs stay with the font.
      *
      *************************************************************************************************/
     ~Text();
@@ -118,34 +128,19 @@ class Text : public Drawable
     void set_max_width(float max_width);
 
   private:
-    struct Character
-    {
-        std::uint32_t texture_id;
-        glm::ivec2    size;
-        glm::ivec2    bearing;
-        std::uint32_t advance;
-    };
-
-    /**************************************************************************************************
-     * @brief Generates and prepares textures of characters for rendering.
-     *
-     *************************************************************************************************/
-    void generate_character_textures();
-
-    void release_character_textures();
+    void create_vertex_buffer();
 
     void release_vertex_buffer();
 
-    FT_Face       ft_face_{nullptr};
-    std::uint32_t vertex_array_object_{};
-    std::uint32_t vertex_buffer_object_{};
-    std::uint32_t size_{};
-    std::string   text_;
-    Vector2f      position_;
-    Color         color_;
-    float         max_width_;
-
-    std::unordered_map<char, Character> characters_;
+    std::shared_ptr<Font> font_;
+    std::uint32_t         vertex_array_object_{};
+    std::uint32_t         vertex_buffer_object_{};
+    std::uint32_t         size_{};
+    std::string           text_;
+    Vector2f              position_;
+    Color                 color_;
+    float                 max_width_;
+    const Font::Glyphs*   glyphs_;
 };
 
 } // namespace rinvid
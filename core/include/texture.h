@@ -11,6 +11,7 @@
 #define CORE_INCLUDE_TEXTURE_H
 
 #include <cstdint>
+#include <memory>
 
 #include "core/include/rinvid_gfx.h"
 #include "extern/glm/glm/mat4x4.hpp"
@@ -20,16 +21,47 @@
 namespace rinvid
 {
 
+/**************************************************************************************************
+ * @brief Texture sampling filter.
+ *
+ *************************************************************************************************/
+enum class TextureFilter
+{
+    /// Sharp, blocky look. Suitable for pixel art.
+    Nearest = 0U,
+    /// Smooth look.
+    Linear
+};
+
 class Texture
 {
   public:
     /**************************************************************************************************
-     * @brief Texture constructor.
+     * @brief Texture constructor. Files with .rtex extension are treated as cooked textures (see
+     * tools/texture_cook), which are memory mapped and uploaded without decoding.
+     *
+     * @param file_name Path to texture image file
+     * @param generate_mipmaps Whether to generate mip levels, which makes sprites drawn scaled down
+     * look smoother and draw faster. Costs a third more memory.
+     *
+     *************************************************************************************************/
+    Texture(const char* file_name, bool generate_mipmaps = false);
+
+    /**************************************************************************************************
+     * @brief Starts loading a texture in the background. Image is decoded on a worker thread and
+     * uploaded on the rendering thread at a frame boundary (see TextureLoader::process_uploads).
+     * Until then, the texture can be used for drawing and shows a transparent placeholder. Cooked
+     * textures need no decoding and are loaded right away.
      *
      * @param file_name Path to texture image file
+     * @param generate_mipmaps Whether to generate mip levels once image is uploaded
+     *
+     * @return Handle to the texture. Dropping the last handle before loading finishes cancels the
+     * upload.
      *
      *************************************************************************************************/
-    Texture(const char* file_name);
+    static std::shared_ptr<Texture> load_async(const char* file_name,
+                                               bool        generate_mipmaps = false);
 
     /**************************************************************************************************
      * @brief Copy constructor deleted.
@@ -63,16 +95,105 @@ class Texture
      * @brief Destructor.
      *
      *************************************************************************************************/
-    ~Texture();
+    virtual ~Texture();
+
+    /**************************************************************************************************
+     * @brief Checks whether image data has been uploaded.
+     *
+     * @return False if texture is still showing a placeholder (or loading failed), true otherwise.
+     *
+     *************************************************************************************************/
+    bool is_loaded() const;
+
+    /**************************************************************************************************
+     * @brief Returns texture width in pixels.
+     *
+     * @return Width.
+     *
+     *************************************************************************************************/
+    std::int32_t get_width() const;
+
+    /**************************************************************************************************
+     * @brief Returns texture height in pixels.
+     *
+     * @return Height.
+     *
+     *************************************************************************************************/
+    std::int32_t get_height() const;
+
+    /**************************************************************************************************
+     * @brief Checks whether color channels of this texture are premultiplied by alpha, which is
+     * the case for cooked textures.
+     *
+     * @return true if alpha is premultiplied, false otherwise
+     *
+     *************************************************************************************************/
+    bool has_premultiplied_alpha() const;
+
+    /**************************************************************************************************
+     * @brief Generates mip levels from current texture contents. Contents uploaded later get their
+     * mip levels regenerated automatically.
+     *
+     *************************************************************************************************/
+    void generate_mipmaps();
+
+    /**************************************************************************************************
+     * @brief Checks whether texture has mip levels.
+     *
+     * @return true if texture has mip levels, false otherwise
+     *
+     *************************************************************************************************/
+    bool has_mipmaps() const;
+
+    /**************************************************************************************************
+     * @brief Sets sampling filters. Default is linear filtering everywhere.
+     *
+     * @param min_filter Filter used when texture is drawn scaled down
+     * @param mag_filter Filter used when texture is drawn scaled up
+     * @param mipmap_filter Filter used between mip levels, ignored if texture has no mip levels
+     *
+     *************************************************************************************************/
+    void set_filter(TextureFilter min_filter, TextureFilter mag_filter,
+                    TextureFilter mipmap_filter = TextureFilter::Linear);
 
   private:
+    friend class DynamicTexture;
+    friend class RenderSnapshot;
     friend class Sprite;
+    friend class TextureLoader;
+
+    /**************************************************************************************************
+     * @brief Creates a texture holding a placeholder until image data is uploaded.
+     *
+     *************************************************************************************************/
+    Texture();
+
+    /**************************************************************************************************
+     * @brief Creates a fully transparent texture of given size.
+     *
+     *************************************************************************************************/
+    Texture(std::int32_t width, std::int32_t height);
+
+    void init_vertex_buffer();
+
+    void init_texture(const std::uint8_t* image_data, std::int32_t width, std::int32_t height);
+
+    bool init_cooked_texture(const char* file_name);
+
+    void apply_filters();
+
+    /**************************************************************************************************
+     * @brief Replaces texture contents with a decoded image. Internal function called by
+     * TextureLoader on the rendering thread.
+     *
+     *************************************************************************************************/
+    void upload_image(const std::uint8_t* image_data, std::int32_t width, std::int32_t height);
 
     void release_gl_resources();
 
     /**************************************************************************************************
-     * @brief Internal function called by sprite. Draws part of texture specified by sprite calling
-     * it.
+     * @brief Internal function called by sprite and render snapshot. Draws part of texture
+     * specified by sprite calling it.
      *
      * @param transform Transformation to apply (model matrix)
      * @param shader Shader to be used.
@@ -90,6 +211,18 @@ class Texture
 
     std::int32_t width_{};
     std::int32_t height_{};
+    bool         loaded_{false};
+    bool         premultiplied_alpha_{false};
+    bool         mipmaps_{false};
+
+    TextureFilter min_filter_{TextureFilter::Linear};
+    TextureFilter mag_filter_{TextureFilter::Linear};
+    TextureFilter mipmap_filter_{TextureFilter::Linear};
+
+    // Region last passed to update_vertices, needed to recompute vertices when image size changes
+    Vector2f      region_offset_{};
+    std::uint32_t region_width_{};
+    std::uint32_t region_height_{};
 
     // OpenGl object id's
     std::uint32_t vertex_array_object_{};
@@ -0,0 +1,71 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef CORE_INCLUDE_TEXTURE_LOADER_H
+#define CORE_INCLUDE_TEXTURE_LOADER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "core/include/texture.h"
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Loads textures in the background. File reading and image decoding are jobs run on
+ * JobSystem workers, while OpenGL uploads are done on the rendering thread, a bounded number per
+ * frame, so that loading never stalls a frame.
+ *
+ * All functions and members are static. Application pumps uploads once per frame, applications
+ * not using Application should call process_uploads themselves.
+ *
+ *************************************************************************************************/
+class TextureLoader
+{
+  public:
+    /**************************************************************************************************
+     * @brief Queues an image for decoding.
+     *
+     * @param texture Texture which receives decoded image once uploaded
+     * @param file_name Path to texture image file
+     *
+     *************************************************************************************************/
+    static void load(std::weak_ptr<Texture> texture, const std::string& file_name);
+
+    /**************************************************************************************************
+     * @brief Uploads decoded images to their textures. Must be called from the thread owning the
+     * OpenGL context.
+     *
+     * @param max_uploads Maximum number of textures to upload during this call
+     *
+     * @return Number of textures uploaded
+     *
+     *************************************************************************************************/
+    static std::uint32_t process_uploads(std::uint32_t max_uploads = 4U);
+
+    /**************************************************************************************************
+     * @brief Returns number of textures which are queued, being decoded or waiting for upload.
+     *
+     * @return Number of pending textures
+     *
+     *************************************************************************************************/
+    static std::uint32_t get_pending_count();
+
+    /**************************************************************************************************
+     * @brief Drops all pending loads. Images still being decoded are thrown away once decoded.
+     *
+     *************************************************************************************************/
+    static void shutdown();
+};
+
+} // namespace rinvid
+
+#endif // CORE_INCLUDE_TEXTURE_LOADER_H
@@ -0,0 +1,372 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <thread>
+
+#include "include/job_system.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+struct QueuedJob
+{
+    Job         job;
+    JobCounter* counter;
+};
+
+struct WorkerQueue
+{
+    std::deque<QueuedJob> jobs;
+    std::mutex            mutex;
+};
+
+std::vector<std::thread>                  workers{};
+std::vector<std::unique_ptr<WorkerQueue>> worker_queues{};
+std::deque<QueuedJob>                     main_thread_jobs{};
+std::mutex                                main_thread_mutex{};
+// Guards starting and stopping workers
+std::mutex                                workers_mutex{};
+std::atomic<bool>                         started{false};
+// Sleeping workers wait on job_available until a job is queued
+std::mutex                                sleep_mutex{};
+std::condition_variable                   job_available{};
+std::atomic<std::uint32_t>                queued_jobs{0U};
+std::atomic<std::uint32_t>                next_queue{0U};
+bool                                      stopping{false};
+
+// Index of the worker running on this thread, -1 on threads which are not workers
+thread_local std::int32_t current_worker{-1};
+
+// Stops workers still running at exit. Defined after the rest of the state, so it is destroyed
+// before anything workers use.
+struct WorkerStopper
+{
+    ~WorkerStopper()
+    {
+        JobSystem::shutdown();
+    }
+} worker_stopper{};
+
+bool take_job(std::int32_t worker_index, QueuedJob& job)
+{
+    const auto queue_count = static_cast<std::int32_t>(worker_queues.size());
+
+    // Newest job of its own queue is the most likely one to still be in cache
+    if (worker_index >= 0)
+    {
+        auto&                       queue = *worker_queues[worker_index];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!queue.jobs.empty())
+        {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            return true;
+        }
+    }
+
+    // Oldest jobs of other queues are stolen, they tend to be the biggest ones
+    for (std::int32_t offset{1}; offset <= queue_count; ++offset)
+    {
+        const std::int32_t          index = (worker_index + offset + queue_count) % queue_count;
+        auto&                       queue = *worker_queues[index];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!queue.jobs.empty())
+        {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
+
+JobCounter::JobCounter() : pending_{0U}, continuations_{}, mutex_{}
+{
+}
+
+bool JobCounter::is_done() const
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    return pending_ == 0U;
+}
+
+void JobSystem::run(Job job, JobCounter* counter)
+{
+    count(counter);
+    queue(std::move(job), counter, false);
+}
+
+void JobSystem::run_after(JobCounter& dependency, Job job, JobCounter* counter)
+{
+    count(counter);
+    queue_after(dependency, std::move(job), counter, false);
+}
+
+void JobSystem::run_on_main_thread(Job job, JobCounter* counter)
+{
+    count(counter);
+    queue(std::move(job), counter, true);
+}
+
+void JobSystem::run_on_main_thread_after(JobCounter& dependency, Job job, JobCounter* counter)
+{
+    count(counter);
+    queue_after(dependency, std::move(job), counter, true);
+}
+
+void JobSystem::wait(JobCounter& counter)
+{
+    RINVID_PROFILE_ZONE("JobSystem::wait");
+
+    start_workers();
+
+    while (!counter.is_done())
+    {
+        if (!run_queued_job(current_worker))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::parallel_for(std::uint32_t count, std::uint32_t batch_size,
+                             const std::function<void(std::uint32_t, std::uint32_t)>& body)
+{
+    batch_size = std::max(batch_size, 1U);
+
+    if (count <= batch_size)
+    {
+        body(0U, count);
+        return;
+    }
+
+    JobCounter counter{};
+    for (std::uint32_t begin{batch_size}; begin < count; begin += batch_size)
+    {
+        const std::uint32_t end = std::min(begin + batch_size, count);
+        run([&body, begin, end]() { body(begin, end); }, &counter);
+    }
+
+    body(0U, batch_size);
+    wait(counter);
+}
+
+std::uint32_t JobSystem::process_main_thread_jobs()
+{
+    RINVID_PROFILE_ZONE("JobSystem::process_main_thread_jobs");
+
+    // Jobs queued by these jobs are left for the next call, so a job requeueing itself can't keep
+    // the frame from ending
+    std::deque<QueuedJob> jobs{};
+    {
+        std::lock_guard<std::mutex> lock{main_thread_mutex};
+        jobs.swap(main_thread_jobs);
+    }
+
+    for (auto& job : jobs)
+    {
+        job.job();
+        finish(job.counter);
+    }
+
+    return static_cast<std::uint32_t>(jobs.size());
+}
+
+std::uint32_t JobSystem::get_worker_count()
+{
+    start_workers();
+
+    return static_cast<std::uint32_t>(workers.size());
+}
+
+void JobSystem::shutdown()
+{
+    std::lock_guard<std::mutex> workers_lock{workers_mutex};
+    if (!started)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex};
+        stopping = true;
+    }
+    job_available.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    workers.clear();
+    worker_queues.clear();
+    stopping = false;
+    started  = false;
+
+    std::lock_guard<std::mutex> lock{main_thread_mutex};
+    main_thread_jobs.clear();
+}
+
+void JobSystem::start_workers()
+{
+    if (started.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{workers_mutex};
+    if (started.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // Leave one core to the rendering thread
+    const std::uint32_t hardware_threads = std::thread::hardware_concurrency();
+    const std::uint32_t worker_count     = (hardware_threads > 2U) ? hardware_threads - 1U : 1U;
+
+    for (std::uint32_t i{0U}; i < worker_count; ++i)
+    {
+        worker_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (std::uint32_t i{0U}; i < worker_count; ++i)
+    {
+        workers.emplace_back(work, static_cast<std::int32_t>(i));
+    }
+
+    started.store(true, std::memory_order_release);
+}
+
+void JobSystem::work(std::int32_t worker_index)
+{
+    current_worker = worker_index;
+
+    while (true)
+    {
+        if (run_queued_job(worker_index))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{sleep_mutex};
+        job_available.wait(lock, [] { return stopping || (queued_jobs > 0U); });
+
+        // Remaining jobs are run before stopping, as someone may be waiting on them
+        if (stopping && (queued_jobs == 0U))
+        {
+            return;
+        }
+    }
+}
+
+bool JobSystem::run_queued_job(std::int32_t worker_index)
+{
+    QueuedJob job{};
+    if (!take_job(worker_index, job))
+    {
+        return false;
+    }
+
+    --queued_jobs;
+    job.job();
+    finish(job.counter);
+
+    return true;
+}
+
+void JobSystem::count(JobCounter* counter)
+{
+    if (counter != nullptr)
+    {
+        std::lock_guard<std::mutex> lock{counter->mutex_};
+        ++counter->pending_;
+    }
+}
+
+void JobSystem::queue(Job job, JobCounter* counter, bool on_main_thread)
+{
+    if (on_main_thread)
+    {
+        std::lock_guard<std::mutex> lock{main_thread_mutex};
+        main_thread_jobs.push_back(QueuedJob{std::move(job), counter});
+        return;
+    }
+
+    start_workers();
+
+    // Workers queue jobs into their own queue, other threads spread them over all queues
+    const std::int32_t queue_index =
+        (current_worker >= 0) ? current_worker
+                              : static_cast<std::int32_t>(next_queue++ % worker_queues.size());
+    // Counted before it is queued, so a worker taking it right away never sees the count wrap
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex};
+        ++queued_jobs;
+    }
+
+    {
+        auto&                       queue = *worker_queues[queue_index];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        queue.jobs.push_back(QueuedJob{std::move(job), counter});
+    }
+    job_available.notify_one();
+}
+
+void JobSystem::queue_after(JobCounter& dependency, Job job, JobCounter* counter,
+                            bool on_main_thread)
+{
+    {
+        std::lock_guard<std::mutex> lock{dependency.mutex_};
+        if (dependency.pending_ > 0U)
+        {
+            dependency.continuations_.push_back(
+                JobCounter::Continuation{std::move(job), counter, on_main_thread});
+            return;
+        }
+    }
+
+    queue(std::move(job), counter, on_main_thread);
+}
+
+void JobSystem::finish(JobCounter* counter)
+{
+    if (counter == nullptr)
+    {
+        return;
+    }
+
+    std::vector<JobCounter::Continuation> continuations{};
+    {
+        std::lock_guard<std::mutex> lock{counter->mutex_};
+        --counter->pending_;
+        if (counter->pending_ == 0U)
+        {
+            continuations.swap(counter->continuations_);
+        }
+    }
+
+    for (auto& continuation : continuations)
+    {
+        queue(std::move(continuation.job), continuation.counter, continuation.on_main_thread);
+    }
+}
+
+} // namespace rinvid
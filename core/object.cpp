@@ -8,6 +8,7 @@
  **********************************************************************/
 
 #include "include/object.h"
+#include "include/body_store.h"
 #include "platformers/include/world.h"
 
 namespace rinvid
@@ -17,7 +18,7 @@ Object::Object(bool kinematic)
     : previous_position_{0.0F, 0.0F}, velocity_{0.0F, 0.0F}, acceleration_{0.0F, 0.0F},
       drag_{800.0F, 0.0F}, max_velocity_{0.0F}, gravity_scale_{1.0F}, active_{true},
       collides_{true}, kinematic_{kinematic}, movable_{YES}, touching_{NONE},
-      allowed_collisions_{ANY}
+      allowed_collisions_{ANY}, body_store_{nullptr}, body_{}
 {
     if (kinematic)
     {
@@ -25,8 +26,68 @@ Object::Object(bool kinematic)
     }
 }
 
+Object::Object(const Object& other) : RectPOD(other), body_store_{nullptr}, body_{}
+{
+    copy_motion(other);
+}
+
+Object& Object::operator=(const Object& other)
+{
+    if (this != &other)
+    {
+        RectPOD::operator=(other);
+        copy_motion(other);
+        update_body();
+    }
+
+    return *this;
+}
+
+Object::Object(Object&& other) noexcept
+    : RectPOD(other), body_store_{other.body_store_}, body_{other.body_}
+{
+    copy_motion(other);
+
+    if (body_store_ != nullptr)
+    {
+        body_store_->owners_[body_store_->dense(body_)] = this;
+        other.body_store_                                = nullptr;
+    }
+}
+
+Object& Object::operator=(Object&& other) noexcept
+{
+    if (this != &other)
+    {
+        detach_body();
+        RectPOD::operator=(other);
+        copy_motion(other);
+
+        body_store_ = other.body_store_;
+        body_       = other.body_;
+        if (body_store_ != nullptr)
+        {
+            body_store_->owners_[body_store_->dense(body_)] = this;
+            other.body_store_                                = nullptr;
+        }
+    }
+
+    return *this;
+}
+
+Object::~Object()
+{
+    detach_body();
+}
+
 void Object::update(double delta_time)
 {
+    // Attached objects are moved by World::integrate
+    if (body_store_ != nullptr)
+    {
+        return;
+    }
+
     if (active_)
     {
         touching_            = NONE;
@@ -40,6 +101,65 @@ void Object::update(double delta_time)
     }
 }
 
+void Object::attach_body(BodyStore& store)
+{
+    detach_body();
+
+    body_       = store.create(position_);
+    body_store_ = &store;
+
+    store.owners_[store.dense(body_)] = this;
+    store.set_velocity(body_, velocity_);
+    update_body();
+}
+
+void Object::detach_body()
+{
+    // Destroying the body detaches the object
+    if (body_store_ != nullptr)
+    {
+        body_store_->destroy(body_);
+    }
+}
+
+bool Object::is_body_attached() const
+{
+    return body_store_ != nullptr;
+}
+
+void Object::copy_motion(const Object& other)
+{
+    previous_position_  = other.previous_position_;
+    velocity_           = other.velocity_;
+    acceleration_       = other.acceleration_;
+    drag_               = other.drag_;
+    max_velocity_       = other.max_velocity_;
+    gravity_scale_      = other.gravity_scale_;
+    active_             = other.active_;
+    collides_           = other.collides_;
+    kinematic_          = other.kinematic_;
+    movable_            = other.movable_;
+    touching_           = other.touching_;
+    allowed_collisions_ = other.allowed_collisions_;
+}
+
+void Object::update_body()
+{
+    // Position and velocity are written by World::integrate before each step, as World changes
+    // them directly when separating objects
+    if (body_store_ == nullptr)
+    {
+        return;
+    }
+
+    body_store_->set_acceleration(body_, acceleration_);
+    body_store_->set_drag(body_, drag_);
+    body_store_->set_max_velocity(body_, max_velocity_);
+    body_store_->set_gravity_scale(body_, gravity_scale_);
+    body_store_->set_movable(body_, movable_);
+    body_store_->set_active(body_, active_);
+}
+
 void Object::update_motion(double delta_time)
 {
     float delta;
@@ -125,6 +245,12 @@ Vector2f Object::get_position()
     return position_;
 }
 
+Vector2f Object::get_interpolated_position(float alpha)
+{
+    return Vector2f{previous_position_.x + (position_.x - previous_position_.x) * alpha,
+                    previous_position_.y + (position_.y - previous_position_.y) * alpha};
+}
+
 void Object::set_x_velocity(float velocity)
 {
     velocity_.x = velocity;
@@ -148,6 +274,7 @@ float Object::get_y_velocity()
 void Object::set_acceleration(Vector2f acceleration)
 {
     acceleration_ = acceleration;
+    update_body();
 }
 
 Vector2f Object::get_acceleration()
@@ -158,6 +285,7 @@ Vector2f Object::get_acceleration()
 void Object::set_max_velocity(float max_velocity)
 {
     max_velocity_ = max_velocity;
+    update_body();
 }
 
 float Object::get_max_velocity()
@@ -171,6 +299,8 @@ void Object::set_gravity_scale(float gravity_scale)
     {
         gravity_scale_ = gravity_scale;
     }
+
+    update_body();
 }
 
 float Object::get_gravity_scale()
@@ -181,6 +311,7 @@ float Object::get_gravity_scale()
 void Object::set_drag(Vector2f drag)
 {
     drag_ = drag;
+    update_body();
 }
 
 Vector2f Object::get_drag()
@@ -191,6 +322,7 @@ Vector2f Object::get_drag()
 void Object::set_movable(std::uint8_t movable)
 {
     movable_ = movable;
+    update_body();
 }
 
 bool Object::is_movable(std::uint8_t axes)
@@ -207,6 +339,7 @@ void Object::set_kinematic(bool kinematic)
 {
     kinematic_     = kinematic;
     gravity_scale_ = 0.0F;
+    update_body();
 }
 
 bool Object::is_touching(std::uint8_t direction)
@@ -238,6 +371,7 @@ Rect Object::bounding_rect()
 void Object::kill()
 {
     active_ = false;
+    update_body();
 }
 
 } // namespace rinvid
@@ -0,0 +1,395 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cmath>
+#include <cstddef>
+
+#include "core/include/gpu_timer.h"
+#include "core/include/job_system.h"
+#include "core/include/particle_system.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/rinvid_gl.h"
+#include "extern/glm/glm/mat4x4.hpp"
+#include "util/include/error_handler.h"
+
+namespace rinvid
+{
+
+// Simulation time is wrapped to keep enough float precision in the shader random function
+constexpr double PARTICLE_TIME_WRAP{1000.0};
+
+// Number of particles updated by one job on CPU backend, systems up to this size use no jobs
+constexpr std::uint32_t PARTICLES_PER_JOB{8192U};
+
+// Both backends use the same hash based random function so they spawn particles alike
+const char* particle_update_vert =
+    "#version 330 core\n\
+    layout(location = 0) in vec2 in_position;\n\
+    layout(location = 1) in vec2 in_velocity;\n\
+    layout(location = 2) in vec2 in_life;\n\
+    layout(location = 3) in float in_seed;\n\
+    out vec2 out_position;\n\
+    out vec2 out_velocity;\n\
+    out vec2 out_life;\n\
+    out float out_seed;\n\
+    uniform float delta_time;\n\
+    uniform float time;\n\
+    uniform vec2 emitter_position;\n\
+    uniform vec2 spawn_area;\n\
+    uniform vec2 min_velocity;\n\
+    uniform vec2 max_velocity;\n\
+    uniform vec2 acceleration;\n\
+    uniform vec2 lifetime_range;\n\
+    float random(float n)\n\
+    {\n\
+        return fract(sin(n) * 43758.5453);\n\
+    }\n\
+    void main()\n\
+    {\n\
+        float age = in_life.x + delta_time;\n\
+        if (age >= in_life.y)\n\
+        {\n\
+            float seed = random(in_seed + time);\n\
+            vec2 spawn_offset = vec2(random(seed + 1.0), random(seed + 2.0)) * 2.0 - 1.0;\n\
+            vec2 velocity_mix = vec2(random(seed + 3.0), random(seed + 4.0));\n\
+            out_position = emitter_position + spawn_offset * spawn_area;\n\
+            out_velocity = mix(min_velocity, max_velocity, velocity_mix);\n\
+            out_life = vec2(0.0, mix(lifetime_range.x, lifetime_range.y, random(seed + 5.0)));\n\
+            out_seed = seed;\n\
+        }\n\
+        else if (age < 0.0)\n\
+        {\n\
+            out_position = in_position;\n\
+            out_velocity = in_velocity;\n\
+            out_life = vec2(age, in_life.y);\n\
+            out_seed = in_seed;\n\
+        }\n\
+        else\n\
+        {\n\
+            out_velocity = in_velocity + acceleration * delta_time;\n\
+            out_position = in_position + out_velocity * delta_time;\n\
+            out_life = vec2(age, in_life.y);\n\
+            out_seed = in_seed;\n\
+        }\n\
+    }\n";
+
+const char* particle_render_vert =
+    "#version 330 core\n\
+    layout(location = 0) in vec2 position;\n\
+    layout(location = 2) in vec2 life;\n\
+    out vec4 particle_color;\n\
+    uniform mat4 model_view_projection;\n\
+    uniform vec4 start_color;\n\
+    uniform vec4 end_color;\n\
+    uniform float point_size;\n\
+    void main()\n\
+    {\n\
+        if (life.x < 0.0 || life.y <= 0.0)\n\
+        {\n\
+            particle_color = vec4(0.0, 0.0, 0.0, 0.0);\n\
+            gl_PointSize = 1.0;\n\
+            gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n\
+            return;\n\
+        }\n\
+        particle_color = mix(start_color, end_color, clamp(life.x / life.y, 0.0, 1.0));\n\
+        gl_PointSize = point_size;\n\
+        gl_Position = model_view_projection * vec4(position, 0.0, 1.0);\n\
+    }\n";
+
+const char* particle_render_frag =
+    "#version 330 core\n\
+    in vec4 particle_color;\n\
+    out vec4 out_color;\n\
+    void main()\n\
+    {\n\
+        out_color = particle_color;\n\
+    }\n";
+
+static float random(float n)
+{
+    float value = std::sin(n) * 43758.5453F;
+    return value - std::floor(value);
+}
+
+static float mix(float low, float high, float factor)
+{
+    return low + (high - low) * factor;
+}
+
+ParticleSystem::ParticleSystem(std::uint32_t max_particles, ParticleBackend backend)
+    : params_{}, backend_{backend}, max_particles_{max_particles}, time_{0.0}, update_shader_{},
+      render_shader_{particle_render_vert, particle_render_frag}, particles_{}, current_buffer_{0U}
+{
+    if (backend_ == ParticleBackend::TransformFeedback)
+    {
+        update_shader_ = Shader{particle_update_vert, nullptr,
+                                {"out_position", "out_velocity", "out_life", "out_seed"}};
+    }
+
+    init_particles();
+    init_buffers();
+
+    if (backend_ == ParticleBackend::TransformFeedback)
+    {
+        // Particle state lives only on the GPU from now on
+        particles_.clear();
+        particles_.shrink_to_fit();
+    }
+}
+
+ParticleSystem::~ParticleSystem()
+{
+    release_gl_resources();
+}
+
+void ParticleSystem::set_emitter(const ParticleEmitterParams& params)
+{
+    params_ = params;
+}
+
+const ParticleEmitterParams& ParticleSystem::get_emitter() const
+{
+    return params_;
+}
+
+void ParticleSystem::update(double delta_time)
+{
+    time_ = std::fmod(time_ + delta_time, PARTICLE_TIME_WRAP);
+
+    if (backend_ == ParticleBackend::TransformFeedback)
+    {
+        update_on_gpu(static_cast<float>(delta_time));
+    }
+    else
+    {
+        update_on_cpu(static_cast<float>(delta_time));
+    }
+}
+
+void ParticleSystem::draw()
+{
+    draw(render_shader_);
+}
+
+void ParticleSystem::draw(const Shader shader)
+{
+    RINVID_GPU_PASS(GpuPass::Particles);
+
+    shader.use();
+    RinvidGfx::update_mvp_matrix(glm::mat4{1.0F}, shader.get_id());
+    shader.set_float4("start_color", params_.start_color.r, params_.start_color.g,
+                      params_.start_color.b, params_.start_color.a);
+    shader.set_float4("end_color", params_.end_color.r, params_.end_color.g, params_.end_color.b,
+                      params_.end_color.a);
+    shader.set_float("point_size", params_.size);
+
+    GL_CALL(glEnable(GL_PROGRAM_POINT_SIZE));
+    GL_CALL(glBindVertexArray(vertex_array_objects_[current_buffer_]));
+    GL_CALL(glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(max_particles_)));
+    RinvidGfx::count_draw_call(0U);
+    GL_CALL(glBindVertexArray(0));
+    GL_CALL(glDisable(GL_PROGRAM_POINT_SIZE));
+}
+
+ParticleBackend ParticleSystem::get_backend() const
+{
+    return backend_;
+}
+
+std::uint32_t ParticleSystem::get_max_particles() const
+{
+    return max_particles_;
+}
+
+std::vector<Vector2f> ParticleSystem::get_positions() const
+{
+    // Read from the buffer rather than particles_, so what the GPU draws is what gets checked
+    std::vector<Particle> particles(max_particles_);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_objects_[current_buffer_]));
+    GL_CALL(glGetBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Particle) * particles.size(),
+                               particles.data()));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+
+    std::vector<Vector2f> positions{};
+    positions.reserve(particles.size());
+    for (const auto& particle : particles)
+    {
+        positions.push_back(Vector2f{particle.position[0], particle.position[1]});
+    }
+
+    return positions;
+}
+
+void ParticleSystem::init_particles()
+{
+    particles_.resize(max_particles_);
+
+    for (std::uint32_t i{0}; i < max_particles_; ++i)
+    {
+        auto& particle = particles_[i];
+
+        // Stagger births over one lifetime so particles don't all spawn on the first frame, zero
+        // lifetime makes each particle respawn as soon as it is born
+        particle.position[0] = params_.position.x;
+        particle.position[1] = params_.position.y;
+        particle.velocity[0] = 0.0F;
+        particle.velocity[1] = 0.0F;
+        particle.life[0]     = -params_.max_lifetime * (static_cast<float>(i) / max_particles_);
+        particle.life[1]     = 0.0F;
+        particle.seed        = static_cast<float>(i) * 1.618034F;
+    }
+}
+
+void ParticleSystem::init_buffers()
+{
+    const auto buffer_size = static_cast<GLsizeiptr>(sizeof(Particle) * max_particles_);
+    const auto buffer_usage =
+        (backend_ == ParticleBackend::TransformFeedback) ? GL_DYNAMIC_COPY : GL_STREAM_DRAW;
+    const std::uint32_t buffer_count = (backend_ == ParticleBackend::TransformFeedback) ? 2U : 1U;
+
+    GL_CALL(glGenVertexArrays(buffer_count, vertex_array_objects_));
+    GL_CALL(glGenBuffers(buffer_count, vertex_buffer_objects_));
+
+    for (std::uint32_t i{0}; i < buffer_count; ++i)
+    {
+        GL_CALL(glBindVertexArray(vertex_array_objects_[i]));
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_objects_[i]));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, buffer_size, particles_.data(), buffer_usage));
+        RinvidGfx::count_buffer_upload(static_cast<std::size_t>(buffer_size));
+
+        // Position attribute
+        GL_CALL(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Particle),
+                                      (void*)offsetof(Particle, position)));
+        GL_CALL(glEnableVertexAttribArray(0));
+
+        // Velocity attribute
+        GL_CALL(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Particle),
+                                      (void*)offsetof(Particle, velocity)));
+        GL_CALL(glEnableVertexAttribArray(1));
+
+        // Age and lifetime attribute
+        GL_CALL(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Particle),
+                                      (void*)offsetof(Particle, life)));
+        GL_CALL(glEnableVertexAttribArray(2));
+
+        // Seed attribute
+        GL_CALL(glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(Particle),
+                                      (void*)offsetof(Particle, seed)));
+        GL_CALL(glEnableVertexAttribArray(3));
+    }
+
+    GL_CALL(glBindVertexArray(0));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+}
+
+void ParticleSystem::release_gl_resources()
+{
+    for (std::uint32_t i{0}; i < 2U; ++i)
+    {
+        if (vertex_buffer_objects_[i] != 0U)
+        {
+            GL_CALL(glDeleteBuffers(1, &vertex_buffer_objects_[i]));
+            vertex_buffer_objects_[i] = 0U;
+        }
+
+        if (vertex_array_objects_[i] != 0U)
+        {
+            GL_CALL(glDeleteVertexArrays(1, &vertex_array_objects_[i]));
+            vertex_array_objects_[i] = 0U;
+        }
+    }
+}
+
+void ParticleSystem::update_on_cpu(float delta_time)
+{
+    const float acceleration_x = params_.acceleration.x * delta_time;
+    const float acceleration_y = params_.acceleration.y * delta_time;
+
+    // Particles don't affect each other, so big systems are updated in batches across cores
+    JobSystem::parallel_for(
+        static_cast<std::uint32_t>(particles_.size()), PARTICLES_PER_JOB,
+        [this, delta_time, acceleration_x, acceleration_y](std::uint32_t begin, std::uint32_t end) {
+            for (std::uint32_t i{begin}; i < end; ++i)
+            {
+                auto&       particle = particles_[i];
+                const float age      = particle.life[0] + delta_time;
+
+                if (age >= particle.life[1])
+                {
+                    respawn_on_cpu(particle);
+                }
+                else if (age < 0.0F)
+                {
+                    particle.life[0] = age;
+                }
+                else
+                {
+                    particle.velocity[0] += acceleration_x;
+                    particle.velocity[1] += acceleration_y;
+                    particle.position[0] += particle.velocity[0] * delta_time;
+                    particle.position[1] += particle.velocity[1] * delta_time;
+                    particle.life[0] = age;
+                }
+            }
+        });
+
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_objects_[0]));
+    GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Particle) * particles_.size(),
+                            particles_.data()));
+    RinvidGfx::count_buffer_upload(sizeof(Particle) * particles_.size());
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+}
+
+void ParticleSystem::respawn_on_cpu(Particle& particle)
+{
+    const float seed = random(particle.seed + static_cast<float>(time_));
+
+    particle.position[0] =
+        params_.position.x + (random(seed + 1.0F) * 2.0F - 1.0F) * params_.spawn_area.x;
+    particle.position[1] =
+        params_.position.y + (random(seed + 2.0F) * 2.0F - 1.0F) * params_.spawn_area.y;
+    particle.velocity[0] = mix(params_.min_velocity.x, params_.max_velocity.x, random(seed + 3.0F));
+    particle.velocity[1] = mix(params_.min_velocity.y, params_.max_velocity.y, random(seed + 4.0F));
+    particle.life[0] = 0.0F;
+    particle.life[1] = mix(params_.min_lifetime, params_.max_lifetime, random(seed + 5.0F));
+    particle.seed    = seed;
+}
+
+void ParticleSystem::update_on_gpu(float delta_time)
+{
+    RINVID_GPU_PASS(GpuPass::Particles);
+
+    const std::uint32_t next_buffer = 1U - current_buffer_;
+
+    update_shader_.use();
+    update_shader_.set_float("delta_time", delta_time);
+    update_shader_.set_float("time", static_cast<float>(time_));
+    update_shader_.set_float2("emitter_position", params_.position.x, params_.position.y);
+    update_shader_.set_float2("spawn_area", params_.spawn_area.x, params_.spawn_area.y);
+    update_shader_.set_float2("min_velocity", params_.min_velocity.x, params_.min_velocity.y);
+    update_shader_.set_float2("max_velocity", params_.max_velocity.x, params_.max_velocity.y);
+    update_shader_.set_float2("acceleration", params_.acceleration.x, params_.acceleration.y);
+    update_shader_.set_float2("lifetime_range", params_.min_lifetime, params_.max_lifetime);
+
+    // Read the current state, capture the new state into the other buffer and skip rasterization
+    GL_CALL(glEnable(GL_RASTERIZER_DISCARD));
+    GL_CALL(glBindVertexArray(vertex_array_objects_[current_buffer_]));
+    GL_CALL(glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, vertex_buffer_objects_[next_buffer]));
+    GL_CALL(glBeginTransformFeedback(GL_POINTS));
+    GL_CALL(glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(max_particles_)));
+    RinvidGfx::count_draw_call(0U);
+    GL_CALL(glEndTransformFeedback());
+    GL_CALL(glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0));
+    GL_CALL(glBindVertexArray(0));
+    GL_CALL(glDisable(GL_RASTERIZER_DISCARD));
+
+    current_buffer_ = next_buffer;
+}
+
+} // namespace rinvid
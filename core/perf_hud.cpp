@@ -0,0 +1,511 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+
+#include "core/include/gpu_timer.h"
+#include "core/include/job_system.h"
+#include "core/include/perf_hud.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/rinvid_gl.h"
+#include "util/include/error_handler.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+const char* hud_vert =
+    "#version 330 core\n\
+    layout(location = 0) in vec2 position;\n\
+    layout(location = 1) in vec2 tex_coords_in;\n\
+    layout(location = 2) in vec4 color_in;\n\
+    uniform vec2 screen_size;\n\
+    out vec2 tex_coords;\n\
+    out vec4 color;\n\
+    void main()\n\
+    {\n\
+        gl_Position = vec4((position.x / screen_size.x) * 2.0 - 1.0,\n\
+                           1.0 - (position.y / screen_size.y) * 2.0, 0.0, 1.0);\n\
+        tex_coords  = tex_coords_in;\n\
+        color       = color_in;\n\
+    }\n";
+
+const char* hud_frag =
+    "#version 330 core\n\
+    in vec2 tex_coords;\n\
+    in vec4 color;\n\
+    out vec4 out_color;\n\
+    uniform sampler2D font;\n\
+    void main()\n\
+    {\n\
+        out_color = vec4(color.rgb, color.a * texture(font, tex_coords).r);\n\
+    }\n";
+
+// Font atlas holds ASCII 32 - 127 in 16 columns and 6 rows of 6x8 cells, each with a 5x7 glyph in
+// its top left corner. Cell of character 127 is fully lit and used for solid quads.
+constexpr std::uint32_t GLYPH_WIDTH{5U};
+constexpr std::uint32_t GLYPH_HEIGHT{7U};
+constexpr std::uint32_t CELL_WIDTH{6U};
+constexpr std::uint32_t CELL_HEIGHT{8U};
+constexpr std::uint32_t ATLAS_COLUMNS{16U};
+constexpr std::uint32_t ATLAS_ROWS{6U};
+constexpr std::uint32_t ATLAS_WIDTH{ATLAS_COLUMNS * CELL_WIDTH};
+constexpr std::uint32_t ATLAS_HEIGHT{ATLAS_ROWS * CELL_HEIGHT};
+constexpr std::uint32_t FIRST_CHARACTER{32U};
+constexpr std::uint32_t SOLID_GLYPH{127U - FIRST_CHARACTER};
+
+// Size of a font pixel on screen
+constexpr float SCALE{2.0F};
+constexpr float LINE_HEIGHT{CELL_HEIGHT * SCALE + 2.0F};
+constexpr float MARGIN{8.0F};
+constexpr float GRAPH_HEIGHT{60.0F};
+constexpr float BAR_WIDTH{2.0F};
+constexpr float PANEL_WIDTH{PerfHud::NUMBER_OF_SAMPLES * BAR_WIDTH + 2.0F * MARGIN};
+
+// Graphs go up to two frames at 60 FPS, bars turn yellow and red above one and two
+constexpr float FRAME_BUDGET{1.0F / 60.0F};
+constexpr float GRAPH_MAX{2.0F * FRAME_BUDGET};
+
+// How often zone lines are refreshed, in nanoseconds
+constexpr std::uint64_t ZONE_PERIOD{500000000U};
+
+constexpr std::size_t MAX_QUADS{2048U};
+constexpr std::size_t VERTICES_PER_QUAD{6U};
+
+struct Glyph
+{
+    char         character;
+    std::uint8_t rows[GLYPH_HEIGHT];
+};
+
+// Rows top to bottom, bit 4 is the leftmost pixel. Lowercase letters are drawn as uppercase.
+constexpr Glyph FONT[] = {
+    {'0', {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}},
+    {'1', {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+    {'2', {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}},
+    {'3', {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}},
+    {'4', {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}},
+    {'5', {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}},
+    {'6', {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}},
+    {'7', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}},
+    {'8', {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}},
+    {'9', {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}},
+    {'A', {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+    {'B', {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}},
+    {'C', {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}},
+    {'D', {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}},
+    {'E', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}},
+    {'F', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}},
+    {'G', {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}},
+    {'H', {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+    {'I', {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+    {'J', {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}},
+    {'K', {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}},
+    {'L', {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}},
+    {'M', {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}},
+    {'N', {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}},
+    {'O', {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+    {'P', {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}},
+    {'Q', {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}},
+    {'R', {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}},
+    {'S', {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}},
+    {'T', {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}},
+    {'U', {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+    {'V', {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}},
+    {'W', {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}},
+    {'X', {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}},
+    {'Y', {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04}},
+    {'Z', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}},
+    {'.', {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}},
+    {',', {0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08}},
+    {':', {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}},
+    {'%', {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}},
+    {'(', {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}},
+    {')', {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}},
+    {'-', {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}},
+    {'/', {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}},
+    {'_', {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}},
+    {'=', {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00}},
+    {'<', {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02}},
+    {'>', {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08}},
+};
+
+std::vector<std::uint8_t> build_font_atlas()
+{
+    std::vector<std::uint8_t> atlas(ATLAS_WIDTH * ATLAS_HEIGHT, 0U);
+
+    auto cell_origin = [](std::uint32_t glyph) {
+        return (glyph / ATLAS_COLUMNS) * CELL_HEIGHT * ATLAS_WIDTH +
+               (glyph % ATLAS_COLUMNS) * CELL_WIDTH;
+    };
+
+    for (const auto& glyph : FONT)
+    {
+        const std::uint32_t origin =
+            cell_origin(static_cast<std::uint32_t>(glyph.character) - FIRST_CHARACTER);
+        for (std::uint32_t row{0U}; row < GLYPH_HEIGHT; ++row)
+        {
+            for (std::uint32_t column{0U}; column < GLYPH_WIDTH; ++column)
+            {
+                if ((glyph.rows[row] & (0x10U >> column)) != 0U)
+                {
+                    atlas[origin + row * ATLAS_WIDTH + column] = 0xFFU;
+                }
+            }
+        }
+    }
+
+    const std::uint32_t solid_origin = cell_origin(SOLID_GLYPH);
+    for (std::uint32_t row{0U}; row < CELL_HEIGHT; ++row)
+    {
+        std::fill_n(atlas.begin() + solid_origin + row * ATLAS_WIDTH, CELL_WIDTH, 0xFFU);
+    }
+
+    return atlas;
+}
+
+Color bar_color(float frame_time)
+{
+    if (frame_time <= FRAME_BUDGET)
+    {
+        return Color{0.3F, 0.9F, 0.3F, 0.9F};
+    }
+
+    if (frame_time <= GRAPH_MAX)
+    {
+        return Color{0.95F, 0.8F, 0.2F, 0.9F};
+    }
+
+    return Color{0.95F, 0.25F, 0.2F, 0.9F};
+}
+
+const Color TEXT_COLOR{1.0F, 1.0F, 1.0F, 1.0F};
+const Color LABEL_COLOR{0.6F, 0.8F, 1.0F, 1.0F};
+const Color PANEL_COLOR{0.0F, 0.0F, 0.0F, 0.7F};
+const Color BUDGET_LINE_COLOR{1.0F, 1.0F, 1.0F, 0.4F};
+
+} // namespace
+
+PerfHud::PerfHud()
+    : frame_times_{}, gpu_times_{}, sorted_frame_times_{}, next_sample_{0U},
+      number_of_samples_{0U}, visible_{false}, zone_lines_{}, pending_zone_lines_{},
+      zone_lines_pending_{false}, zone_job_{}, zone_period_start_{0U}, zone_period_frames_{0U},
+      vertices_{}, shader_{hud_vert, hud_frag}, vertex_array_object_{}, vertex_buffer_object_{},
+      font_texture_{}
+{
+    vertices_.reserve(MAX_QUADS * VERTICES_PER_QUAD);
+
+    const auto atlas = build_font_atlas();
+    GL_CALL(glGenTextures(1, &font_texture_));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, font_texture_));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, ATLAS_WIDTH, ATLAS_HEIGHT, 0, GL_RED,
+                         GL_UNSIGNED_BYTE, atlas.data()));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+
+    GL_CALL(glGenVertexArrays(1, &vertex_array_object_));
+    GL_CALL(glBindVertexArray(vertex_array_object_));
+    GL_CALL(glGenBuffers(1, &vertex_buffer_object_));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_object_));
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, MAX_QUADS * VERTICES_PER_QUAD * sizeof(Vertex), nullptr,
+                         GL_STREAM_DRAW));
+
+    GL_CALL(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0));
+    GL_CALL(glEnableVertexAttribArray(0));
+    GL_CALL(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                                  (void*)(2 * sizeof(float))));
+    GL_CALL(glEnableVertexAttribArray(1));
+    GL_CALL(glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                                  (void*)(4 * sizeof(float))));
+    GL_CALL(glEnableVertexAttribArray(2));
+
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+    GL_CALL(glBindVertexArray(0));
+}
+
+PerfHud::~PerfHud()
+{
+    // Zone job writes to this object
+    JobSystem::wait(zone_job_);
+
+    glDeleteBuffers(1, &vertex_buffer_object_);
+    glDeleteVertexArrays(1, &vertex_array_object_);
+    glDeleteTextures(1, &font_texture_);
+}
+
+void PerfHud::add_frame(double frame_time)
+{
+    float gpu_time{0.0F};
+#ifdef RINVID_GPU_TIMING
+    for (std::uint32_t pass{0U}; pass < static_cast<std::uint32_t>(GpuPass::Count); ++pass)
+    {
+        gpu_time += static_cast<float>(GpuTimer::get_pass_time(static_cast<GpuPass>(pass)));
+    }
+    // Pass times are in milliseconds
+    gpu_time /= 1000.0F;
+#endif
+
+    frame_times_[next_sample_] = static_cast<float>(frame_time);
+    gpu_times_[next_sample_]   = gpu_time;
+    next_sample_               = (next_sample_ + 1U) % NUMBER_OF_SAMPLES;
+    number_of_samples_         = std::min(number_of_samples_ + 1U, NUMBER_OF_SAMPLES);
+    ++zone_period_frames_;
+
+    // Done here, after the frame has been measured, rather than while drawing
+    if (visible_)
+    {
+        update_zone_lines();
+    }
+}
+
+void PerfHud::draw()
+{
+    if (!visible_ || (RinvidGfx::get_width() <= 0) || (RinvidGfx::get_height() <= 0))
+    {
+        return;
+    }
+
+    // Overlay's own work isn't counted, so it doesn't show up in the stats it shows. It isn't in
+    // a GPU pass either, GPU frame has already ended when it is drawn (see Application::run).
+    const FrameStats frame_stats = RinvidGfx::get_frame_stats();
+
+    build_vertices();
+
+    shader_.use();
+    shader_.set_float2("screen_size", static_cast<float>(RinvidGfx::get_width()),
+                       static_cast<float>(RinvidGfx::get_height()));
+
+    GL_CALL(glActiveTexture(GL_TEXTURE0));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, font_texture_));
+
+    // Orphaning the buffer lets the driver hand out fresh storage instead of waiting for the GPU to
+    // finish reading last frame's vertices
+    const std::size_t size = vertices_.size() * sizeof(Vertex);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_object_));
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, vertices_.capacity() * sizeof(Vertex), nullptr,
+                         GL_STREAM_DRAW));
+    GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, size, vertices_.data()));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+
+    GL_CALL(glBindVertexArray(vertex_array_object_));
+    GL_CALL(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices_.size())));
+    GL_CALL(glBindVertexArray(0));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+
+    // Drops the program switch and uniform set Shader has counted
+    RinvidGfx::restore_frame_stats(frame_stats);
+}
+
+void PerfHud::set_visible(bool visible)
+{
+    visible_ = visible;
+}
+
+bool PerfHud::is_visible() const
+{
+    return visible_;
+}
+
+double PerfHud::get_frame_time_percentile(double percentile) const
+{
+    if (number_of_samples_ == 0U)
+    {
+        return 0.0;
+    }
+
+    auto begin = sorted_frame_times_.begin();
+    auto end   = begin + number_of_samples_;
+    std::copy_n(frame_times_.begin(), number_of_samples_, begin);
+
+    // Nearest rank
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const auto   rank    = std::max(
+        static_cast<std::uint32_t>(std::ceil(clamped / 100.0 * number_of_samples_)), 1U);
+
+    std::nth_element(begin, begin + (rank - 1U), end);
+
+    return static_cast<double>(sorted_frame_times_[rank - 1U]);
+}
+
+void PerfHud::add_quad(float x, float y, float width, float height, const Color& color,
+                       std::uint32_t glyph)
+{
+    if (vertices_.size() + VERTICES_PER_QUAD > vertices_.capacity())
+    {
+        return;
+    }
+
+    const float u0 = static_cast<float>((glyph % ATLAS_COLUMNS) * CELL_WIDTH) / ATLAS_WIDTH;
+    const float v0 = static_cast<float>((glyph / ATLAS_COLUMNS) * CELL_HEIGHT) / ATLAS_HEIGHT;
+    const float u1 = u0 + static_cast<float>(CELL_WIDTH) / ATLAS_WIDTH;
+    const float v1 = v0 + static_cast<float>(CELL_HEIGHT) / ATLAS_HEIGHT;
+
+    const Vertex top_left{x, y, u0, v0, color.r, color.g, color.b, color.a};
+    const Vertex top_right{x + width, y, u1, v0, color.r, color.g, color.b, color.a};
+    const Vertex bottom_left{x, y + height, u0, v1, color.r, color.g, color.b, color.a};
+    const Vertex bottom_right{x + width, y + height, u1, v1, color.r, color.g, color.b, color.a};
+
+    vertices_.push_back(top_left);
+    vertices_.push_back(bottom_left);
+    vertices_.push_back(top_right);
+    vertices_.push_back(top_right);
+    vertices_.push_back(bottom_left);
+    vertices_.push_back(bottom_right);
+}
+
+float PerfHud::add_text(float x, float y, const char* text, const Color& color)
+{
+    for (const char* c = text; *c != '\0'; ++c)
+    {
+        const auto character = static_cast<std::uint32_t>(
+            std::toupper(static_cast<unsigned char>(*c)));
+        if ((character > FIRST_CHARACTER) && (character < 127U))
+        {
+            add_quad(x, y, CELL_WIDTH * SCALE, CELL_HEIGHT * SCALE, color,
+                     character - FIRST_CHARACTER);
+        }
+        x += CELL_WIDTH * SCALE;
+    }
+
+    return y + LINE_HEIGHT;
+}
+
+float PerfHud::add_graph(float x, float y, const std::array<float, NUMBER_OF_SAMPLES>& samples)
+{
+    // Oldest sample on the left
+    for (std::uint32_t i{0U}; i < number_of_samples_; ++i)
+    {
+        const std::uint32_t index =
+            (next_sample_ + NUMBER_OF_SAMPLES - number_of_samples_ + i) % NUMBER_OF_SAMPLES;
+        const float sample = samples[index];
+        const float height = std::min(sample / GRAPH_MAX, 1.0F) * GRAPH_HEIGHT;
+
+        add_quad(x + i * BAR_WIDTH, y + GRAPH_HEIGHT - height, BAR_WIDTH, height,
+                 bar_color(sample), SOLID_GLYPH);
+    }
+
+    const float budget_y = y + GRAPH_HEIGHT - (FRAME_BUDGET / GRAPH_MAX) * GRAPH_HEIGHT;
+    add_quad(x, budget_y, NUMBER_OF_SAMPLES * BAR_WIDTH, 1.0F, BUDGET_LINE_COLOR, SOLID_GLYPH);
+
+    return y + GRAPH_HEIGHT + MARGIN;
+}
+
+void PerfHud::update_zone_lines()
+{
+#ifdef RINVID_PROFILING
+    // Summing up copies every thread's zone ring, so it is done on a worker and picked up once done
+    if (!zone_job_.is_done())
+    {
+        return;
+    }
+
+    if (zone_lines_pending_)
+    {
+        zone_lines_.swap(pending_zone_lines_);
+        zone_lines_pending_ = false;
+    }
+
+    const std::uint64_t now = profiler::get_time();
+    if ((now - zone_period_start_ < ZONE_PERIOD) || (zone_period_frames_ == 0U))
+    {
+        return;
+    }
+
+    const std::uint64_t since  = zone_period_start_;
+    const std::uint32_t frames = zone_period_frames_;
+    JobSystem::run(
+        [this, since, frames]() {
+            const auto summaries = profiler::summarize_zones(since);
+
+            pending_zone_lines_.clear();
+            char line[64];
+            for (std::size_t i{0U}; (i < summaries.size()) && (i < NUMBER_OF_ZONES); ++i)
+            {
+                const double milliseconds_per_frame =
+                    static_cast<double>(summaries[i].total_duration) / 1000000.0 / frames;
+                std::snprintf(line, sizeof(line), "%-24.24s %6.2f MS", summaries[i].name,
+                              milliseconds_per_frame);
+                pending_zone_lines_.emplace_back(line);
+            }
+        },
+        &zone_job_);
+
+    zone_lines_pending_ = true;
+    zone_period_start_  = now;
+    zone_period_frames_ = 0U;
+#endif
+}
+
+void PerfHud::build_vertices()
+{
+    vertices_.clear();
+
+    // Panel is drawn first so it ends up behind everything, its height is set once content is laid
+    // out
+    add_quad(0.0F, 0.0F, PANEL_WIDTH, 0.0F, PANEL_COLOR, SOLID_GLYPH);
+
+    char        line[64];
+    const float x = MARGIN;
+    float       y = MARGIN;
+
+    const double last_frame_time = frame_times_[(next_sample_ + NUMBER_OF_SAMPLES - 1U) %
+                                                NUMBER_OF_SAMPLES];
+    std::snprintf(line, sizeof(line), "FRAME %6.2f MS", last_frame_time * 1000.0);
+    y = add_text(x, y, line, LABEL_COLOR);
+    y = add_graph(x, y, frame_times_);
+
+    std::snprintf(line, sizeof(line), "P50 %.2f P95 %.2f P99 %.2f MAX %.2f",
+                  get_frame_time_percentile(50.0) * 1000.0,
+                  get_frame_time_percentile(95.0) * 1000.0,
+                  get_frame_time_percentile(99.0) * 1000.0,
+                  get_frame_time_percentile(100.0) * 1000.0);
+    y = add_text(x, y, line, TEXT_COLOR);
+
+#ifdef RINVID_GPU_TIMING
+    const double last_gpu_time = gpu_times_[(next_sample_ + NUMBER_OF_SAMPLES - 1U) %
+                                            NUMBER_OF_SAMPLES];
+    std::snprintf(line, sizeof(line), "GPU %6.2f MS", last_gpu_time * 1000.0);
+    y = add_text(x, y, line, LABEL_COLOR);
+    y = add_graph(x, y, gpu_times_);
+#else
+    y = add_text(x, y, "GPU TIMING DISABLED", LABEL_COLOR);
+#endif
+
+    const FrameStats& stats = RinvidGfx::get_last_frame_stats();
+    std::snprintf(line, sizeof(line), "DRAWS %u TRIS %llu PROGRAMS %u", stats.draw_calls,
+                  static_cast<unsigned long long>(stats.triangles), stats.program_switches);
+    y = add_text(x, y, line, TEXT_COLOR);
+    std::snprintf(line, sizeof(line), "BINDS %u UPLOAD %llu B UNIFORMS %u", stats.texture_binds,
+                  static_cast<unsigned long long>(stats.buffer_upload_bytes), stats.uniform_sets);
+    y = add_text(x, y, line, TEXT_COLOR);
+
+    for (const auto& zone_line : zone_lines_)
+    {
+        y = add_text(x, y, zone_line.c_str(), TEXT_COLOR);
+    }
+
+    // Bottom vertices of the panel quad
+    for (std::size_t vertex : {1U, 4U, 5U})
+    {
+        vertices_[vertex].y = y + MARGIN;
+    }
+}
+
+} // namespace rinvid
@@ -0,0 +1,145 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include "core/include/light.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/sprite.h"
+#include "core/include/text.h"
+#include "include/render_snapshot.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+// Returns the element at index, growing the vector if it is not there yet
+template <typename T>
+T& get_element(std::vector<T>& elements, std::uint32_t index)
+{
+    if (index == elements.size())
+    {
+        elements.emplace_back();
+    }
+
+    return elements[index];
+}
+
+} // namespace
+
+RenderSnapshot::RenderSnapshot()
+    : sprites_{}, texts_{}, lights_{}, draw_order_{}, sprite_count_{0U}, text_count_{0U},
+      light_count_{0U}, draw_count_{0U}, clear_color_{}, clears_screen_{false}
+{
+}
+
+void RenderSnapshot::clear()
+{
+    sprite_count_  = 0U;
+    text_count_    = 0U;
+    light_count_   = 0U;
+    draw_count_    = 0U;
+    clears_screen_ = false;
+}
+
+void RenderSnapshot::set_clear_color(Color color)
+{
+    clear_color_   = color;
+    clears_screen_ = true;
+}
+
+void RenderSnapshot::add(Sprite& sprite, double delta_time)
+{
+    auto& state = get_element(sprites_, sprite_count_);
+
+    state.texture  = sprite.texture_;
+    state.animated = sprite.prepare_draw(delta_time, state.region_offset, state.region_width,
+                                         state.region_height);
+    state.transform = sprite.get_transform();
+    state.opacity   = sprite.opacity_;
+
+    get_element(draw_order_, draw_count_) = DrawEntry{Kind::Sprite, sprite_count_};
+    ++sprite_count_;
+    ++draw_count_;
+}
+
+void RenderSnapshot::add(Text& text, const std::string& content, Vector2f position, Color color)
+{
+    auto& state = get_element(texts_, text_count_);
+
+    state.text = &text;
+    // Assigning keeps the string's memory if it is big enough
+    state.content  = content;
+    state.position = position;
+    state.color    = color;
+
+    get_element(draw_order_, draw_count_) = DrawEntry{Kind::Text, text_count_};
+    ++text_count_;
+    ++draw_count_;
+}
+
+void RenderSnapshot::add(Light& light, Vector2f position, float intensity, Vector2f camera_pos)
+{
+    get_element(lights_, light_count_) = LightState{&light, position, intensity, camera_pos};
+    ++light_count_;
+}
+
+std::uint32_t RenderSnapshot::get_draw_count() const
+{
+    return draw_count_;
+}
+
+void RenderSnapshot::draw() const
+{
+    RINVID_PROFILE_ZONE("RenderSnapshot::draw");
+
+    if (clears_screen_)
+    {
+        RinvidGfx::clear_screen(clear_color_.r, clear_color_.g, clear_color_.b, clear_color_.a);
+    }
+
+    for (std::uint32_t i{0U}; i < light_count_; ++i)
+    {
+        const auto& state = lights_[i];
+
+        state.light->position_ = state.position;
+        state.light->set_intensity(state.intensity);
+        state.light->update(state.camera_pos);
+    }
+
+    const auto texture_shader = RinvidGfx::get_texture_default_shader();
+    for (std::uint32_t i{0U}; i < draw_count_; ++i)
+    {
+        const auto& entry = draw_order_[i];
+
+        if (entry.kind == Kind::Sprite)
+        {
+            const auto& state = sprites_[entry.index];
+
+            if (state.animated)
+            {
+                state.texture->update_vertices(state.region_offset, state.region_width,
+                                               state.region_height);
+            }
+            state.texture->draw(state.transform, texture_shader, state.opacity);
+        }
+        else
+        {
+            const auto& state = texts_[entry.index];
+
+            state.text->set_text(state.content);
+            state.text->set_position(state.position);
+            state.text->set_color(state.color);
+            state.text->draw();
+        }
+    }
+}
+
+} // namespace rinvid
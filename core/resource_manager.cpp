@@ -0,0 +1,181 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <filesystem>
+#include <system_error>
+
+#include "core/include/resource_manager.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+// Different spellings of the same path (relative, with "..", etc.) map to a single cache entry
+std::string canonical_path(const std::string& file_path)
+{
+    std::error_code ec{};
+    auto            path = std::filesystem::weakly_canonical(file_path, ec);
+    if (ec)
+    {
+        return file_path;
+    }
+
+    return path.string();
+}
+
+template <typename T>
+std::uint32_t purge(std::unordered_map<std::string, std::shared_ptr<T>>& cache)
+{
+    std::uint32_t purged{0U};
+
+    for (auto it = cache.begin(); it != cache.end();)
+    {
+        if (it->second.use_count() == 1)
+        {
+            it = cache.erase(it);
+            ++purged;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return purged;
+}
+
+} // namespace
+
+std::shared_ptr<Texture> ResourceManager::get_texture(const std::string& file_path, bool async)
+{
+    const auto key = canonical_path(file_path);
+
+    auto it = textures_.find(key);
+    if (it != textures_.end())
+    {
+        return it->second;
+    }
+
+    auto texture = async ? Texture::load_async(file_path.c_str())
+                         : std::make_shared<Texture>(file_path.c_str());
+    textures_.emplace(key, texture);
+
+    return texture;
+}
+
+std::shared_ptr<Font> ResourceManager::get_font(const std::string& file_path)
+{
+    const auto key = canonical_path(file_path);
+
+    auto it = fonts_.find(key);
+    if (it != fonts_.end())
+    {
+        return it->second;
+    }
+
+    RINVID_PROFILE_ZONE("Font load");
+    auto font = std::make_shared<Font>(file_path);
+    fonts_.emplace(key, font);
+
+    return font;
+}
+
+std::shared_ptr<const sf::SoundBuffer> ResourceManager::get_sound_buffer(
+    const std::string& file_path)
+{
+    const auto key = canonical_path(file_path);
+
+    auto it = sound_buffers_.find(key);
+    if (it != sound_buffers_.end())
+    {
+        return it->second;
+    }
+
+    RINVID_PROFILE_ZONE("Sound buffer load");
+    auto buffer = std::make_shared<sf::SoundBuffer>();
+    if (!buffer->loadFromFile(file_path))
+    {
+        throw "Error loading sound from file!";
+    }
+    sound_buffers_.emplace(key, buffer);
+
+    return buffer;
+}
+
+void ResourceManager::preload_textures(const std::vector<std::string>& file_paths, bool async)
+{
+    for (const auto& file_path : file_paths)
+    {
+        get_texture(file_path, async);
+    }
+}
+
+void ResourceManager::preload_fonts(const std::vector<std::string>& file_paths)
+{
+    for (const auto& file_path : file_paths)
+    {
+        get_font(file_path);
+    }
+}
+
+void ResourceManager::preload_sound_buffers(const std::vector<std::string>& file_paths)
+{
+    for (const auto& file_path : file_paths)
+    {
+        get_sound_buffer(file_path);
+    }
+}
+
+std::uint32_t ResourceManager::purge_unused()
+{
+    return purge(textures_) + purge(fonts_) + purge(sound_buffers_);
+}
+
+void ResourceManager::clear()
+{
+    textures_.clear();
+    fonts_.clear();
+    sound_buffers_.clear();
+}
+
+ResourceMemoryUsage ResourceManager::get_memory_usage() const
+{
+    ResourceMemoryUsage usage{};
+
+    for (const auto& [path, texture] : textures_)
+    {
+        (void)path;
+        usage.textures += static_cast<std::size_t>(texture->get_width()) *
+                          static_cast<std::size_t>(texture->get_height()) * 4U;
+    }
+
+    for (const auto& [path, font] : fonts_)
+    {
+        (void)path;
+        usage.fonts += font->get_file_size() + font->get_glyph_memory();
+    }
+
+    for (const auto& [path, buffer] : sound_buffers_)
+    {
+        (void)path;
+        usage.sounds += static_cast<std::size_t>(buffer->getSampleCount()) * sizeof(sf::Int16);
+    }
+
+    return usage;
+}
+
+std::uint32_t ResourceManager::get_resource_count() const
+{
+    return static_cast<std::uint32_t>(textures_.size() + fonts_.size() + sound_buffers_.size());
+}
+
+} // namespace rinvid
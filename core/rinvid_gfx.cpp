@@ -7,7 +7,10 @@
  * repository for more details.
  **********************************************************************/
 
+#include <ostream>
+
 #include "include/rinvid_gfx.h"
+#include "core/include/gpu_timer.h"
 #include "extern/glm/glm/gtc/type_ptr.hpp"
 #include "extern/glm/glm/gtx/transform.hpp"
 #include "util/include/error_handler.h"
@@ -100,6 +103,7 @@ const char* default_texture_frag =
     uniform sampler2D the_texture;\n\
     uniform bool use_ambient_light = false;\n\
     uniform float ambient_strength = 0.1;\n\
+    uniform bool premultiplied_alpha = false;\n\
     in vec2 tex_coord;\n\
     #define NUMBER_OF_LIGHTS 100 \n\
     uniform bool light_active[NUMBER_OF_LIGHTS];\n\
@@ -149,6 +153,8 @@ const char* default_texture_frag =
        }\n\
        out_color = color;\n\
        out_color.a = alpha.a * opacity;\n\
+       if (premultiplied_alpha)\n\
+          out_color.rgb *= opacity;\n\
     }\n";
 
 const char* default_text_vert =
@@ -187,12 +193,28 @@ Shader             RinvidGfx::text_default_shader_{};
 std::int32_t       RinvidGfx::width_{};
 std::int32_t       RinvidGfx::height_{};
 const Application* RinvidGfx::application_{nullptr};
+FrameStats         RinvidGfx::frame_stats_{};
+FrameStats         RinvidGfx::last_frame_stats_{};
+std::uint32_t      RinvidGfx::current_program_id_{0U};
+
+std::ostream& operator<<(std::ostream& stream, const FrameStats& stats)
+{
+    return stream << "draw calls: " << stats.draw_calls << ", triangles: " << stats.triangles
+                  << ", program switches: " << stats.program_switches
+                  << ", texture binds: " << stats.texture_binds
+                  << ", buffer uploads: " << stats.buffer_upload_bytes
+                  << " B, uniform sets: " << stats.uniform_sets;
+}
 
 void RinvidGfx::init_default_shaders()
 {
-    shape_default_shader_   = Shader(default_shape_vert, default_shape_frag);
-    texture_default_shader_ = Shader(default_texture_vert, default_texture_frag);
-    text_default_shader_    = Shader(default_text_vert, default_text_frag);
+    auto shaders = Shader::compile_batch({{default_shape_vert, default_shape_frag},
+                                          {default_texture_vert, default_texture_frag},
+                                          {default_text_vert, default_text_frag}});
+
+    shape_default_shader_   = shaders[0];
+    texture_default_shader_ = shaders[1];
+    text_default_shader_    = shaders[2];
 }
 
 void RinvidGfx::init(const Application* application)
@@ -209,10 +231,13 @@ void RinvidGfx::init(const Application* application)
 
 void RinvidGfx::shutdown()
 {
+    GpuTimer::shutdown();
+
     shape_default_shader_   = Shader{};
     texture_default_shader_ = Shader{};
     text_default_shader_    = Shader{};
     application_            = nullptr;
+    current_program_id_     = 0U;
 }
 
 void RinvidGfx::set_viewport(std::int32_t x, std::int32_t y, std::int32_t width,
@@ -283,6 +308,7 @@ void RinvidGfx::update_mvp_matrix(const glm::mat4& model, std::uint32_t shader_i
         return;
     }
     GL_CALL(glUniformMatrix4fv(mvp_location, 1, GL_FALSE, glm::value_ptr(model_view_projection_)));
+    count_uniform_set();
 }
 
 void RinvidGfx::update_view(const glm::mat4& view)
@@ -315,4 +341,25 @@ const Application* RinvidGfx::get_application()
     return application_;
 }
 
+const FrameStats& RinvidGfx::get_frame_stats()
+{
+    return frame_stats_;
+}
+
+const FrameStats& RinvidGfx::get_last_frame_stats()
+{
+    return last_frame_stats_;
+}
+
+void RinvidGfx::reset_frame_stats()
+{
+    last_frame_stats_ = frame_stats_;
+    frame_stats_      = FrameStats{};
+}
+
+void RinvidGfx::restore_frame_stats(const FrameStats& stats)
+{
+    frame_stats_ = stats;
+}
+
 } // namespace rinvid
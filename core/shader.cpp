@@ -7,47 +7,451 @@
  * repository for more details.
  **********************************************************************/
 
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <system_error>
 
+#include <SFML/Window/Context.hpp>
+
+#include "core/include/rinvid_gfx.h"
 #include "core/include/shader.h"
 
+// Not part of glad's GL 4.5 headers
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 struct Shader::ProgramHandle
 {
     ~ProgramHandle()
     {
+        release_stages();
+
         if (id_ != 0U)
         {
             glDeleteProgram(id_);
         }
     }
 
+    void release_stages()
+    {
+        for (auto* stage : {&vert_handle_, &frag_handle_})
+        {
+            if (*stage != 0U)
+            {
+                if (id_ != 0U)
+                {
+                    glDetachShader(id_, *stage);
+                }
+                glDeleteShader(*stage);
+                *stage = 0U;
+            }
+        }
+    }
+
     std::uint32_t id_{};
+    // Shader stages are kept until link status is checked, their logs explain a failed link
+    std::uint32_t vert_handle_{};
+    std::uint32_t frag_handle_{};
+    bool          loaded_from_cache_{false};
+    bool          link_checked_{false};
+    // Binary is saved to cache once linking is known to have succeeded
+    std::string cache_file_{};
 };
 
-Shader::Shader(const char* vert_code, const char* frag_code)
+std::string Shader::cache_directory_{};
+
+namespace
+{
+
+// 64-bit FNV-1a
+void hash_bytes(std::uint64_t& hash, const char* bytes, std::size_t size)
+{
+    for (std::size_t i{0U}; i < size; ++i)
+    {
+        hash ^= static_cast<std::uint8_t>(bytes[i]);
+        hash *= 0x100000001B3ULL;
+    }
+}
+
+void hash_string(std::uint64_t& hash, const char* string)
+{
+    if (string == nullptr)
+    {
+        string = "";
+    }
+
+    // Terminator is hashed too, so that ("ab", "c") and ("a", "bc") differ
+    hash_bytes(hash, string, std::char_traits<char>::length(string) + 1U);
+}
+
+void hash_gl_string(std::uint64_t& hash, GLenum name)
+{
+    hash_string(hash, reinterpret_cast<const char*>(glGetString(name)));
+}
+
+bool program_binaries_supported()
+{
+    // Errors of earlier calls are reported, only the one of the query is cleared below
+    rinvid::errors::handle_gl_errors(__FILE__, __LINE__);
+
+    GLint number_of_formats{0};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &number_of_formats);
+
+    // Clear error in case the query itself isn't supported
+    glGetError();
+
+    return number_of_formats > 0;
+}
+
+std::string get_cache_file(const std::string& directory, const char* vert_code,
+                           const char* frag_code, const std::vector<std::string>& feedback_varyings)
+{
+    std::uint64_t hash{0xCBF29CE484222325ULL};
+    hash_string(hash, vert_code);
+    hash_string(hash, frag_code);
+    for (const auto& varying : feedback_varyings)
+    {
+        hash_string(hash, varying.c_str());
+    }
+    hash_gl_string(hash, GL_VENDOR);
+    hash_gl_string(hash, GL_RENDERER);
+    hash_gl_string(hash, GL_VERSION);
+    hash_gl_string(hash, GL_SHADING_LANGUAGE_VERSION);
+
+    char file_name[32]{};
+    std::snprintf(file_name, sizeof(file_name), "%016llx.bin",
+                  static_cast<unsigned long long>(hash));
+
+    return (std::filesystem::path{directory} / file_name).string();
+}
+
+using MaxShaderCompilerThreadsFunction = void(APIENTRY*)(GLuint count);
+
+MaxShaderCompilerThreadsFunction max_shader_compiler_threads{nullptr};
+bool                             parallel_compile_checked{false};
+
+// Lets the driver compile and link on its own threads, if it supports KHR_parallel_shader_compile
+// (or its ARB predecessor). Driver is told so only on the first call. Returns whether it is
+// supported.
+bool enable_parallel_compile()
+{
+    if (!parallel_compile_checked)
+    {
+        parallel_compile_checked = true;
+
+        if (sf::Context::isExtensionAvailable("GL_KHR_parallel_shader_compile"))
+        {
+            max_shader_compiler_threads = reinterpret_cast<MaxShaderCompilerThreadsFunction>(
+                sf::Context::getFunction("glMaxShaderCompilerThreadsKHR"));
+        }
+        else if (sf::Context::isExtensionAvailable("GL_ARB_parallel_shader_compile"))
+        {
+            max_shader_compiler_threads = reinterpret_cast<MaxShaderCompilerThreadsFunction>(
+                sf::Context::getFunction("glMaxShaderCompilerThreadsARB"));
+        }
+
+        // Maximum value means driver decides how many threads to use
+        if (max_shader_compiler_threads != nullptr)
+        {
+            max_shader_compiler_threads(0xFFFFFFFFU);
+        }
+    }
+
+    return max_shader_compiler_threads != nullptr;
+}
+
+std::string get_info_log(std::uint32_t object, bool is_program)
+{
+    GLint length{0};
+    if (is_program)
+    {
+        glGetProgramiv(object, GL_INFO_LOG_LENGTH, &length);
+    }
+    else
+    {
+        glGetShaderiv(object, GL_INFO_LOG_LENGTH, &length);
+    }
+
+    if (length <= 0)
+    {
+        return "";
+    }
+
+    std::string log(static_cast<std::size_t>(length), '\0');
+    if (is_program)
+    {
+        glGetProgramInfoLog(object, length, nullptr, log.data());
+    }
+    else
+    {
+        glGetShaderInfoLog(object, length, nullptr, log.data());
+    }
+    log.resize(std::char_traits<char>::length(log.c_str()));
+
+    return log;
+}
+
+} // namespace
+
+Shader::Shader(const char* vert_code, const char* frag_code) : Shader(vert_code, frag_code, {})
+{
+}
+
+Shader::Shader(const char* vert_code, const char* frag_code,
+               const std::vector<std::string>& feedback_varyings)
     : program_handle_{std::make_shared<ProgramHandle>()}
 {
-    unsigned int vert_handle{};
-    unsigned int frag_handle{};
-    vert_handle = glCreateShader(GL_VERTEX_SHADER);
-    GL_CALL(glShaderSource(vert_handle, 1, &vert_code, NULL));
-    GL_CALL(glCompileShader(vert_handle));
-    frag_handle = glCreateShader(GL_FRAGMENT_SHADER);
-    GL_CALL(glShaderSource(frag_handle, 1, &frag_code, NULL));
-    glCompileShader(frag_handle);
+    enable_parallel_compile();
+
+    if (submit_compile(vert_code, frag_code, feedback_varyings))
+    {
+        submit_link(feedback_varyings);
+    }
+}
+
+std::vector<Shader> Shader::compile_batch(const std::vector<ShaderSource>& sources)
+{
+    enable_parallel_compile();
+
+    // All compiles are submitted before any link, and nothing is queried, so the driver can work
+    // on all of them at once
+    std::vector<Shader> shaders(sources.size());
+    std::vector<bool>   needs_link(sources.size(), false);
+    for (std::size_t i{0U}; i < sources.size(); ++i)
+    {
+        shaders[i].program_handle_ = std::make_shared<ProgramHandle>();
+        needs_link[i]              = shaders[i].submit_compile(
+            sources[i].vert_code, sources[i].frag_code, sources[i].feedback_varyings);
+    }
+
+    for (std::size_t i{0U}; i < sources.size(); ++i)
+    {
+        if (needs_link[i])
+        {
+            shaders[i].submit_link(sources[i].feedback_varyings);
+        }
+    }
+
+    return shaders;
+}
+
+bool Shader::submit_compile(const char* vert_code, const char* frag_code,
+                            const std::vector<std::string>& feedback_varyings)
+{
+    if (!cache_directory_.empty() && program_binaries_supported())
+    {
+        program_handle_->cache_file_ =
+            get_cache_file(cache_directory_, vert_code, frag_code, feedback_varyings);
+        if (load_from_cache(program_handle_->cache_file_))
+        {
+            return false;
+        }
+    }
+
+    program_handle_->vert_handle_ = glCreateShader(GL_VERTEX_SHADER);
+    GL_CALL(glShaderSource(program_handle_->vert_handle_, 1, &vert_code, NULL));
+    GL_CALL(glCompileShader(program_handle_->vert_handle_));
+    if (frag_code != nullptr)
+    {
+        program_handle_->frag_handle_ = glCreateShader(GL_FRAGMENT_SHADER);
+        GL_CALL(glShaderSource(program_handle_->frag_handle_, 1, &frag_code, NULL));
+        GL_CALL(glCompileShader(program_handle_->frag_handle_));
+    }
+
+    return true;
+}
+
+void Shader::submit_link(const std::vector<std::string>& feedback_varyings)
+{
     program_handle_->id_ = glCreateProgram();
-    GL_CALL(glAttachShader(program_handle_->id_, vert_handle));
-    GL_CALL(glAttachShader(program_handle_->id_, frag_handle));
+    GL_CALL(glAttachShader(program_handle_->id_, program_handle_->vert_handle_));
+    if (program_handle_->frag_handle_ != 0U)
+    {
+        GL_CALL(glAttachShader(program_handle_->id_, program_handle_->frag_handle_));
+    }
+
+    if (!feedback_varyings.empty())
+    {
+        std::vector<const char*> varying_names{};
+        varying_names.reserve(feedback_varyings.size());
+        for (const auto& varying : feedback_varyings)
+        {
+            varying_names.push_back(varying.c_str());
+        }
+
+        GL_CALL(glTransformFeedbackVaryings(program_handle_->id_,
+                                            static_cast<GLsizei>(varying_names.size()),
+                                            varying_names.data(), GL_INTERLEAVED_ATTRIBS));
+    }
+
+    if (!program_handle_->cache_file_.empty())
+    {
+        GL_CALL(glProgramParameteri(program_handle_->id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                    GL_TRUE));
+    }
+
+    // Link status is not queried here, that would wait for the driver to finish
     GL_CALL(glLinkProgram(program_handle_->id_));
-    GL_CALL(glDeleteShader(vert_handle));
-    GL_CALL(glDeleteShader(frag_handle));
+}
+
+void Shader::check_link_status() const
+{
+    if (!program_handle_ || program_handle_->link_checked_)
+    {
+        return;
+    }
+
+    program_handle_->link_checked_ = true;
+
+    if (program_handle_->loaded_from_cache_)
+    {
+        return;
+    }
+
+    GLint link_status{GL_FALSE};
+    GL_CALL(glGetProgramiv(program_handle_->id_, GL_LINK_STATUS, &link_status));
+    if (link_status != GL_TRUE)
+    {
+        for (auto stage : {program_handle_->vert_handle_, program_handle_->frag_handle_})
+        {
+            GLint compile_status{GL_TRUE};
+            if (stage != 0U)
+            {
+                GL_CALL(glGetShaderiv(stage, GL_COMPILE_STATUS, &compile_status));
+            }
+
+            if (compile_status != GL_TRUE)
+            {
+                rinvid::errors::put_error_to_log("Shader compilation failed: " +
+                                                 get_info_log(stage, false));
+            }
+        }
+
+        rinvid::errors::put_error_to_log("Shader program linking failed: " +
+                                         get_info_log(program_handle_->id_, true));
+    }
+    else if (!program_handle_->cache_file_.empty())
+    {
+        save_to_cache(program_handle_->cache_file_);
+    }
+
+    program_handle_->release_stages();
+}
+
+bool Shader::load_from_cache(const std::string& cache_file)
+{
+    std::ifstream file{cache_file, std::ios::binary | std::ios::ate};
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    const auto file_size = static_cast<std::size_t>(file.tellg());
+    if (file_size <= sizeof(GLenum))
+    {
+        return false;
+    }
+
+    GLenum            binary_format{};
+    std::vector<char> binary(file_size - sizeof(binary_format));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(&binary_format), sizeof(binary_format));
+    file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+    if (!file)
+    {
+        return false;
+    }
+
+    // Errors of earlier calls are reported, only the one of loading the binary is cleared below
+    rinvid::errors::handle_gl_errors(__FILE__, __LINE__);
+    const std::uint32_t program = glCreateProgram();
+    glProgramBinary(program, binary_format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    // A binary from another driver version is rejected by failing to link, an unknown format may
+    // also raise an error, neither is worth reporting since the program is simply recompiled
+    glGetError();
+
+    GLint link_status{GL_FALSE};
+    glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+    if (link_status != GL_TRUE)
+    {
+        glDeleteProgram(program);
+        return false;
+    }
+
+    program_handle_->id_                = program;
+    program_handle_->loaded_from_cache_ = true;
+
+    return true;
+}
+
+void Shader::save_to_cache(const std::string& cache_file) const
+{
+    GLint binary_length{0};
+    GL_CALL(glGetProgramiv(program_handle_->id_, GL_PROGRAM_BINARY_LENGTH, &binary_length));
+    if (binary_length <= 0)
+    {
+        return;
+    }
+
+    GLenum            binary_format{};
+    std::vector<char> binary(static_cast<std::size_t>(binary_length));
+    GL_CALL(glGetProgramBinary(program_handle_->id_, binary_length, nullptr, &binary_format,
+                               binary.data()));
+
+    std::error_code error{};
+    std::filesystem::create_directories(std::filesystem::path{cache_file}.parent_path(), error);
+
+    // Written to a temporary file first, so that a crash never leaves a truncated binary behind
+    const std::string temporary_file = cache_file + ".tmp";
+    {
+        std::ofstream file{temporary_file, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(&binary_format), sizeof(binary_format));
+        file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+        if (!file)
+        {
+            rinvid::errors::put_error_to_log("Could not write shader cache file: " + cache_file);
+            return;
+        }
+    }
+
+    std::filesystem::rename(temporary_file, cache_file, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary_file, error);
+        rinvid::errors::put_error_to_log("Could not write shader cache file: " + cache_file);
+    }
 }
 
 void Shader::use() const
 {
+    check_link_status();
     glUseProgram(get_id());
+    rinvid::RinvidGfx::count_program_use(get_id());
+}
+
+bool Shader::is_ready() const
+{
+    if (!program_handle_ || program_handle_->link_checked_ || program_handle_->loaded_from_cache_)
+    {
+        return true;
+    }
+
+    // Without parallel compile support, querying would just wait for the driver
+    if (!enable_parallel_compile())
+    {
+        return true;
+    }
+
+    GLint completed{GL_TRUE};
+    GL_CALL(glGetProgramiv(program_handle_->id_, GL_COMPLETION_STATUS_KHR, &completed));
+
+    return completed == GL_TRUE;
 }
 
 void Shader::set_bool(const std::string& name, bool value) const
@@ -59,6 +463,7 @@ void Shader::set_bool(const std::string& name, bool value) const
         return;
     }
     GL_CALL(glUniform1i(location, static_cast<std::int32_t>(value)));
+    rinvid::RinvidGfx::count_uniform_set();
 }
 
 void Shader::set_int(const std::string& name, std::int32_t value) const
@@ -70,6 +475,7 @@ void Shader::set_int(const std::string& name, std::int32_t value) const
         return;
     }
     GL_CALL(glUniform1i(location, value));
+    rinvid::RinvidGfx::count_uniform_set();
 }
 
 void Shader::set_float(const std::string& name, float value) const
@@ -81,6 +487,7 @@ void Shader::set_float(const std::string& name, float value) const
         return;
     }
     GL_CALL(glUniform1f(location, value));
+    rinvid::RinvidGfx::count_uniform_set();
 }
 
 void Shader::set_float2(const std::string& name, float value1, float value2) const
@@ -92,6 +499,7 @@ void Shader::set_float2(const std::string& name, float value1, float value2) con
         return;
     }
     GL_CALL(glUniform2f(location, value1, value2));
+    rinvid::RinvidGfx::count_uniform_set();
 }
 
 void Shader::set_float4(const std::string& name, float value1, float value2, float value3,
@@ -104,6 +512,7 @@ void Shader::set_float4(const std::string& name, float value1, float value2, flo
         return;
     }
     GL_CALL(glUniform4f(location, value1, value2, value3, value4));
+    rinvid::RinvidGfx::count_uniform_set();
 }
 
 std::uint32_t Shader::get_id() const
@@ -115,3 +524,13 @@ std::uint32_t Shader::get_id() const
 
     return program_handle_->id_;
 }
+
+bool Shader::is_loaded_from_cache() const
+{
+    return program_handle_ && program_handle_->loaded_from_cache_;
+}
+
+void Shader::set_cache_directory(const std::string& directory)
+{
+    cache_directory_ = directory;
+}
@@ -47,25 +47,40 @@ void Sprite::draw(double delta_time)
 }
 
 void Sprite::draw(double delta_time, const Shader shader)
+{
+    Vector2f      offset{};
+    std::uint32_t width{};
+    std::uint32_t height{};
+
+    if (prepare_draw(delta_time, offset, width, height))
+    {
+        texture_->update_vertices(offset, width, height);
+    }
+
+    texture_->draw(get_transform(), shader, opacity_);
+}
+
+bool Sprite::prepare_draw(double delta_time, Vector2f& offset, std::uint32_t& width,
+                          std::uint32_t& height)
 {
     origin_.x = position_.x + width_ / 2;
     origin_.y = position_.y + height_ / 2;
 
-    if (sprite_animation_.is_active_)
+    if (!sprite_animation_.is_active_)
     {
-        sprite_animation_.current_animation_->advance(delta_time);
-        Rect          texture_region = sprite_animation_.current_animation_->frame();
-        Vector2f      offset{texture_offset_};
-        std::uint32_t width  = texture_region.width;
-        std::uint32_t height = texture_region.height;
+        return false;
+    }
 
-        offset.x += texture_region.position.x;
-        offset.y += texture_region.position.y;
+    sprite_animation_.current_animation_->advance(delta_time);
+    Rect texture_region = sprite_animation_.current_animation_->frame();
 
-        texture_->update_vertices(offset, width, height);
-    }
+    offset = texture_offset_;
+    offset.x += texture_region.position.x;
+    offset.y += texture_region.position.y;
+    width  = texture_region.width;
+    height = texture_region.height;
 
-    texture_->draw(get_transform(), shader, opacity_);
+    return true;
 }
 
 void Sprite::move(const Vector2f move_vector)
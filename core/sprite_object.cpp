@@ -27,4 +27,12 @@ Rect SpriteObject::bounding_rect()
     return Sprite::bounding_rect();
 }
 
+void SpriteObject::draw_interpolated(float alpha, double delta_time)
+{
+    const Vector2f position = position_;
+    position_               = get_interpolated_position(alpha);
+    draw(delta_time);
+    position_ = position;
+}
+
 } // namespace rinvid
@@ -14,30 +14,19 @@
 #include "extern/glm/glm/glm.hpp"
 #include "extern/glm/glm/gtc/type_ptr.hpp"
 
+#include "core/include/gpu_timer.h"
 #include "core/include/rinvid_gfx.h"
 #include "core/include/rinvid_gl.h"
 #include "core/include/text.h"
-#include "core/include/ttf_lib.h"
+#include "util/include/profiler.h"
 
 namespace rinvid
 {
 
 constexpr float LINE_SPACING = 1.08F;
 
-void Text::release_character_textures()
-{
-    for (auto& [character_key, character] : characters_)
-    {
-        (void)character_key;
-        if (character.texture_id != 0U)
-        {
-            GL_CALL(glDeleteTextures(1, &character.texture_id));
-            character.texture_id = 0U;
-        }
-    }
-
-    characters_.clear();
-}
+// Drawn for characters the font has no glyph for
+const Font::Glyph MISSING_GLYPH{0U, glm::ivec2(0, 0), glm::ivec2(0, 0), 0U};
 
 void Text::release_vertex_buffer()
 {
@@ -56,41 +45,21 @@ void Text::release_vertex_buffer()
 
 Text::Text(std::string text, const std::string& font_path, Vector2f position, Color color,
            std::uint32_t size)
-    : size_{size}, text_{std::move(text)}, position_{position}, color_{color}, max_width_{0.0F}
+    : Text{std::move(text), std::make_shared<Font>(font_path), position, color, size}
 {
-    const auto* ft_lib = TTFLib::get_instance();
-
-    auto error = FT_New_Face(*ft_lib, font_path.c_str(), 0, &ft_face_);
-    if (error)
-    {
-        TTFLib::release();
-        throw error;
-    }
+}
 
-    try
-    {
-        generate_character_textures();
-    }
-    catch (...)
-    {
-        FT_Done_Face(ft_face_);
-        ft_face_ = nullptr;
-        TTFLib::release();
-        throw;
-    }
+Text::Text(std::string text, std::shared_ptr<Font> font, Vector2f position, Color color,
+           std::uint32_t size)
+    : font_{std::move(font)}, size_{size}, text_{std::move(text)}, position_{position},
+      color_{color}, max_width_{0.0F}, glyphs_{&font_->get_glyphs(size_)}
+{
+    create_vertex_buffer();
 }
 
 Text::~Text()
 {
-    release_character_textures();
     release_vertex_buffer();
-
-    if (ft_face_ != nullptr)
-    {
-        FT_Done_Face(ft_face_);
-    }
-
-    TTFLib::release();
 }
 
 void Text::draw()
@@ -101,6 +70,9 @@ void Text::draw()
 
 void Text::draw(const Shader shader)
 {
+    RINVID_PROFILE_ZONE("Text::draw");
+    RINVID_GPU_PASS(GpuPass::Text);
+
     float x = position_.x;
     float y = position_.y;
 
@@ -115,8 +87,10 @@ void Text::draw(const Shader shader)
                                       static_cast<float>(RinvidGfx::get_height()));
     GL_CALL(glUniformMatrix4fv(glGetUniformLocation(shader.get_id(), "projection"), 1, GL_FALSE,
                                glm::value_ptr(projection)));
+    RinvidGfx::count_uniform_set();
     GL_CALL(glUniform3f(glGetUniformLocation(shader.get_id(), "text_color"), color_.r, color_.g,
                         color_.b));
+    RinvidGfx::count_uniform_set();
     GL_CALL(glActiveTexture(GL_TEXTURE0));
     GL_CALL(glBindVertexArray(vertex_array_object_));
 
@@ -126,7 +100,8 @@ void Text::draw(const Shader shader)
     std::string::const_iterator c;
     for (c = text_.begin(); c != text_.end(); c++)
     {
-        const Character& character = characters_[*c];
+        const auto         found     = glyphs_->find(*c);
+        const Font::Glyph& character = (found != glyphs_->end()) ? found->second : MISSING_GLYPH;
 
         float xpos = x + character.bearing.x;
         float ypos = y - (character.size.y - character.bearing.y);
@@ -144,6 +119,9 @@ void Text::draw(const Shader shader)
         GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices));
         GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, 0));
         GL_CALL(glDrawArrays(GL_TRIANGLES, 0, 6));
+        RinvidGfx::count_texture_bind();
+        RinvidGfx::count_buffer_upload(sizeof(vertices));
+        RinvidGfx::count_draw_call(2U);
 
         std::uint32_t advance;
         if (c != text_.begin() && x == start_x && *c == ' ')
@@ -179,8 +157,8 @@ void Text::set_position(const Vector2f position)
 
 void Text::set_size(const std::uint32_t new_size)
 {
-    size_ = new_size;
-    generate_character_textures();
+    size_   = new_size;
+    glyphs_ = &font_->get_glyphs(size_);
 }
 
 void Text::set_color(const Color color)
@@ -198,63 +176,8 @@ void Text::set_max_width(float max_width)
     max_width_ = max_width;
 }
 
-void Text::generate_character_textures()
+void Text::create_vertex_buffer()
 {
-    std::unordered_map<char, Character> new_characters{};
-    new_characters.reserve(128U);
-
-    FT_Set_Pixel_Sizes(ft_face_, 0, size_);
-
-    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-
-    try
-    {
-        for (unsigned char c = 0; c < 128; c++)
-        {
-            if (FT_Load_Char(ft_face_, c, FT_LOAD_RENDER))
-            {
-                throw "Freetype: Failed to load Glyph";
-            }
-
-            std::uint32_t texture{};
-            GL_CALL(glGenTextures(1, &texture));
-            GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
-            GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, ft_face_->glyph->bitmap.width,
-                                 ft_face_->glyph->bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE,
-                                 ft_face_->glyph->bitmap.buffer));
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-
-            Character character = {
-                texture, glm::ivec2(ft_face_->glyph->bitmap.width, ft_face_->glyph->bitmap.rows),
-                glm::ivec2(ft_face_->glyph->bitmap_left, ft_face_->glyph->bitmap_top),
-                static_cast<unsigned int>(ft_face_->glyph->advance.x)};
-            new_characters.emplace(static_cast<char>(c), character);
-        }
-    }
-    catch (...)
-    {
-        for (auto& [character_key, character] : new_characters)
-        {
-            (void)character_key;
-            if (character.texture_id != 0U)
-            {
-                GL_CALL(glDeleteTextures(1, &character.texture_id));
-            }
-        }
-
-        throw;
-    }
-
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
-
-    release_character_textures();
-    release_vertex_buffer();
-
-    characters_ = std::move(new_characters);
-
     GL_CALL(glGenVertexArrays(1, &vertex_array_object_));
     GL_CALL(glGenBuffers(1, &vertex_buffer_object_));
     GL_CALL(glBindVertexArray(vertex_array_object_));
@@ -11,12 +11,17 @@
 #include <iterator>
 #include <vector>
 
+#include "core/include/gpu_timer.h"
 #include "core/include/rinvid_gfx.h"
 #include "core/include/rinvid_gl.h"
 #include "extern/glm/glm/gtc/type_ptr.hpp"
 #include "include/texture.h"
+#include "include/texture_loader.h"
+#include "util/include/cooked_texture.h"
 #include "util/include/error_handler.h"
 #include "util/include/image_loader.h"
+#include "util/include/mapped_file.h"
+#include "util/include/profiler.h"
 
 namespace rinvid
 {
@@ -48,7 +53,64 @@ void Texture::release_gl_resources()
     }
 }
 
-Texture::Texture(const char* file_name)
+Texture::Texture(const char* file_name, bool generate_mipmaps) : mipmaps_{generate_mipmaps}
+{
+    RINVID_PROFILE_ZONE("Texture load");
+
+    init_vertex_buffer();
+
+    if (is_cooked_texture_file(file_name))
+    {
+        loaded_ = init_cooked_texture(file_name);
+        return;
+    }
+
+    std::vector<std::uint8_t> image_data{};
+    bool                      result = load_image(file_name, image_data, width_, height_);
+    if (result == false)
+    {
+        errors::put_error_to_log(std::string{file_name} +
+                                 " image loading failed during texture creation");
+    }
+
+    init_texture(image_data.data(), width_, height_);
+    loaded_ = result;
+}
+
+Texture::Texture()
+{
+    const std::uint8_t placeholder[4] = {0U, 0U, 0U, 0U};
+
+    init_vertex_buffer();
+    init_texture(placeholder, 1, 1);
+}
+
+Texture::Texture(std::int32_t width, std::int32_t height)
+{
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) *
+                                         static_cast<std::size_t>(height) * 4U,
+                                     0U);
+
+    init_vertex_buffer();
+    init_texture(pixels.data(), width, height);
+    loaded_ = true;
+}
+
+std::shared_ptr<Texture> Texture::load_async(const char* file_name, bool generate_mipmaps)
+{
+    if (is_cooked_texture_file(file_name))
+    {
+        return std::make_shared<Texture>(file_name, generate_mipmaps);
+    }
+
+    std::shared_ptr<Texture> texture{new Texture{}};
+    texture->mipmaps_ = generate_mipmaps;
+    TextureLoader::load(texture, file_name);
+
+    return texture;
+}
+
+void Texture::init_vertex_buffer()
 {
     GL_CALL(glGenVertexArrays(1, &vertex_array_object_));
     GL_CALL(glGenBuffers(1, &vertex_buffer_obecjt_));
@@ -58,9 +120,11 @@ Texture::Texture(const char* file_name)
 
     GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_obecjt_));
     GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(gl_vertices_), gl_vertices_, GL_STATIC_DRAW));
+    RinvidGfx::count_buffer_upload(sizeof(gl_vertices_));
 
     GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, element_buffer_object_));
     GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices_), indices_, GL_STATIC_DRAW));
+    RinvidGfx::count_buffer_upload(sizeof(indices_));
 
     // Position attribute
     GL_CALL(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0));
@@ -70,29 +134,121 @@ Texture::Texture(const char* file_name)
     GL_CALL(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float),
                                   (void*)(3 * sizeof(float))));
     GL_CALL(glEnableVertexAttribArray(1));
+}
 
-    std::vector<std::uint8_t> image_data{};
-    bool                      result = load_image(file_name, image_data, width_, height_);
-    if (result == false)
+void Texture::init_texture(const std::uint8_t* image_data, std::int32_t width, std::int32_t height)
+{
+    GL_CALL(glGenTextures(1, &texture_id_));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture_id_));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    apply_filters();
+    upload_image(image_data, width, height);
+}
+
+void Texture::apply_filters()
+{
+    // Indexed by [min_filter_][mipmap_filter_]
+    static constexpr GLint mipmap_min_filters[2][2] = {
+        {GL_NEAREST_MIPMAP_NEAREST, GL_NEAREST_MIPMAP_LINEAR},
+        {GL_LINEAR_MIPMAP_NEAREST, GL_LINEAR_MIPMAP_LINEAR}};
+
+    const auto min = static_cast<std::size_t>(min_filter_);
+    const auto mip = static_cast<std::size_t>(mipmap_filter_);
+
+    GLint min_filter = (min_filter_ == TextureFilter::Nearest) ? GL_NEAREST : GL_LINEAR;
+    GLint mag_filter = (mag_filter_ == TextureFilter::Nearest) ? GL_NEAREST : GL_LINEAR;
+    if (mipmaps_)
+    {
+        min_filter = mipmap_min_filters[min][mip];
+    }
+
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture_id_));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, min_filter));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mag_filter));
+}
+
+bool Texture::init_cooked_texture(const char* file_name)
+{
+    MappedFile                      file{};
+    CookedTextureHeader             header{};
+    std::vector<CookedTextureLevel> levels{};
+
+    if (!file.open(file_name) ||
+        !parse_cooked_texture(file.get_data(), file.get_size(), header, levels))
     {
         errors::put_error_to_log(std::string{file_name} +
-                                 " image loading failed during texture creation");
+                                 " cooked texture loading failed during texture creation");
+        init_texture(nullptr, 0, 0);
+        return false;
     }
 
-    GL_CALL(glGenTextures(1, &texture_id_));
+    // A precomputed mip chain is used instead of generating one, so level 0 is uploaded without
+    // mipmaps, otherwise it would generate a chain only for it to be overwritten
+    const bool generate_mipmaps = mipmaps_ && (levels.size() == 1U);
+    mipmaps_                    = false;
+
+    // Pixels go straight from the mapped file to the driver
+    init_texture(levels[0].data, levels[0].width, levels[0].height);
+    for (std::size_t level{1U}; level < levels.size(); ++level)
+    {
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), GL_RGBA, levels[level].width,
+                             levels[level].height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                             levels[level].data));
+    }
+
+    if (levels.size() > 1U)
+    {
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,
+                                static_cast<GLint>(levels.size() - 1U)));
+        mipmaps_ = true;
+        apply_filters();
+    }
+    else if (generate_mipmaps)
+    {
+        this->generate_mipmaps();
+    }
+
+    premultiplied_alpha_ = (header.flags & COOKED_TEXTURE_PREMULTIPLIED_ALPHA) != 0U;
+
+    return true;
+}
+
+void Texture::upload_image(const std::uint8_t* image_data, std::int32_t width, std::int32_t height)
+{
+    width_  = width;
+    height_ = height;
+
     GL_CALL(glBindTexture(GL_TEXTURE_2D, texture_id_));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
     GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width_, height_, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                         image_data.data()));
+                         image_data));
+
+    if (mipmaps_ && (width_ > 0) && (height_ > 0))
+    {
+        GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+        apply_filters();
+    }
+
+    // Texture coordinates depend on texture size
+    if ((region_width_ != 0U) && (region_height_ != 0U))
+    {
+        update_vertices(region_offset_, region_width_, region_height_);
+    }
 }
 
 Texture::Texture(Texture&& other)
 {
     this->width_                 = other.width_;
     this->height_                = other.height_;
+    this->loaded_                = other.loaded_;
+    this->premultiplied_alpha_   = other.premultiplied_alpha_;
+    this->mipmaps_               = other.mipmaps_;
+    this->min_filter_            = other.min_filter_;
+    this->mag_filter_            = other.mag_filter_;
+    this->mipmap_filter_         = other.mipmap_filter_;
+    this->region_offset_         = other.region_offset_;
+    this->region_width_          = other.region_width_;
+    this->region_height_         = other.region_height_;
     this->vertex_array_object_   = other.vertex_array_object_;
     this->vertex_buffer_obecjt_  = other.vertex_buffer_obecjt_;
     this->element_buffer_object_ = other.element_buffer_object_;
@@ -107,6 +263,8 @@ Texture::Texture(Texture&& other)
     other.texture_id_            = 0;
     other.width_                 = 0;
     other.height_                = 0;
+    other.loaded_                = false;
+    other.premultiplied_alpha_   = false;
 }
 
 Texture& Texture::operator=(Texture&& other)
@@ -120,6 +278,15 @@ Texture& Texture::operator=(Texture&& other)
 
     this->width_                 = other.width_;
     this->height_                = other.height_;
+    this->loaded_                = other.loaded_;
+    this->premultiplied_alpha_   = other.premultiplied_alpha_;
+    this->mipmaps_               = other.mipmaps_;
+    this->min_filter_            = other.min_filter_;
+    this->mag_filter_            = other.mag_filter_;
+    this->mipmap_filter_         = other.mipmap_filter_;
+    this->region_offset_         = other.region_offset_;
+    this->region_width_          = other.region_width_;
+    this->region_height_         = other.region_height_;
     this->vertex_array_object_   = other.vertex_array_object_;
     this->vertex_buffer_obecjt_  = other.vertex_buffer_obecjt_;
     this->element_buffer_object_ = other.element_buffer_object_;
@@ -134,6 +301,8 @@ Texture& Texture::operator=(Texture&& other)
     other.texture_id_            = 0;
     other.width_                 = 0;
     other.height_                = 0;
+    other.loaded_                = false;
+    other.premultiplied_alpha_   = false;
 
     return *this;
 }
@@ -143,19 +312,95 @@ Texture::~Texture()
     release_gl_resources();
 }
 
+bool Texture::is_loaded() const
+{
+    return loaded_;
+}
+
+std::int32_t Texture::get_width() const
+{
+    return width_;
+}
+
+std::int32_t Texture::get_height() const
+{
+    return height_;
+}
+
+bool Texture::has_premultiplied_alpha() const
+{
+    return premultiplied_alpha_;
+}
+
+void Texture::generate_mipmaps()
+{
+    mipmaps_ = true;
+
+    if ((width_ > 0) && (height_ > 0))
+    {
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, texture_id_));
+        GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+    }
+
+    apply_filters();
+}
+
+bool Texture::has_mipmaps() const
+{
+    return mipmaps_;
+}
+
+void Texture::set_filter(TextureFilter min_filter, TextureFilter mag_filter,
+                         TextureFilter mipmap_filter)
+{
+    min_filter_    = min_filter;
+    mag_filter_    = mag_filter;
+    mipmap_filter_ = mipmap_filter;
+
+    apply_filters();
+}
+
 void Texture::draw(const glm::mat4& transform, const Shader shader, float opacity)
 {
+    RINVID_PROFILE_ZONE("Texture::draw");
+    RINVID_GPU_PASS(GpuPass::Textures);
+
     shader.use();
     RinvidGfx::update_mvp_matrix(transform, shader.get_id());
     shader.set_float("opacity", opacity);
 
+    // Custom shaders don't have to handle premultiplied alpha, so a missing uniform is not an error
+    std::int32_t premultiplied_location =
+        glGetUniformLocation(shader.get_id(), "premultiplied_alpha");
+    if (premultiplied_location != -1)
+    {
+        GL_CALL(glUniform1i(premultiplied_location, premultiplied_alpha_ ? 1 : 0));
+        RinvidGfx::count_uniform_set();
+    }
+
     GL_CALL(glBindTexture(GL_TEXTURE_2D, texture_id_));
+    RinvidGfx::count_texture_bind();
     GL_CALL(glBindVertexArray(vertex_array_object_));
-    GL_CALL(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0));
+
+    if (premultiplied_alpha_)
+    {
+        GL_CALL(glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+        GL_CALL(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0));
+        GL_CALL(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    }
+    else
+    {
+        GL_CALL(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0));
+    }
+    RinvidGfx::count_draw_call(2U);
 }
 
 void Texture::update_vertices(Vector2f offset, std::uint32_t width, std::uint32_t height)
 {
+    region_offset_ = offset;
+    region_width_  = width;
+    region_height_ = height;
+
     // Make center of texture (0, 0) for simplicity
     Vector2f top_left{};
     top_left.x = 0.0F - (width / 2.0F);
@@ -195,6 +440,7 @@ void Texture::update_vertices(Vector2f offset, std::uint32_t width, std::uint32_
 
     GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_obecjt_));
     GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(gl_vertices_), gl_vertices_, GL_STATIC_DRAW));
+    RinvidGfx::count_buffer_upload(sizeof(gl_vertices_));
 }
 
 } // namespace rinvid
@@ -0,0 +1,146 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "core/include/job_system.h"
+#include "include/texture_loader.h"
+#include "util/include/error_handler.h"
+#include "util/include/image_loader.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+struct DecodedImage
+{
+    std::weak_ptr<Texture>    texture;
+    std::vector<std::uint8_t> image_data;
+    std::int32_t              width;
+    std::int32_t              height;
+};
+
+std::deque<DecodedImage> decoded_images{};
+std::mutex               loader_mutex{};
+// Images queued for decoding or being decoded
+std::uint32_t            images_in_decoding{0U};
+// Incremented by shutdown, decoding jobs queued before it drop their images
+std::uint32_t            generation{0U};
+
+void decode_image(const std::weak_ptr<Texture>& texture, const std::string& file_name,
+                  std::uint32_t load_generation)
+{
+    {
+        std::lock_guard<std::mutex> lock{loader_mutex};
+        if (load_generation != generation)
+        {
+            return;
+        }
+    }
+
+    DecodedImage image{texture, {}, 0, 0};
+
+    // Don't bother decoding if texture has been dropped in the meantime
+    bool result = false;
+    if (!texture.expired())
+    {
+        RINVID_PROFILE_ZONE("TextureLoader decode");
+        result = load_image(file_name.c_str(), image.image_data, image.width, image.height);
+        if (result == false)
+        {
+            errors::put_error_to_log(file_name +
+                                     " image loading failed during asynchronous texture load");
+        }
+    }
+
+    std::lock_guard<std::mutex> lock{loader_mutex};
+    if (load_generation != generation)
+    {
+        return;
+    }
+
+    --images_in_decoding;
+    if (result == true)
+    {
+        decoded_images.push_back(std::move(image));
+    }
+}
+
+} // namespace
+
+void TextureLoader::load(std::weak_ptr<Texture> texture, const std::string& file_name)
+{
+    std::uint32_t load_generation{};
+    {
+        std::lock_guard<std::mutex> lock{loader_mutex};
+        ++images_in_decoding;
+        load_generation = generation;
+    }
+
+    JobSystem::run([texture = std::move(texture), file_name, load_generation]() {
+        decode_image(texture, file_name, load_generation);
+    });
+}
+
+std::uint32_t TextureLoader::process_uploads(std::uint32_t max_uploads)
+{
+    RINVID_PROFILE_ZONE("TextureLoader::process_uploads");
+
+    std::uint32_t uploaded{0U};
+
+    while (uploaded < max_uploads)
+    {
+        DecodedImage image{};
+
+        {
+            std::lock_guard<std::mutex> lock{loader_mutex};
+            if (decoded_images.empty())
+            {
+                break;
+            }
+
+            image = std::move(decoded_images.front());
+            decoded_images.pop_front();
+        }
+
+        auto texture = image.texture.lock();
+        if (texture == nullptr)
+        {
+            continue;
+        }
+
+        texture->upload_image(image.image_data.data(), image.width, image.height);
+        texture->loaded_ = true;
+        ++uploaded;
+    }
+
+    return uploaded;
+}
+
+std::uint32_t TextureLoader::get_pending_count()
+{
+    std::lock_guard<std::mutex> lock{loader_mutex};
+
+    return static_cast<std::uint32_t>(decoded_images.size()) + images_in_decoding;
+}
+
+void TextureLoader::shutdown()
+{
+    std::lock_guard<std::mutex> lock{loader_mutex};
+    ++generation;
+    decoded_images.clear();
+    images_in_decoding = 0U;
+}
+
+} // namespace rinvid
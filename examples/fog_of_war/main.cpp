@@ -0,0 +1,153 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/include/application.h"
+#include "core/include/dynamic_texture.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/screen.h"
+#include "core/include/sprite.h"
+#include "core/include/texture.h"
+#include "system/include/keyboard.h"
+#include "system/include/mouse.h"
+#include "util/include/rect.h"
+#include "util/include/vector2.h"
+
+using namespace rinvid;
+using namespace rinvid::system;
+
+constexpr std::int32_t WINDOW_WIDTH{800};
+constexpr std::int32_t WINDOW_HEIGHT{600};
+// Each fog pixel covers FOG_SCALE x FOG_SCALE screen pixels
+constexpr std::int32_t FOG_SCALE{5};
+constexpr std::int32_t FOG_WIDTH{WINDOW_WIDTH / FOG_SCALE};
+constexpr std::int32_t FOG_HEIGHT{WINDOW_HEIGHT / FOG_SCALE};
+constexpr std::int32_t REVEAL_RADIUS{10};
+
+class FogOfWarScreen : public rinvid::Screen
+{
+  public:
+    void create() override;
+    void destroy() override;
+
+  private:
+    void update(double delta_time) override;
+    void reset_fog();
+    void reveal(std::int32_t center_x, std::int32_t center_y);
+
+    std::unique_ptr<Texture>        level_texture_;
+    std::unique_ptr<DynamicTexture> fog_texture_;
+    std::unique_ptr<Sprite>         level_;
+    std::unique_ptr<Sprite>         fog_;
+
+    // CPU copy of the fog, dirty rectangles are uploaded out of it
+    std::vector<std::uint8_t> fog_pixels_;
+};
+
+void FogOfWarScreen::create()
+{
+    level_texture_ = std::make_unique<Texture>("resources/level_1.png");
+    level_ = std::make_unique<Sprite>(level_texture_.get(), level_texture_->get_width(),
+                                      level_texture_->get_height(), Vector2f{80.0F, 60.0F});
+    level_->set_scale(static_cast<float>(WINDOW_WIDTH) / level_texture_->get_width());
+
+    // Fog is scaled around its center, which is placed at the center of the window
+    fog_texture_ = std::make_unique<DynamicTexture>(FOG_WIDTH, FOG_HEIGHT);
+    fog_         = std::make_unique<Sprite>(
+        fog_texture_.get(), FOG_WIDTH, FOG_HEIGHT,
+        Vector2f{(WINDOW_WIDTH - FOG_WIDTH) / 2.0F, (WINDOW_HEIGHT - FOG_HEIGHT) / 2.0F});
+    fog_->set_scale(static_cast<float>(FOG_SCALE));
+
+    fog_pixels_.resize(static_cast<std::size_t>(FOG_WIDTH * FOG_HEIGHT * 4));
+    reset_fog();
+}
+
+void FogOfWarScreen::reset_fog()
+{
+    for (std::size_t i{0U}; i < fog_pixels_.size(); i += 4U)
+    {
+        fog_pixels_[i]      = 10U;
+        fog_pixels_[i + 1U] = 10U;
+        fog_pixels_[i + 2U] = 20U;
+        fog_pixels_[i + 3U] = 240U;
+    }
+
+    fog_texture_->update(fog_pixels_.data());
+}
+
+void FogOfWarScreen::reveal(std::int32_t center_x, std::int32_t center_y)
+{
+    const std::int32_t left   = std::max(center_x - REVEAL_RADIUS, 0);
+    const std::int32_t top    = std::max(center_y - REVEAL_RADIUS, 0);
+    const std::int32_t right  = std::min(center_x + REVEAL_RADIUS, FOG_WIDTH - 1);
+    const std::int32_t bottom = std::min(center_y + REVEAL_RADIUS, FOG_HEIGHT - 1);
+    if ((left > right) || (top > bottom))
+    {
+        return;
+    }
+
+    for (std::int32_t y{top}; y <= bottom; ++y)
+    {
+        for (std::int32_t x{left}; x <= right; ++x)
+        {
+            const std::int32_t dx = x - center_x;
+            const std::int32_t dy = y - center_y;
+            if ((dx * dx + dy * dy) <= REVEAL_RADIUS * REVEAL_RADIUS)
+            {
+                fog_pixels_[static_cast<std::size_t>((y * FOG_WIDTH + x) * 4 + 3)] = 0U;
+            }
+        }
+    }
+
+    // Only the rectangle around the circle goes to the GPU
+    Rect dirty{Vector2f{static_cast<float>(left), static_cast<float>(top)}, right - left + 1,
+               bottom - top + 1};
+    auto offset = static_cast<std::size_t>((top * FOG_WIDTH + left) * 4);
+    fog_texture_->update(dirty, fog_pixels_.data() + offset, FOG_WIDTH);
+}
+
+void FogOfWarScreen::update(double delta_time)
+{
+    (void)delta_time;
+
+    RinvidGfx::clear_screen(0.0F, 0.0F, 0.0F, 1.0F);
+
+    if (Keyboard::is_key_pressed(Keyboard::Key::R))
+    {
+        reset_fog();
+    }
+
+    auto mouse_position = Mouse::get_mouse_pos();
+    reveal(static_cast<std::int32_t>(mouse_position.x) / FOG_SCALE,
+           static_cast<std::int32_t>(mouse_position.y) / FOG_SCALE);
+
+    level_->draw();
+    fog_->draw();
+}
+
+void FogOfWarScreen::destroy()
+{
+    fog_.reset();
+    level_.reset();
+    fog_texture_.reset();
+    level_texture_.reset();
+}
+
+int main()
+{
+    Application fog_of_war_app{WINDOW_WIDTH, WINDOW_HEIGHT, "Fog of war example"};
+    fog_of_war_app.set_screen(std::make_unique<FogOfWarScreen>());
+    fog_of_war_app.run();
+
+    return 0;
+}
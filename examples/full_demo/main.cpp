@@ -18,6 +18,7 @@
 #include "core/include/rectangle_shape.h"
 #include "core/include/rinvid_gfx.h"
 #include "core/include/screen.h"
+#include "core/include/shader.h"
 #include "core/include/sprite.h"
 #include "core/include/sprite_object.h"
 #include "core/include/text.h"
@@ -385,6 +386,9 @@ void TestingGrounds::destroy()
 
 int main()
 {
+    // Default shaders are compiled when Application is constructed, so cache is set up before it
+    Shader::set_cache_directory("shader_cache");
+
     Application testing_grounds_app{800, 600, "Rinvid"};
     testing_grounds_app.set_screen(std::make_unique<TestingGrounds>());
     testing_grounds_app.set_fps(120);
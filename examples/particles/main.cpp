@@ -0,0 +1,182 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+#include "core/include/application.h"
+#include "core/include/particle_system.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/rinvid_gl.h"
+#include "core/include/screen.h"
+#include "system/include/keyboard.h"
+#include "util/include/vector2.h"
+
+using namespace rinvid;
+using namespace rinvid::system;
+
+constexpr std::uint32_t NUMBER_OF_PARTICLES{200000U};
+constexpr std::uint32_t BENCHMARK_WARMUP_FRAMES{60U};
+constexpr std::uint32_t BENCHMARK_MEASURED_FRAMES{600U};
+
+static ParticleEmitterParams rain_emitter(float x)
+{
+    ParticleEmitterParams params{};
+    params.position     = Vector2f{x, -20.0F};
+    params.spawn_area   = Vector2f{500.0F, 10.0F};
+    params.min_velocity = Vector2f{-20.0F, 300.0F};
+    params.max_velocity = Vector2f{20.0F, 500.0F};
+    params.acceleration = Vector2f{30.0F, 400.0F};
+    params.min_lifetime = 1.0F;
+    params.max_lifetime = 1.6F;
+    params.size         = 2.0F;
+    params.start_color  = Color{0.6F, 0.7F, 1.0F, 0.9F};
+    params.end_color    = Color{0.6F, 0.7F, 1.0F, 0.0F};
+
+    return params;
+}
+
+static const char* backend_name(ParticleBackend backend)
+{
+    return (backend == ParticleBackend::TransformFeedback) ? "transform feedback" : "cpu";
+}
+
+class ParticlesScreen : public rinvid::Screen
+{
+  public:
+    ParticlesScreen(bool benchmark);
+    void create() override;
+    void destroy() override;
+
+  private:
+    void update(double delta_time) override;
+    void update_benchmark(double frame_time);
+    void switch_backend(ParticleBackend backend);
+
+    std::unique_ptr<ParticleSystem> particles_;
+    float                           emitter_x_;
+    bool                            switch_key_pressed_;
+    bool                            benchmark_;
+    std::uint32_t                   benchmark_frame_;
+    double                          benchmark_total_time_;
+};
+
+ParticlesScreen::ParticlesScreen(bool benchmark)
+    : particles_{nullptr}, emitter_x_{400.0F}, switch_key_pressed_{false}, benchmark_{benchmark},
+      benchmark_frame_{0U}, benchmark_total_time_{0.0}
+{
+}
+
+void ParticlesScreen::create()
+{
+    switch_backend(benchmark_ ? ParticleBackend::Cpu : ParticleBackend::TransformFeedback);
+}
+
+void ParticlesScreen::switch_backend(ParticleBackend backend)
+{
+    particles_.reset();
+    particles_ = std::make_unique<ParticleSystem>(NUMBER_OF_PARTICLES, backend);
+    particles_->set_emitter(rain_emitter(emitter_x_));
+
+    std::cout << "Particle backend: " << backend_name(backend) << '\n';
+}
+
+void ParticlesScreen::update(double delta_time)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    RinvidGfx::clear_screen(0.05F, 0.05F, 0.1F, 1.0F);
+
+    if (Keyboard::is_key_pressed(Keyboard::Key::D) ||
+        Keyboard::is_key_pressed(Keyboard::Key::Right))
+    {
+        emitter_x_ += 300.0F * static_cast<float>(delta_time);
+        particles_->set_emitter(rain_emitter(emitter_x_));
+    }
+    else if (Keyboard::is_key_pressed(Keyboard::Key::A) ||
+             Keyboard::is_key_pressed(Keyboard::Key::Left))
+    {
+        emitter_x_ -= 300.0F * static_cast<float>(delta_time);
+        particles_->set_emitter(rain_emitter(emitter_x_));
+    }
+
+    bool switch_key_pressed = Keyboard::is_key_pressed(Keyboard::Key::B);
+    if (switch_key_pressed && !switch_key_pressed_ && !benchmark_)
+    {
+        switch_backend(particles_->get_backend() == ParticleBackend::Cpu
+                           ? ParticleBackend::TransformFeedback
+                           : ParticleBackend::Cpu);
+    }
+    switch_key_pressed_ = switch_key_pressed;
+
+    particles_->update(delta_time);
+    particles_->draw();
+
+    if (benchmark_)
+    {
+        // Wait for the GPU so that frame time includes the simulation and drawing it has queued
+        GL_CALL(glFinish());
+        auto                          end        = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double> frame_time = end - start;
+        update_benchmark(frame_time.count());
+    }
+}
+
+void ParticlesScreen::update_benchmark(double frame_time)
+{
+    ++benchmark_frame_;
+    if (benchmark_frame_ <= BENCHMARK_WARMUP_FRAMES)
+    {
+        return;
+    }
+
+    benchmark_total_time_ += frame_time;
+
+    if (benchmark_frame_ < BENCHMARK_WARMUP_FRAMES + BENCHMARK_MEASURED_FRAMES)
+    {
+        return;
+    }
+
+    std::cout << "Average frame time (" << backend_name(particles_->get_backend()) << ", "
+              << NUMBER_OF_PARTICLES << " particles): "
+              << (benchmark_total_time_ / BENCHMARK_MEASURED_FRAMES) * 1000.0 << " ms\n";
+
+    benchmark_frame_      = 0U;
+    benchmark_total_time_ = 0.0;
+
+    if (particles_->get_backend() == ParticleBackend::Cpu)
+    {
+        switch_backend(ParticleBackend::TransformFeedback);
+    }
+    else
+    {
+        get_application()->exit();
+    }
+}
+
+void ParticlesScreen::destroy()
+{
+    particles_.reset();
+}
+
+int main(int argc, char** argv)
+{
+    bool benchmark = (argc > 1) && (std::strcmp(argv[1], "--benchmark") == 0);
+
+    std::uint16_t fps = benchmark ? 0U : 60U;
+
+    Application particles_app{800, 600, "Particles example", false, fps};
+    particles_app.set_screen(std::make_unique<ParticlesScreen>(benchmark));
+    particles_app.run();
+
+    return 0;
+}
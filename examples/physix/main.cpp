@@ -7,6 +7,8 @@
  * repository for more details.
  **********************************************************************/
 
+#include <string>
+
 #include "core/include/application.h"
 #include "core/include/screen.h"
 #include "core/include/sprite.h"
@@ -27,6 +29,7 @@ class PhysixScreen : public rinvid::Screen
 
   private:
     void update(double delta_time) override;
+    void fixed_update(double time_step) override;
 
     Texture      platform_texture{"resources/plat.png"};
     SpriteObject platform_1{&platform_texture, 597, 62, Vector2f{101.0F, 500.0F},
@@ -55,10 +58,8 @@ void PhysixScreen::create()
     platform_2.set_allowed_collisions(UP);
 }
 
-void PhysixScreen::update(double delta_time)
+void PhysixScreen::fixed_update(double time_step)
 {
-    RinvidGfx::clear_screen(0.2F, 0.8F, 0.8F, 1.0F);
-
     if (Keyboard::is_key_pressed(system::Keyboard::Key::Up))
     {
         if (man.is_touching(DOWN))
@@ -79,11 +80,11 @@ void PhysixScreen::update(double delta_time)
         man.set_x_velocity(0.0F);
     }
 
-    sphere_sprite.update(delta_time);
-    platform_1.update(delta_time);
-    platform_2.update(delta_time);
-    box_sprite.update(delta_time);
-    man.update(delta_time);
+    sphere_sprite.update(time_step);
+    platform_1.update(time_step);
+    platform_2.update(time_step);
+    box_sprite.update(time_step);
+    man.update(time_step);
 
     World::collide(sphere_sprite, platform_1);
     World::collide(man, platform_1);
@@ -94,21 +95,45 @@ void PhysixScreen::update(double delta_time)
     World::collide(man, box_sprite);
 
     World::collide(box_sprite, sphere_sprite);
+}
+
+void PhysixScreen::update(double delta_time)
+{
+    RinvidGfx::clear_screen(0.2F, 0.8F, 0.8F, 1.0F);
 
-    sphere_sprite.draw(delta_time);
-    platform_1.draw(delta_time);
-    box_sprite.draw(delta_time);
-    man.draw(delta_time);
-    platform_2.draw(delta_time);
+    const auto alpha = static_cast<float>(get_interpolation_alpha());
+    sphere_sprite.draw_interpolated(alpha, delta_time);
+    platform_1.draw_interpolated(alpha, delta_time);
+    box_sprite.draw_interpolated(alpha, delta_time);
+    man.draw_interpolated(alpha, delta_time);
+    platform_2.draw_interpolated(alpha, delta_time);
 }
 
 void PhysixScreen::destroy()
 {
 }
 
-int main()
+int main(int argc, char** argv)
 {
     Application physix_app{800, 600, "Physix example"};
+    // Physics runs at 120 Hz regardless of frame rate, so jumps and collisions behave the same on
+    // every machine
+    physix_app.set_fixed_time_step(1.0 / 120.0);
+
+    // --record <file> saves the session, --replay <file> plays it back exactly
+    if (argc == 3)
+    {
+        const std::string option{argv[1]};
+        if (option == "--record")
+        {
+            physix_app.record_input(argv[2]);
+        }
+        else if (option == "--replay")
+        {
+            physix_app.replay_input(argv[2]);
+        }
+    }
+
     physix_app.set_screen(std::make_unique<PhysixScreen>());
     physix_app.run();
 
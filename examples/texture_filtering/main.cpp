@@ -0,0 +1,251 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "core/include/application.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/rinvid_gl.h"
+#include "core/include/screen.h"
+#include "core/include/sprite.h"
+#include "core/include/texture.h"
+#include "system/include/keyboard.h"
+#include "util/include/vector2.h"
+
+using namespace rinvid;
+using namespace rinvid::system;
+
+constexpr std::int32_t  GRID_COLUMNS{20};
+constexpr std::int32_t  GRID_ROWS{15};
+constexpr float         DEFAULT_SCALE{0.01F};
+constexpr std::uint32_t BENCHMARK_WARMUP_FRAMES{60U};
+constexpr std::uint32_t BENCHMARK_MEASURED_FRAMES{300U};
+
+enum class FilterMode
+{
+    Linear = 0U,
+    Nearest,
+    Mipmapped
+};
+
+static const char* mode_name(FilterMode mode)
+{
+    switch (mode)
+    {
+        case FilterMode::Linear:
+            return "linear";
+        case FilterMode::Nearest:
+            return "nearest";
+        case FilterMode::Mipmapped:
+            return "linear with mipmaps";
+    }
+
+    return "";
+}
+
+class TextureFilteringScreen : public rinvid::Screen
+{
+  public:
+    TextureFilteringScreen(bool benchmark);
+    void create() override;
+    void destroy() override;
+
+  private:
+    void update(double delta_time) override;
+    void update_benchmark(double frame_time);
+    void set_mode(FilterMode mode);
+    void create_sprites(Texture* texture, std::vector<Sprite>& sprites);
+
+    // Mipmaps can't be removed from a texture, so there is one texture with and one without them
+    std::unique_ptr<Texture> texture_;
+    std::unique_ptr<Texture> mipmapped_texture_;
+    std::vector<Sprite>      sprites_;
+    std::vector<Sprite>      mipmapped_sprites_;
+    FilterMode               mode_;
+    float                    scale_;
+    bool                     benchmark_;
+    std::uint32_t            benchmark_frame_;
+    double                   benchmark_total_time_;
+};
+
+TextureFilteringScreen::TextureFilteringScreen(bool benchmark)
+    : texture_{nullptr}, mipmapped_texture_{nullptr}, sprites_{}, mipmapped_sprites_{},
+      mode_{FilterMode::Linear}, scale_{DEFAULT_SCALE}, benchmark_{benchmark}, benchmark_frame_{0U},
+      benchmark_total_time_{0.0}
+{
+}
+
+void TextureFilteringScreen::create()
+{
+    texture_           = std::make_unique<Texture>("resources/trashbot.png");
+    mipmapped_texture_ = std::make_unique<Texture>("resources/trashbot.png", true);
+
+    create_sprites(texture_.get(), sprites_);
+    create_sprites(mipmapped_texture_.get(), mipmapped_sprites_);
+
+    set_mode(FilterMode::Linear);
+}
+
+void TextureFilteringScreen::create_sprites(Texture* texture, std::vector<Sprite>& sprites)
+{
+    const std::int32_t width  = texture->get_width();
+    const std::int32_t height = texture->get_height();
+    const float        cell_width{800.0F / GRID_COLUMNS};
+    const float        cell_height{600.0F / GRID_ROWS};
+
+    sprites.reserve(GRID_COLUMNS * GRID_ROWS);
+    for (std::int32_t row{0}; row < GRID_ROWS; ++row)
+    {
+        for (std::int32_t column{0}; column < GRID_COLUMNS; ++column)
+        {
+            // Sprites are scaled around their center, so position is chosen for the center to
+            // land in the middle of the cell
+            Vector2f center{(column + 0.5F) * cell_width, (row + 0.5F) * cell_height};
+            Vector2f top_left{center.x - width / 2.0F, center.y - height / 2.0F};
+            sprites.emplace_back(texture, width, height, top_left);
+            sprites.back().set_scale(scale_);
+        }
+    }
+}
+
+void TextureFilteringScreen::set_mode(FilterMode mode)
+{
+    mode_ = mode;
+
+    if (mode_ == FilterMode::Nearest)
+    {
+        texture_->set_filter(TextureFilter::Nearest, TextureFilter::Nearest);
+    }
+    else
+    {
+        texture_->set_filter(TextureFilter::Linear, TextureFilter::Linear);
+    }
+
+    std::cout << "Filter mode: " << mode_name(mode_) << '\n';
+}
+
+void TextureFilteringScreen::update(double delta_time)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    RinvidGfx::clear_screen(0.2F, 0.4F, 0.4F, 1.0F);
+
+    if (!benchmark_)
+    {
+        if (Keyboard::is_key_pressed(Keyboard::Key::Num1))
+        {
+            set_mode(FilterMode::Linear);
+        }
+        else if (Keyboard::is_key_pressed(Keyboard::Key::Num2))
+        {
+            set_mode(FilterMode::Nearest);
+        }
+        else if (Keyboard::is_key_pressed(Keyboard::Key::Num3))
+        {
+            set_mode(FilterMode::Mipmapped);
+        }
+
+        float zoom = 1.0F;
+        if (Keyboard::is_key_pressed(Keyboard::Key::W))
+        {
+            zoom += static_cast<float>(delta_time);
+        }
+        else if (Keyboard::is_key_pressed(Keyboard::Key::S))
+        {
+            zoom -= static_cast<float>(delta_time);
+        }
+
+        if (zoom != 1.0F)
+        {
+            scale_ = std::clamp(scale_ * zoom, 0.002F, 0.05F);
+            for (auto& sprite : sprites_)
+            {
+                sprite.set_scale(scale_);
+            }
+            for (auto& sprite : mipmapped_sprites_)
+            {
+                sprite.set_scale(scale_);
+            }
+        }
+    }
+
+    auto& sprites = (mode_ == FilterMode::Mipmapped) ? mipmapped_sprites_ : sprites_;
+    for (auto& sprite : sprites)
+    {
+        sprite.draw();
+    }
+
+    if (benchmark_)
+    {
+        // Wait for the GPU so that frame time includes the texture sampling it has queued
+        GL_CALL(glFinish());
+        auto                          end        = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double> frame_time = end - start;
+        update_benchmark(frame_time.count());
+    }
+}
+
+void TextureFilteringScreen::update_benchmark(double frame_time)
+{
+    ++benchmark_frame_;
+    if (benchmark_frame_ <= BENCHMARK_WARMUP_FRAMES)
+    {
+        return;
+    }
+
+    benchmark_total_time_ += frame_time;
+
+    if (benchmark_frame_ < BENCHMARK_WARMUP_FRAMES + BENCHMARK_MEASURED_FRAMES)
+    {
+        return;
+    }
+
+    std::cout << "Average frame time (" << mode_name(mode_) << ", " << sprites_.size()
+              << " sprites at scale " << scale_
+              << "): " << (benchmark_total_time_ / BENCHMARK_MEASURED_FRAMES) * 1000.0 << " ms\n";
+
+    benchmark_frame_      = 0U;
+    benchmark_total_time_ = 0.0;
+
+    if (mode_ == FilterMode::Mipmapped)
+    {
+        get_application()->exit();
+    }
+    else
+    {
+        set_mode(static_cast<FilterMode>(static_cast<std::uint32_t>(mode_) + 1U));
+    }
+}
+
+void TextureFilteringScreen::destroy()
+{
+    sprites_.clear();
+    mipmapped_sprites_.clear();
+    texture_.reset();
+    mipmapped_texture_.reset();
+}
+
+int main(int argc, char** argv)
+{
+    bool benchmark = (argc > 1) && (std::strcmp(argv[1], "--benchmark") == 0);
+
+    std::uint16_t fps = benchmark ? 0U : 60U;
+
+    Application texture_filtering_app{800, 600, "Texture filtering example", false, fps};
+    texture_filtering_app.set_screen(std::make_unique<TextureFilteringScreen>(benchmark));
+    texture_filtering_app.run();
+
+    return 0;
+}
@@ -9,8 +9,6 @@
 
 #include <iostream>
 
-#include <SFML/Window.hpp>
-
 #include "include/button.h"
 #include "system/include/mouse.h"
 #include "util/include/collision_detection.h"
@@ -33,17 +31,16 @@ Button::Button() : idle_{}, mouse_hovering_{}, clicked_{}, is_clicked_{false}, j
 
 void Button::update_state()
 {
-    Vector2f    mouse_pos = system::Mouse::get_mouse_pos();
-    glm::vec4   glm_mouse_pos{mouse_pos.x, mouse_pos.y, 1.0F, 1.0F};
-    const auto& view = glm::inverse(RinvidGfx::get_view());
-    glm_mouse_pos    = view * glm_mouse_pos;
-    mouse_pos.x      = glm_mouse_pos.x;
-    mouse_pos.y      = glm_mouse_pos.y;
-    rinvid::Rect position_rect{mouse_pos, 1, 1};
-
-    if (intersects(bounding_rect(), position_rect))
+    rinvid::Rect position_rect{system::Mouse::get_mouse_world_pos(), 1, 1};
+
+    update_state(intersects(bounding_rect(), position_rect));
+}
+
+void Button::update_state(bool mouse_over)
+{
+    if (mouse_over)
     {
-        if (sf::Mouse::isButtonPressed(sf::Mouse::Left))
+        if (system::Mouse::is_button_pressed(system::Mouse::Left))
         {
             if (!is_clicked_)
             {
@@ -0,0 +1,77 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+
+#include "include/button_group.h"
+#include "system/include/mouse.h"
+
+namespace rinvid
+{
+
+namespace gui
+{
+
+// Buttons rarely move, so their rects need no fattening
+ButtonGroup::ButtonGroup() : tree_{0.0F}, proxies_{}, hovered_{}, previously_hovered_{}
+{
+}
+
+void ButtonGroup::add(Button& button)
+{
+    proxies_.emplace_back(&button, tree_.create_proxy(button.bounding_rect(), &button));
+}
+
+void ButtonGroup::remove(Button& button)
+{
+    auto proxy = std::find_if(proxies_.begin(), proxies_.end(),
+                              [&button](const auto& entry) { return entry.first == &button; });
+    if (proxy == proxies_.end())
+    {
+        return;
+    }
+
+    tree_.destroy_proxy(proxy->second);
+    proxies_.erase(proxy);
+    hovered_.erase(std::remove(hovered_.begin(), hovered_.end(), &button), hovered_.end());
+}
+
+void ButtonGroup::refit()
+{
+    tree_.refit([](Button* button) { return button->bounding_rect(); });
+}
+
+void ButtonGroup::update_states()
+{
+    previously_hovered_.swap(hovered_);
+    hovered_.clear();
+
+    tree_.query_point(system::Mouse::get_mouse_world_pos(), [this](std::int32_t, Button* button) {
+        hovered_.push_back(button);
+        return true;
+    });
+
+    for (auto* button : hovered_)
+    {
+        button->update_state(true);
+    }
+
+    // Buttons the mouse has never been over are already idle
+    for (auto* button : previously_hovered_)
+    {
+        if (std::find(hovered_.begin(), hovered_.end(), button) == hovered_.end())
+        {
+            button->update_state(false);
+        }
+    }
+}
+
+} // namespace gui
+
+} // namespace rinvid
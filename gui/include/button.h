@@ -37,6 +37,15 @@ class Button : public Sprite
      *************************************************************************************************/
     void update_state();
 
+    /**************************************************************************************************
+     * @brief Updates the button status (clicked status and animation), with hit testing already
+     * done by the caller (e.g. ButtonGroup).
+     *
+     * @param mouse_over Is the mouse over the button
+     *
+     *************************************************************************************************/
+    void update_state(bool mouse_over);
+
     /**************************************************************************************************
      * @brief Sets animation regions for idle status (mouse is not hovering over button).
      *
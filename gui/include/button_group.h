@@ -0,0 +1,78 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef GUI_INCLUDE_BUTTON_GROUP_H
+#define GUI_INCLUDE_BUTTON_GROUP_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gui/include/button.h"
+#include "platformers/include/aabb_tree.h"
+
+namespace rinvid
+{
+
+namespace gui
+{
+
+/**************************************************************************************************
+ * @brief Updates states of many buttons at once. Buttons are kept in an AabbTree, so finding the
+ * ones under the mouse doesn't test every button, and only buttons under the mouse now or on the
+ * previous update are updated.
+ *
+ *************************************************************************************************/
+class ButtonGroup
+{
+  public:
+    ButtonGroup();
+
+    /**************************************************************************************************
+     * @brief Adds a button to the group. Button must stay alive until it is removed, or the group
+     * is destroyed.
+     *
+     * @param button Button to add
+     *
+     *************************************************************************************************/
+    void add(Button& button);
+
+    /**************************************************************************************************
+     * @brief Removes a button from the group.
+     *
+     * @param button Button to remove
+     *
+     *************************************************************************************************/
+    void remove(Button& button);
+
+    /**************************************************************************************************
+     * @brief Updates bounds of all buttons. Call it after moving or resizing buttons.
+     *
+     *************************************************************************************************/
+    void refit();
+
+    /**************************************************************************************************
+     * @brief Updates the status (clicked status and animation) of buttons the mouse is over, and
+     * of buttons it has left since the previous call.
+     *
+     *************************************************************************************************/
+    void update_states();
+
+  private:
+    AabbTree<Button*>                             tree_;
+    std::vector<std::pair<Button*, std::int32_t>> proxies_;
+    std::vector<Button*>                          hovered_;
+    std::vector<Button*>                          previously_hovered_;
+};
+
+} // namespace gui
+
+} // namespace rinvid
+
+#endif // GUI_INCLUDE_BUTTON_GROUP_H
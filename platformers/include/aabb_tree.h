@@ -0,0 +1,715 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef PLATFORMERS_INCLUDE_AABB_TREE_H
+#define PLATFORMERS_INCLUDE_AABB_TREE_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "util/include/rect.h"
+#include "util/include/vector2.h"
+
+namespace rinvid
+{
+
+/// Margin rects are fattened by if none is set.
+constexpr float DEFAULT_AABB_TREE_MARGIN{8.0F};
+
+/**************************************************************************************************
+ * @brief Dynamic bounding volume tree. Each proxy is a rect with data attached (e.g. an object),
+ * stored in a leaf, and each inner node bounds its two children. Region, point and ray queries
+ * only descend into nodes they touch, so they take logarithmic time. Tree is kept balanced by
+ * rotations as proxies come and go.
+ *
+ * Leaves are fattened by a margin, so moving a proxy only touches the tree once it leaves its fat
+ * rect. Queries test the exact rects of leaves, so fattening never shows in results.
+ *
+ * Edges count as inside, as with intersects.
+ *
+ *************************************************************************************************/
+template <typename T>
+class AabbTree
+{
+  public:
+    /**************************************************************************************************
+     * @brief Constructor.
+     *
+     * @param margin How much rects are fattened by on each side. Bigger margins make moving
+     * proxies cheaper and queries slower.
+     *
+     *************************************************************************************************/
+    explicit AabbTree(float margin = DEFAULT_AABB_TREE_MARGIN)
+        : nodes_{}, free_nodes_{}, root_{NULL_NODE}, proxy_count_{0U}, margin_{margin}
+    {
+    }
+
+    /**************************************************************************************************
+     * @brief Adds a proxy.
+     *
+     * @param rect Bounds of the proxy
+     * @param data Data returned by queries for this proxy
+     *
+     * @return Proxy id, stays the same until the proxy is destroyed
+     *
+     *************************************************************************************************/
+    std::int32_t create_proxy(const Rect& rect, const T& data)
+    {
+        const std::int32_t proxy = allocate_node();
+        Node&              node  = nodes_[proxy];
+        node.rect                = to_aabb(rect);
+        node.aabb                = fatten(node.rect);
+        node.data                = data;
+        node.height              = 0;
+
+        insert_leaf(proxy);
+        ++proxy_count_;
+
+        return proxy;
+    }
+
+    /**************************************************************************************************
+     * @brief Removes a proxy.
+     *
+     * @param proxy Proxy id
+     *
+     *************************************************************************************************/
+    void destroy_proxy(std::int32_t proxy)
+    {
+        remove_leaf(proxy);
+        free_node(proxy);
+        --proxy_count_;
+    }
+
+    /**************************************************************************************************
+     * @brief Updates bounds of a proxy. Tree only changes if the new rect doesn't fit into the fat
+     * rect of the proxy.
+     *
+     * @param proxy Proxy id
+     * @param rect New bounds
+     *
+     * @return true if proxy was reinserted, false if it still fit
+     *
+     *************************************************************************************************/
+    bool move_proxy(std::int32_t proxy, const Rect& rect)
+    {
+        Node& node = nodes_[proxy];
+        node.rect  = to_aabb(rect);
+        if (contains(node.aabb, node.rect))
+        {
+            return false;
+        }
+
+        remove_leaf(proxy);
+        nodes_[proxy].aabb = fatten(nodes_[proxy].rect);
+        insert_leaf(proxy);
+
+        return true;
+    }
+
+    /**************************************************************************************************
+     * @brief Moves every proxy to the rect get_rect returns for its data, e.g. once per step after
+     * objects have moved.
+     *
+     * @param get_rect Function taking data of a proxy and returning its current bounds
+     *
+     *************************************************************************************************/
+    template <typename GetRect>
+    void refit(GetRect get_rect)
+    {
+        // Leaves keep their ids when reinserted, nodes added meanwhile are never leaves
+        const auto node_count = static_cast<std::int32_t>(nodes_.size());
+        for (std::int32_t index{0}; index < node_count; ++index)
+        {
+            if (nodes_[index].height == 0)
+            {
+                move_proxy(index, get_rect(nodes_[index].data));
+            }
+        }
+    }
+
+    /**************************************************************************************************
+     * @brief Returns data of a proxy.
+     *
+     * @param proxy Proxy id
+     *
+     * @return Data passed to create_proxy
+     *
+     *************************************************************************************************/
+    const T& get_data(std::int32_t proxy) const
+    {
+        return nodes_[proxy].data;
+    }
+
+    /**************************************************************************************************
+     * @brief Returns number of proxies.
+     *
+     * @return Number of proxies
+     *
+     *************************************************************************************************/
+    std::uint32_t get_proxy_count() const
+    {
+        return proxy_count_;
+    }
+
+    /**************************************************************************************************
+     * @brief Returns height of the tree, 0 if it holds at most one proxy.
+     *
+     * @return Height of the tree
+     *
+     *************************************************************************************************/
+    std::int32_t get_height() const
+    {
+        return (root_ == NULL_NODE) ? 0 : nodes_[root_].height;
+    }
+
+    /**************************************************************************************************
+     * @brief Removes all proxies.
+     *
+     *************************************************************************************************/
+    void clear()
+    {
+        nodes_.clear();
+        free_nodes_.clear();
+        root_        = NULL_NODE;
+        proxy_count_ = 0U;
+    }
+
+    /**************************************************************************************************
+     * @brief Calls callback for each proxy intersecting a rect.
+     *
+     * @param rect Region to query
+     * @param callback Function taking proxy id and data, returning false to stop the query
+     *
+     *************************************************************************************************/
+    template <typename Callback>
+    void query(const Rect& rect, Callback callback) const
+    {
+        query(to_aabb(rect), callback);
+    }
+
+    /**************************************************************************************************
+     * @brief Calls callback for each proxy containing a point.
+     *
+     * @param point Point to query
+     * @param callback Function taking proxy id and data, returning false to stop the query
+     *
+     *************************************************************************************************/
+    template <typename Callback>
+    void query_point(Vector2f point, Callback callback) const
+    {
+        query(Aabb{point.x, point.y, point.x, point.y}, callback);
+    }
+
+    /**************************************************************************************************
+     * @brief Calls callback for each proxy hit by the segment from start to end, in no particular
+     * order. Callback returns how far along the segment to keep looking, which lets it find the
+     * closest hit: returning the fraction of a hit skips proxies further away, returning 1 keeps
+     * the whole segment and returning 0 stops the ray cast.
+     *
+     * @param start Start of the ray
+     * @param end End of the ray
+     * @param callback Function taking data of a hit proxy and the fraction of the segment at which
+     * the ray enters it (0 if it starts inside), returning the new maximum fraction
+     *
+     *************************************************************************************************/
+    template <typename Callback>
+    void ray_cast(Vector2f start, Vector2f end, Callback callback) const
+    {
+        const Vector2f delta{end.x - start.x, end.y - start.y};
+        float          max_fraction{1.0F};
+
+        NodeStack stack{};
+        stack.push(root_);
+        while (!stack.empty())
+        {
+            const std::int32_t index = stack.pop();
+            if (index == NULL_NODE)
+            {
+                continue;
+            }
+
+            const Node& node = nodes_[index];
+            float       fraction{0.0F};
+            if (!segment_hits(node.aabb, start, delta, max_fraction, fraction))
+            {
+                continue;
+            }
+
+            if (node.height == 0)
+            {
+                if (!segment_hits(node.rect, start, delta, max_fraction, fraction))
+                {
+                    continue;
+                }
+
+                const float new_max_fraction = callback(node.data, fraction);
+                if (new_max_fraction <= 0.0F)
+                {
+                    return;
+                }
+                max_fraction = std::min(max_fraction, new_max_fraction);
+            }
+            else
+            {
+                stack.push(node.child_1);
+                stack.push(node.child_2);
+            }
+        }
+    }
+
+    /**************************************************************************************************
+     * @brief Calls callback once for each pair of proxies whose rects intersect.
+     *
+     * @param callback Function taking data of both proxies
+     *
+     *************************************************************************************************/
+    template <typename Callback>
+    void for_each_pair(Callback callback) const
+    {
+        const auto node_count = static_cast<std::int32_t>(nodes_.size());
+        for (std::int32_t index{0}; index < node_count; ++index)
+        {
+            if (nodes_[index].height != 0)
+            {
+                continue;
+            }
+
+            // Each pair is found from both of its proxies, only the lower id reports it
+            auto report = [this, index, &callback](std::int32_t other, const T& data) {
+                if (other > index)
+                {
+                    callback(nodes_[index].data, data);
+                }
+                return true;
+            };
+            query(nodes_[index].rect, report);
+        }
+    }
+
+  private:
+    static constexpr std::int32_t NULL_NODE{-1};
+    static constexpr std::int32_t FREE_NODE_HEIGHT{-1};
+
+    struct Aabb
+    {
+        float min_x;
+        float min_y;
+        float max_x;
+        float max_y;
+    };
+
+    struct Node
+    {
+        /// Fat bounds for leaves, bounds of both children for inner nodes
+        Aabb         aabb;
+        /// Exact bounds, leaves only
+        Aabb         rect;
+        T            data;
+        std::int32_t parent;
+        std::int32_t child_1;
+        std::int32_t child_2;
+        /// 0 for leaves, -1 for free nodes
+        std::int32_t height;
+    };
+
+    // Stack of nodes to visit, on the stack of the caller unless the tree is unusually deep
+    class NodeStack
+    {
+      public:
+        NodeStack() : nodes_{}, size_{0U}, overflow_{}
+        {
+        }
+
+        void push(std::int32_t node)
+        {
+            if (size_ < nodes_.size())
+            {
+                nodes_[size_++] = node;
+            }
+            else
+            {
+                overflow_.push_back(node);
+            }
+        }
+
+        std::int32_t pop()
+        {
+            if (!overflow_.empty())
+            {
+                const std::int32_t node = overflow_.back();
+                overflow_.pop_back();
+                return node;
+            }
+
+            return nodes_[--size_];
+        }
+
+        bool empty() const
+        {
+            return (size_ == 0U) && overflow_.empty();
+        }
+
+      private:
+        std::array<std::int32_t, 64> nodes_;
+        std::size_t                  size_;
+        std::vector<std::int32_t>    overflow_;
+    };
+
+    static Aabb to_aabb(const Rect& rect)
+    {
+        return Aabb{rect.position.x, rect.position.y, rect.position.x + rect.width,
+                    rect.position.y + rect.height};
+    }
+
+    static Aabb combine(const Aabb& a, const Aabb& b)
+    {
+        return Aabb{std::min(a.min_x, b.min_x), std::min(a.min_y, b.min_y),
+                    std::max(a.max_x, b.max_x), std::max(a.max_y, b.max_y)};
+    }
+
+    static float perimeter(const Aabb& aabb)
+    {
+        return 2.0F * ((aabb.max_x - aabb.min_x) + (aabb.max_y - aabb.min_y));
+    }
+
+    static bool overlaps(const Aabb& a, const Aabb& b)
+    {
+        return (a.min_x <= b.max_x) && (b.min_x <= a.max_x) && (a.min_y <= b.max_y) &&
+               (b.min_y <= a.max_y);
+    }
+
+    static bool contains(const Aabb& outer, const Aabb& inner)
+    {
+        return (outer.min_x <= inner.min_x) && (outer.min_y <= inner.min_y) &&
+               (inner.max_x <= outer.max_x) && (inner.max_y <= outer.max_y);
+    }
+
+    // Slab test, fraction is where the segment enters the box
+    static bool segment_hits(const Aabb& aabb, Vector2f start, Vector2f delta, float max_fraction,
+                             float& fraction)
+    {
+        float enter{0.0F};
+        float exit{max_fraction};
+
+        const std::array<float, 2> starts{start.x, start.y};
+        const std::array<float, 2> deltas{delta.x, delta.y};
+        const std::array<float, 2> mins{aabb.min_x, aabb.min_y};
+        const std::array<float, 2> maxs{aabb.max_x, aabb.max_y};
+        for (std::size_t axis{0U}; axis < 2U; ++axis)
+        {
+            if (deltas[axis] == 0.0F)
+            {
+                if ((starts[axis] < mins[axis]) || (starts[axis] > maxs[axis]))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            const float inverse_delta = 1.0F / deltas[axis];
+            float       near          = (mins[axis] - starts[axis]) * inverse_delta;
+            float       far           = (maxs[axis] - starts[axis]) * inverse_delta;
+            if (near > far)
+            {
+                std::swap(near, far);
+            }
+
+            enter = std::max(enter, near);
+            exit  = std::min(exit, far);
+            if (enter > exit)
+            {
+                return false;
+            }
+        }
+
+        fraction = enter;
+
+        return true;
+    }
+
+    Aabb fatten(const Aabb& aabb) const
+    {
+        return Aabb{aabb.min_x - margin_, aabb.min_y - margin_, aabb.max_x + margin_,
+                    aabb.max_y + margin_};
+    }
+
+    template <typename Callback>
+    void query(const Aabb& aabb, Callback& callback) const
+    {
+        NodeStack stack{};
+        stack.push(root_);
+        while (!stack.empty())
+        {
+            const std::int32_t index = stack.pop();
+            if (index == NULL_NODE)
+            {
+                continue;
+            }
+
+            const Node& node = nodes_[index];
+            if (!overlaps(node.aabb, aabb))
+            {
+                continue;
+            }
+
+            if (node.height == 0)
+            {
+                if (overlaps(node.rect, aabb) && !callback(index, node.data))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                stack.push(node.child_1);
+                stack.push(node.child_2);
+            }
+        }
+    }
+
+    std::int32_t allocate_node()
+    {
+        std::int32_t index{};
+        if (free_nodes_.empty())
+        {
+            index = static_cast<std::int32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+        else
+        {
+            index = free_nodes_.back();
+            free_nodes_.pop_back();
+        }
+
+        Node& node   = nodes_[index];
+        node.parent  = NULL_NODE;
+        node.child_1 = NULL_NODE;
+        node.child_2 = NULL_NODE;
+        node.height  = 0;
+
+        return index;
+    }
+
+    void free_node(std::int32_t index)
+    {
+        nodes_[index].height = FREE_NODE_HEIGHT;
+        nodes_[index].data   = T{};
+        free_nodes_.push_back(index);
+    }
+
+    void insert_leaf(std::int32_t leaf)
+    {
+        if (root_ == NULL_NODE)
+        {
+            root_               = leaf;
+            nodes_[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        // Finds the sibling which grows the total perimeter of inner nodes the least
+        const Aabb   leaf_aabb = nodes_[leaf].aabb;
+        std::int32_t index     = root_;
+        while (nodes_[index].height > 0)
+        {
+            const Node& node     = nodes_[index];
+            const float combined = perimeter(combine(node.aabb, leaf_aabb));
+
+            // Cost of making a new parent for this node and the leaf
+            const float cost = 2.0F * combined;
+            // Cost every node below this one pays for growing it
+            const float inheritance_cost = 2.0F * (combined - perimeter(node.aabb));
+
+            const float cost_1 = descent_cost(node.child_1, leaf_aabb) + inheritance_cost;
+            const float cost_2 = descent_cost(node.child_2, leaf_aabb) + inheritance_cost;
+
+            if ((cost < cost_1) && (cost < cost_2))
+            {
+                break;
+            }
+
+            index = (cost_1 < cost_2) ? node.child_1 : node.child_2;
+        }
+
+        const std::int32_t sibling    = index;
+        const std::int32_t old_parent = nodes_[sibling].parent;
+        const std::int32_t new_parent = allocate_node();
+        nodes_[new_parent].parent     = old_parent;
+        nodes_[new_parent].aabb       = combine(leaf_aabb, nodes_[sibling].aabb);
+        nodes_[new_parent].height     = nodes_[sibling].height + 1;
+        nodes_[new_parent].child_1    = sibling;
+        nodes_[new_parent].child_2    = leaf;
+        nodes_[sibling].parent        = new_parent;
+        nodes_[leaf].parent           = new_parent;
+
+        if (old_parent == NULL_NODE)
+        {
+            root_ = new_parent;
+        }
+        else if (nodes_[old_parent].child_1 == sibling)
+        {
+            nodes_[old_parent].child_1 = new_parent;
+        }
+        else
+        {
+            nodes_[old_parent].child_2 = new_parent;
+        }
+
+        refit_ancestors(new_parent);
+    }
+
+    float descent_cost(std::int32_t child, const Aabb& leaf_aabb) const
+    {
+        const Aabb combined = combine(leaf_aabb, nodes_[child].aabb);
+        if (nodes_[child].height == 0)
+        {
+            return perimeter(combined);
+        }
+
+        return perimeter(combined) - perimeter(nodes_[child].aabb);
+    }
+
+    void remove_leaf(std::int32_t leaf)
+    {
+        if (leaf == root_)
+        {
+            root_ = NULL_NODE;
+            return;
+        }
+
+        const std::int32_t parent      = nodes_[leaf].parent;
+        const std::int32_t grandparent = nodes_[parent].parent;
+        const std::int32_t sibling =
+            (nodes_[parent].child_1 == leaf) ? nodes_[parent].child_2 : nodes_[parent].child_1;
+
+        // Sibling takes the place of the parent
+        nodes_[sibling].parent = grandparent;
+        free_node(parent);
+
+        if (grandparent == NULL_NODE)
+        {
+            root_ = sibling;
+            return;
+        }
+
+        if (nodes_[grandparent].child_1 == parent)
+        {
+            nodes_[grandparent].child_1 = sibling;
+        }
+        else
+        {
+            nodes_[grandparent].child_2 = sibling;
+        }
+
+        refit_ancestors(grandparent);
+    }
+
+    // Walks up from index, balancing and updating bounds and heights
+    void refit_ancestors(std::int32_t index)
+    {
+        while (index != NULL_NODE)
+        {
+            index = balance(index);
+
+            Node&       node    = nodes_[index];
+            const Node& child_1 = nodes_[node.child_1];
+            const Node& child_2 = nodes_[node.child_2];
+            node.aabb           = combine(child_1.aabb, child_2.aabb);
+            node.height         = 1 + std::max(child_1.height, child_2.height);
+
+            index = node.parent;
+        }
+    }
+
+    // Rotates the taller child of node a up if children differ in height by more than one.
+    // Returns the node now in the place of a.
+    std::int32_t balance(std::int32_t a)
+    {
+        if (nodes_[a].height < 2)
+        {
+            return a;
+        }
+
+        const std::int32_t b       = nodes_[a].child_1;
+        const std::int32_t c       = nodes_[a].child_2;
+        const std::int32_t difference = nodes_[c].height - nodes_[b].height;
+
+        if (difference > 1)
+        {
+            return rotate(a, c, b, true);
+        }
+        if (difference < -1)
+        {
+            return rotate(a, b, c, false);
+        }
+
+        return a;
+    }
+
+    // Makes child (of node a, taller than other) the parent of a. Child keeps its taller child,
+    // a takes over the shorter one.
+    std::int32_t rotate(std::int32_t a, std::int32_t child, std::int32_t other,
+                        bool child_is_second)
+    {
+        const std::int32_t f = nodes_[child].child_1;
+        const std::int32_t g = nodes_[child].child_2;
+
+        nodes_[child].child_1 = a;
+        nodes_[child].parent  = nodes_[a].parent;
+        nodes_[a].parent      = child;
+
+        if (nodes_[child].parent == NULL_NODE)
+        {
+            root_ = child;
+        }
+        else if (nodes_[nodes_[child].parent].child_1 == a)
+        {
+            nodes_[nodes_[child].parent].child_1 = child;
+        }
+        else
+        {
+            nodes_[nodes_[child].parent].child_2 = child;
+        }
+
+        const bool         keep_f = nodes_[f].height > nodes_[g].height;
+        const std::int32_t kept   = keep_f ? f : g;
+        const std::int32_t given  = keep_f ? g : f;
+
+        nodes_[child].child_2 = kept;
+        if (child_is_second)
+        {
+            nodes_[a].child_2 = given;
+        }
+        else
+        {
+            nodes_[a].child_1 = given;
+        }
+        nodes_[given].parent = a;
+
+        nodes_[a].aabb   = combine(nodes_[other].aabb, nodes_[given].aabb);
+        nodes_[a].height = 1 + std::max(nodes_[other].height, nodes_[given].height);
+
+        nodes_[child].aabb   = combine(nodes_[a].aabb, nodes_[kept].aabb);
+        nodes_[child].height = 1 + std::max(nodes_[a].height, nodes_[kept].height);
+
+        return child;
+    }
+
+    std::vector<Node>         nodes_;
+    std::vector<std::int32_t> free_nodes_;
+    std::int32_t              root_;
+    std::uint32_t             proxy_count_;
+    float                     margin_;
+};
+
+} // namespace rinvid
+
+#endif // PLATFORMERS_INCLUDE_AABB_TREE_H
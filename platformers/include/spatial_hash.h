@@ -0,0 +1,128 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef PLATFORMERS_INCLUDE_SPATIAL_HASH_H
+#define PLATFORMERS_INCLUDE_SPATIAL_HASH_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "core/include/object.h"
+#include "util/include/rect.h"
+
+namespace rinvid
+{
+
+/// Cell size used if none is set, a few times the size of a typical object.
+constexpr float DEFAULT_SPATIAL_HASH_CELL_SIZE{64.0F};
+
+/**************************************************************************************************
+ * @brief Two objects whose bounding rects intersect.
+ *
+ *************************************************************************************************/
+struct ObjectPair
+{
+    Object* first;
+    Object* second;
+};
+
+/**************************************************************************************************
+ * @brief Broadphase for collisions between groups of objects. Bounding rects are put into the
+ * cells of a uniform grid they cover, and only objects sharing a cell are tested against each
+ * other, so cost grows with the number of objects instead of the number of their pairs.
+ *
+ * Grid is rebuilt from scratch on every query into memory kept from the previous one. Moving
+ * objects change cells every step anyway, and rebuilding is a single sort.
+ *
+ *************************************************************************************************/
+class SpatialHash
+{
+  public:
+    /**************************************************************************************************
+     * @brief Constructor.
+     *
+     * @param cell_size Width and height of a grid cell. Works best at a few times the size of
+     * most objects, an object covering many cells is stored in each of them. Default is used if
+     * it isn't positive and finite.
+     *
+     *************************************************************************************************/
+    explicit SpatialHash(float cell_size = DEFAULT_SPATIAL_HASH_CELL_SIZE);
+
+    /**************************************************************************************************
+     * @brief Sets width and height of a grid cell. A size that isn't positive and finite is
+     * logged as error and ignored.
+     *
+     * @param cell_size Cell size
+     *
+     *************************************************************************************************/
+    void set_cell_size(float cell_size);
+
+    /**************************************************************************************************
+     * @brief Returns width and height of a grid cell.
+     *
+     * @return Cell size
+     *
+     *************************************************************************************************/
+    float get_cell_size() const;
+
+    /**************************************************************************************************
+     * @brief Finds pairs of objects, one from each group, whose bounding rects intersect. Each pair
+     * is reported once, even if both objects are in both groups (e.g. a group colliding with
+     * itself), and an object is never paired with itself. First object of a pair comes from
+     * group_1, pairs are sorted by the order of their objects in the groups, so they come out the
+     * same on every run.
+     *
+     * @param group_1 First group
+     * @param group_2 Second group, can be the same as group_1
+     *
+     * @return Intersecting pairs, valid until the next call
+     *
+     *************************************************************************************************/
+    const std::vector<ObjectPair>& find_pairs(const std::vector<Object*>& group_1,
+                                              const std::vector<Object*>& group_2);
+
+  private:
+    struct Body
+    {
+        Object*      object;
+        Rect         rect;
+        std::uint8_t groups;
+    };
+
+    struct CellEntry
+    {
+        std::uint64_t cell;
+        std::uint32_t body;
+    };
+
+    struct BodyPair
+    {
+        std::uint32_t first;
+        std::uint32_t second;
+    };
+
+    void          add_body(Object* object, std::uint8_t group);
+    void          fill_cells();
+    void          find_pairs_in_cell(std::size_t begin, std::size_t end);
+    std::int32_t  to_cell(float coordinate) const;
+    std::uint64_t cell_key(std::int32_t x, std::int32_t y) const;
+
+    float                                            cell_size_;
+    float                                            inverse_cell_size_;
+    std::vector<Body>                                bodies_;
+    std::unordered_map<const Object*, std::uint32_t> body_indices_;
+    std::vector<CellEntry>                           cells_;
+    std::vector<BodyPair>                            body_pairs_;
+    std::vector<ObjectPair>                          pairs_;
+};
+
+} // namespace rinvid
+
+#endif // PLATFORMERS_INCLUDE_SPATIAL_HASH_H
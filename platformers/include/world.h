@@ -13,10 +13,14 @@
 #include <vector>
 
 #include "core/include/object.h"
+#include "platformers/include/aabb_tree.h"
+#include "platformers/include/spatial_hash.h"
 
 namespace rinvid
 {
 
+class BodyStore;
+
 typedef bool (*CollisionResolver)(Object&, Object&);
 
 class World
@@ -39,6 +43,17 @@ class World
      *************************************************************************************************/
     static void set_gravity(float gravity);
 
+    /**************************************************************************************************
+     * @brief Moves all bodies of a store by one step (see BodyStore::integrate). Objects attached
+     * to the store get their new position and velocity and are ready to collide, as after
+     * Object::update.
+     *
+     * @param store Bodies to move
+     * @param delta_time Length of the step in seconds
+     *
+     *************************************************************************************************/
+    static void integrate(BodyStore& store, double delta_time);
+
     /**************************************************************************************************
      * @brief Checks whether objects collide and handles collision via callback function.
      *
@@ -83,9 +98,10 @@ class World
                         CollisionResolver resolve = separate);
 
     /**************************************************************************************************
-     * @brief Checks whether object collides with group of objects and handles collisions via
-     * callback function.
-     * WARNING: This function is probably not optimal for large number of objects.
+     * @brief Checks whether objects of two groups collide and handles collisions via callback
+     * function. Candidate pairs are found with a spatial hash (see SpatialHash), from positions at
+     * the start of the call. Each pair is handled once, also when a group collides with itself.
+     * Safe to call from several threads, and from a resolver.
      *
      * @param group_1
      * @param group_2
@@ -98,6 +114,71 @@ class World
     static bool collide(const std::vector<Object*>& group_1, const std::vector<Object*>& group_2,
                         CollisionResolver resolve = separate);
 
+    /**************************************************************************************************
+     * @brief Same as colliding two groups, with a spatial hash owned by the caller, e.g. to give
+     * each collision layer its own cell size. Hash must not be used again until the call returns,
+     * neither by another thread nor by the resolver.
+     *
+     * @param group_1
+     * @param group_2
+     * @param broadphase Spatial hash to find candidate pairs with
+     * @param resolve Pointer to function that decides how to resolve collision when it happens.
+     * Default is to separate objects.
+     *
+     * @return True if any objects from groups collide.
+     *
+     *************************************************************************************************/
+    static bool collide(const std::vector<Object*>& group_1, const std::vector<Object*>& group_2,
+                        SpatialHash& broadphase, CollisionResolver resolve = separate);
+
+    /**************************************************************************************************
+     * @brief Checks whether object collides with objects in a tree and handles collisions via
+     * callback function. Only objects whose rects in the tree intersect the object are checked.
+     *
+     * @param object
+     * @param tree Tree of objects, e.g. level geometry. Object itself may be in it.
+     * @param resolve Pointer to function that decides how to resolve collision when it happens.
+     * Default is to separate objects.
+     *
+     * @return True if object collides with any of the objects in tree.
+     *
+     *************************************************************************************************/
+    static bool collide(Object& object, const AabbTree<Object*>& tree,
+                        CollisionResolver resolve = separate);
+
+    /**************************************************************************************************
+     * @brief Checks whether objects in a tree collide with each other and handles collisions via
+     * callback function. An alternative to colliding a group with itself, which pays off when
+     * most objects rarely move, as the tree is kept between steps. Call refit first.
+     *
+     * @param tree Tree of objects
+     * @param resolve Pointer to function that decides how to resolve collision when it happens.
+     * Default is to separate objects.
+     *
+     * @return True if any objects collide.
+     *
+     *************************************************************************************************/
+    static bool collide(const AabbTree<Object*>& tree, CollisionResolver resolve = separate);
+
+    /**************************************************************************************************
+     * @brief Moves objects in a tree to their current bounding rects. Call it once per step after
+     * objects have moved, before colliding with the tree.
+     *
+     * @param tree Tree of objects
+     *
+     *************************************************************************************************/
+    static void refit(AabbTree<Object*>& tree);
+
+    /**************************************************************************************************
+     * @brief Sets cell size of the spatial hashes used to collide groups, when no hash is given.
+     * A size that isn't positive and finite is logged as error and ignored.
+     *
+     * @param cell_size Width and height of a cell, a few times the size of most objects works best
+     * (default is 64)
+     *
+     *************************************************************************************************/
+    static void set_broadphase_cell_size(float cell_size);
+
     static float gravity;
 
     /**************************************************************************************************
@@ -0,0 +1,216 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "include/spatial_hash.h"
+#include "util/include/collision_detection.h"
+#include "util/include/error_handler.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+constexpr std::uint8_t IN_GROUP_1{0x1U};
+constexpr std::uint8_t IN_GROUP_2{0x2U};
+
+// Range of cell coordinates, float to int conversion of a value out of it is undefined. Largest
+// float below 2^31 is 2^31 - 128.
+constexpr float MIN_CELL{-2147483648.0F};
+constexpr float MAX_CELL{2147483520.0F};
+
+} // namespace
+
+SpatialHash::SpatialHash(float cell_size)
+    : cell_size_{DEFAULT_SPATIAL_HASH_CELL_SIZE},
+      inverse_cell_size_{1.0F / DEFAULT_SPATIAL_HASH_CELL_SIZE}, bodies_{}, body_indices_{},
+      cells_{}, body_pairs_{}, pairs_{}
+{
+    set_cell_size(cell_size);
+}
+
+void SpatialHash::set_cell_size(float cell_size)
+{
+    // Also rejects NaN
+    if (!(cell_size > 0.0F) || std::isinf(cell_size))
+    {
+        errors::put_error_to_log("SpatialHash: cell size must be positive and finite");
+        return;
+    }
+
+    cell_size_         = cell_size;
+    inverse_cell_size_ = 1.0F / cell_size;
+}
+
+float SpatialHash::get_cell_size() const
+{
+    return cell_size_;
+}
+
+const std::vector<ObjectPair>& SpatialHash::find_pairs(const std::vector<Object*>& group_1,
+                                                       const std::vector<Object*>& group_2)
+{
+    RINVID_PROFILE_ZONE("SpatialHash::find_pairs");
+
+    bodies_.clear();
+    body_indices_.clear();
+    cells_.clear();
+    body_pairs_.clear();
+    pairs_.clear();
+
+    // Objects in both groups are stored once, so they can't be paired with themselves and their
+    // pairs are found once
+    if (&group_1 == &group_2)
+    {
+        for (auto* object : group_1)
+        {
+            bodies_.push_back(Body{object, object->bounding_rect(), IN_GROUP_1 | IN_GROUP_2});
+        }
+    }
+    else
+    {
+        for (auto* object : group_1)
+        {
+            add_body(object, IN_GROUP_1);
+        }
+        for (auto* object : group_2)
+        {
+            add_body(object, IN_GROUP_2);
+        }
+    }
+
+    fill_cells();
+
+    std::size_t begin{0U};
+    while (begin < cells_.size())
+    {
+        std::size_t end{begin + 1U};
+        while ((end < cells_.size()) && (cells_[end].cell == cells_[begin].cell))
+        {
+            ++end;
+        }
+
+        find_pairs_in_cell(begin, end);
+        begin = end;
+    }
+
+    std::sort(body_pairs_.begin(), body_pairs_.end(), [](const BodyPair& a, const BodyPair& b) {
+        return (a.first != b.first) ? (a.first < b.first) : (a.second < b.second);
+    });
+
+    pairs_.reserve(body_pairs_.size());
+    for (const auto& pair : body_pairs_)
+    {
+        pairs_.push_back(ObjectPair{bodies_[pair.first].object, bodies_[pair.second].object});
+    }
+
+    return pairs_;
+}
+
+void SpatialHash::add_body(Object* object, std::uint8_t group)
+{
+    const auto result =
+        body_indices_.emplace(object, static_cast<std::uint32_t>(bodies_.size()));
+    if (result.second)
+    {
+        bodies_.push_back(Body{object, object->bounding_rect(), group});
+    }
+    else
+    {
+        bodies_[result.first->second].groups |= group;
+    }
+}
+
+void SpatialHash::fill_cells()
+{
+    for (std::uint32_t index{0U}; index < bodies_.size(); ++index)
+    {
+        const Rect&        rect  = bodies_[index].rect;
+        const std::int32_t min_x = to_cell(rect.position.x);
+        const std::int32_t min_y = to_cell(rect.position.y);
+        const std::int32_t max_x = to_cell(rect.position.x + rect.width);
+        const std::int32_t max_y = to_cell(rect.position.y + rect.height);
+
+        for (std::int32_t y{min_y}; y <= max_y; ++y)
+        {
+            for (std::int32_t x{min_x}; x <= max_x; ++x)
+            {
+                cells_.push_back(CellEntry{cell_key(x, y), index});
+            }
+        }
+    }
+
+    // Bodies of a cell stay in the order they were added, which pair order depends on
+    std::sort(cells_.begin(), cells_.end(), [](const CellEntry& a, const CellEntry& b) {
+        return (a.cell != b.cell) ? (a.cell < b.cell) : (a.body < b.body);
+    });
+}
+
+void SpatialHash::find_pairs_in_cell(std::size_t begin, std::size_t end)
+{
+    const std::uint64_t cell = cells_[begin].cell;
+
+    for (std::size_t i{begin}; i < end; ++i)
+    {
+        const Body& body_1 = bodies_[cells_[i].body];
+
+        for (std::size_t j{i + 1U}; j < end; ++j)
+        {
+            const Body& body_2 = bodies_[cells_[j].body];
+
+            const bool body_1_first =
+                ((body_1.groups & IN_GROUP_1) != 0U) && ((body_2.groups & IN_GROUP_2) != 0U);
+            const bool body_2_first =
+                ((body_2.groups & IN_GROUP_1) != 0U) && ((body_1.groups & IN_GROUP_2) != 0U);
+            if ((!body_1_first && !body_2_first) || !intersects(body_1.rect, body_2.rect))
+            {
+                continue;
+            }
+
+            // Objects sharing several cells are paired only in the one holding the top left
+            // corner of their overlap
+            const float overlap_x = std::max(body_1.rect.position.x, body_2.rect.position.x);
+            const float overlap_y = std::max(body_1.rect.position.y, body_2.rect.position.y);
+            if (cell_key(to_cell(overlap_x), to_cell(overlap_y)) != cell)
+            {
+                continue;
+            }
+
+            // Body of a lower index comes first when either order fits, as in a nested loop
+            if (body_1_first)
+            {
+                body_pairs_.push_back(BodyPair{cells_[i].body, cells_[j].body});
+            }
+            else
+            {
+                body_pairs_.push_back(BodyPair{cells_[j].body, cells_[i].body});
+            }
+        }
+    }
+}
+
+std::int32_t SpatialHash::to_cell(float coordinate) const
+{
+    // Far away objects share the outermost cells. std::max returns its first argument for NaN,
+    // which puts NaN in the first cell.
+    const float cell = std::floor(coordinate * inverse_cell_size_);
+    return static_cast<std::int32_t>(std::min(std::max(MIN_CELL, cell), MAX_CELL));
+}
+
+std::uint64_t SpatialHash::cell_key(std::int32_t x, std::int32_t y) const
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32U) |
+           static_cast<std::uint32_t>(y);
+}
+
+} // namespace rinvid
@@ -7,9 +7,18 @@
  * repository for more details.
  **********************************************************************/
 
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
 #include "include/world.h"
+#include "core/include/body_store.h"
 #include "core/include/object.h"
+#include "include/spatial_hash.h"
 #include "util/include/collision_detection.h"
+#include "util/include/error_handler.h"
+#include "util/include/profiler.h"
 
 namespace rinvid
 {
@@ -19,6 +28,13 @@ static constexpr float DEFAULT_OVERLAP_BIAS = 2.0F;
 
 static float OVERLAP_BIAS = DEFAULT_OVERLAP_BIAS;
 
+static std::atomic<float> broadphase_cell_size{DEFAULT_SPATIAL_HASH_CELL_SIZE};
+
+// A hash per thread and per nesting level, as a resolver may collide groups again while pairs of
+// the outer call are still being resolved
+static thread_local std::vector<std::unique_ptr<SpatialHash>> broadphases{};
+static thread_local std::size_t                               broadphase_depth{0U};
+
 float World::gravity{DEFAULT_GRAVITY};
 
 void World::set_gravity(float gravity)
@@ -29,6 +45,53 @@ void World::set_gravity(float gravity)
     OVERLAP_BIAS = static_cast<std::int32_t>(DEFAULT_OVERLAP_BIAS) << overlap_bias_factor;
 }
 
+void World::integrate(BodyStore& store, double delta_time)
+{
+    RINVID_PROFILE_ZONE("World::integrate");
+
+    const std::uint32_t count = store.get_count();
+
+    // Objects may have been moved or separated since the previous step
+    for (std::uint32_t i{0U}; i < count; ++i)
+    {
+        const Object* object = store.owners_[i];
+        if (object != nullptr)
+        {
+            store.position_x_[i] = object->position_.x;
+            store.position_y_[i] = object->position_.y;
+            store.velocity_x_[i] = object->velocity_.x;
+            store.velocity_y_[i] = object->velocity_.y;
+        }
+    }
+
+    store.integrate(delta_time);
+
+    // Same as Object::update does for objects it moves
+    for (std::uint32_t i{0U}; i < count; ++i)
+    {
+        Object* object = store.owners_[i];
+        if ((object != nullptr) && object->active_)
+        {
+            object->touching_          = NONE;
+            object->previous_position_ = Vector2f{store.previous_x_[i], store.previous_y_[i]};
+            object->position_          = Vector2f{store.position_x_[i], store.position_y_[i]};
+            object->velocity_          = Vector2f{store.velocity_x_[i], store.velocity_y_[i]};
+        }
+    }
+}
+
+void World::set_broadphase_cell_size(float cell_size)
+{
+    // Also rejects NaN
+    if (!(cell_size > 0.0F) || std::isinf(cell_size))
+    {
+        errors::put_error_to_log("World: broadphase cell size must be positive and finite");
+        return;
+    }
+
+    broadphase_cell_size = cell_size;
+}
+
 bool World::collide(Object& object_1, Object& object_2, CollisionResolver resolve)
 {
     if (intersects(object_1.bounding_rect(), object_2.bounding_rect()))
@@ -44,6 +107,8 @@ bool World::collide(Object& object_1, Object& object_2, CollisionResolver resolv
 
 bool World::collide(Object& object, const std::vector<Object*>& group, CollisionResolver resolve)
 {
+    RINVID_PROFILE_ZONE("World::collide");
+
     bool result = false;
 
     for (auto* group_object : group)
@@ -64,28 +129,79 @@ bool World::collide(const std::vector<Object*>& group, Object& object, Collision
     return World::collide(object, group, resolve);
 }
 
-/// @todo Think about optimizing this if it gets heavily used with many objects in the future.
 bool World::collide(const std::vector<Object*>& group_1, const std::vector<Object*>& group_2,
                     CollisionResolver resolve)
 {
+    if (broadphase_depth == broadphases.size())
+    {
+        broadphases.push_back(std::make_unique<SpatialHash>());
+    }
+
+    SpatialHash& broadphase = *broadphases[broadphase_depth];
+    broadphase.set_cell_size(broadphase_cell_size);
+
+    ++broadphase_depth;
+    bool result = World::collide(group_1, group_2, broadphase, resolve);
+    --broadphase_depth;
+
+    return result;
+}
+
+bool World::collide(const std::vector<Object*>& group_1, const std::vector<Object*>& group_2,
+                    SpatialHash& broadphase, CollisionResolver resolve)
+{
+    RINVID_PROFILE_ZONE("World::collide");
+
     bool result = false;
 
-    for (auto* group_1_object : group_1)
+    // Resolving earlier pairs moves objects, so each pair is checked again before it is resolved
+    for (const auto& pair : broadphase.find_pairs(group_1, group_2))
     {
-        for (auto* group_2_object : group_2)
-        {
-            if (group_1_object == group_2_object)
-            {
-                continue;
-            }
+        result |= World::collide(*pair.first, *pair.second, resolve);
+    }
+
+    return result;
+}
+
+bool World::collide(Object& object, const AabbTree<Object*>& tree, CollisionResolver resolve)
+{
+    RINVID_PROFILE_ZONE("World::collide");
+
+    bool result = false;
 
-            result |= World::collide(*group_1_object, *group_2_object, resolve);
+    // Objects are checked again, as resolving earlier collisions may have moved the object
+    tree.query(object.bounding_rect(), [&object, &result, resolve](std::int32_t, Object* other) {
+        if (other != &object)
+        {
+            result |= World::collide(object, *other, resolve);
         }
-    }
+        return true;
+    });
 
     return result;
 }
 
+bool World::collide(const AabbTree<Object*>& tree, CollisionResolver resolve)
+{
+    RINVID_PROFILE_ZONE("World::collide");
+
+    bool result = false;
+
+    // Resolving earlier pairs moves objects, so each pair is checked again before it is resolved
+    tree.for_each_pair([&result, resolve](Object* object_1, Object* object_2) {
+        result |= World::collide(*object_1, *object_2, resolve);
+    });
+
+    return result;
+}
+
+void World::refit(AabbTree<Object*>& tree)
+{
+    RINVID_PROFILE_ZONE("World::refit");
+
+    tree.refit([](Object* object) { return object->bounding_rect(); });
+}
+
 bool World::separate(Object& object_1, Object& object_2)
 {
     bool x_separated = separate_x(object_1, object_2);
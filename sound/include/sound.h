@@ -10,6 +10,7 @@
 #ifndef SYSTEM_INCLUDE_SOUND_H
 #define SYSTEM_INCLUDE_SOUND_H
 
+#include <memory>
 #include <string>
 
 #include <SFML/Audio.hpp>
@@ -33,6 +34,15 @@ class Sound
      *************************************************************************************************/
     Sound(const std::string& file_path);
 
+    /**************************************************************************************************
+     * @brief Sound constructor. Plays an already loaded buffer, which can be shared with other
+     * sounds (see ResourceManager).
+     *
+     * @param buffer Sound buffer to play.
+     *
+     *************************************************************************************************/
+    Sound(std::shared_ptr<const sf::SoundBuffer> buffer);
+
     /**************************************************************************************************
      * @brief Plays or resumes (if it has been paused) sound.
      *
@@ -66,8 +76,8 @@ class Sound
     void set_volume(float volume);
 
   private:
-    sf::SoundBuffer buffer_;
-    sf::Sound       sound_;
+    std::shared_ptr<const sf::SoundBuffer> buffer_;
+    sf::Sound                              sound_;
 };
 
 } // namespace rinvid::sound
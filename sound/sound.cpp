@@ -7,6 +7,8 @@
  * repository for more details.
  **********************************************************************/
 
+#include <utility>
+
 #include "include/sound.h"
 
 namespace rinvid::sound
@@ -14,12 +16,19 @@ namespace rinvid::sound
 
 Sound::Sound(const std::string& file_path)
 {
-    if (!buffer_.loadFromFile(file_path))
+    auto buffer = std::make_shared<sf::SoundBuffer>();
+    if (!buffer->loadFromFile(file_path))
     {
         throw "Error loading sound from file!";
     }
 
-    sound_.setBuffer(buffer_);
+    buffer_ = std::move(buffer);
+    sound_.setBuffer(*buffer_);
+}
+
+Sound::Sound(std::shared_ptr<const sf::SoundBuffer> buffer) : buffer_{std::move(buffer)}
+{
+    sound_.setBuffer(*buffer_);
 }
 
 void Sound::play()
@@ -0,0 +1,173 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef SYSTEM_INCLUDE_INPUT_RECORDING_H
+#define SYSTEM_INCLUDE_INPUT_RECORDING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "system/include/input_state.h"
+
+namespace rinvid
+{
+
+namespace system
+{
+
+/*
+ * Input recording (.rinp) file layout, all values little endian:
+ *
+ *   InputRecordingHeader
+ *   for each frame:
+ *     RecordedFrame
+ *     RecordedInputEvent * event_count
+ *
+ * Only events are stored, keys and buttons being down and their edges follow from replaying them.
+ */
+
+/// "RINP" read as a little endian integer
+constexpr std::uint32_t INPUT_RECORDING_MAGIC{0x504E4952U};
+constexpr std::uint32_t INPUT_RECORDING_VERSION{1U};
+
+struct InputRecordingHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+};
+
+struct RecordedFrame
+{
+    /// Delta time the frame was updated with, in seconds.
+    double        delta_time;
+    /// Mouse position at the end of the frame, in window coordinates.
+    float         mouse_x;
+    float         mouse_y;
+    std::uint32_t event_count;
+    std::uint32_t reserved;
+};
+
+struct RecordedInputEvent
+{
+    double       time;
+    float        x;
+    float        y;
+    std::int16_t code;
+    std::uint8_t type;
+    std::uint8_t reserved;
+};
+
+static_assert(sizeof(InputRecordingHeader) == 8U, "Input recording header must not be padded");
+static_assert(sizeof(RecordedFrame) == 24U, "Recorded frame must not be padded");
+static_assert(sizeof(RecordedInputEvent) == 24U, "Recorded input event must not be padded");
+
+/**************************************************************************************************
+ * @brief Writes input of each frame, together with its delta time, to a recording file.
+ *
+ *************************************************************************************************/
+class InputRecorder
+{
+  public:
+    InputRecorder();
+
+    /**************************************************************************************************
+     * @brief Creates a recording file, replacing an existing one.
+     *
+     * @param file_name Path to the file
+     *
+     * @return true if the file has been created, false otherwise
+     *
+     *************************************************************************************************/
+    bool open(const std::string& file_name);
+
+    /**************************************************************************************************
+     * @brief Checks whether a recording file is open.
+     *
+     * @return true if frames are being recorded, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_open() const;
+
+    /**************************************************************************************************
+     * @brief Appends a frame to the recording. Does nothing if no file is open.
+     *
+     * @param delta_time Delta time the frame is updated with, in seconds
+     * @param state Input of the frame
+     *
+     *************************************************************************************************/
+    void record_frame(double delta_time, const InputState& state);
+
+    /**************************************************************************************************
+     * @brief Writes out the remaining frames and closes the file.
+     *
+     *************************************************************************************************/
+    void close();
+
+  private:
+    std::ofstream file_;
+};
+
+/**************************************************************************************************
+ * @brief Replays a recording written by InputRecorder. The whole file is read up front, so
+ * replaying doesn't touch the disk while frames are measured.
+ *
+ *************************************************************************************************/
+class InputPlayer
+{
+  public:
+    InputPlayer();
+
+    /**************************************************************************************************
+     * @brief Loads a recording file and rewinds to its first frame.
+     *
+     * @param file_name Path to the file
+     *
+     * @return true if the file is a valid recording, false otherwise
+     *
+     *************************************************************************************************/
+    bool open(const std::string& file_name);
+
+    /**************************************************************************************************
+     * @brief Checks whether a recording is loaded.
+     *
+     * @return true if a recording is loaded, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_open() const;
+
+    /**************************************************************************************************
+     * @brief Replays the next frame into state, as if its events came from the window.
+     *
+     * @param delta_time Delta time the frame was updated with, in seconds
+     * @param state Input state to replay into, starts a new frame in it
+     *
+     * @return true if a frame has been replayed, false if the recording has ended or is corrupted
+     *
+     *************************************************************************************************/
+    bool next_frame(double& delta_time, InputState& state);
+
+    /**************************************************************************************************
+     * @brief Unloads the recording.
+     *
+     *************************************************************************************************/
+    void close();
+
+  private:
+    std::vector<std::uint8_t> data_;
+    std::size_t               offset_;
+};
+
+} // namespace system
+
+} // namespace rinvid
+
+#endif // SYSTEM_INCLUDE_INPUT_RECORDING_H
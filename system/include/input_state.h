@@ -0,0 +1,221 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef SYSTEM_INCLUDE_INPUT_STATE_H
+#define SYSTEM_INCLUDE_INPUT_STATE_H
+
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Window.hpp>
+
+#include "extern/glm/glm/mat4x4.hpp"
+#include "util/include/vector2.h"
+
+namespace rinvid
+{
+
+namespace system
+{
+
+/**************************************************************************************************
+ * @brief Input event, as recorded by InputState.
+ *
+ *************************************************************************************************/
+struct InputEvent
+{
+    enum class Type : std::uint8_t
+    {
+        KeyPressed,
+        KeyReleased,
+        ButtonPressed,
+        ButtonReleased,
+        MouseMoved
+    };
+
+    Type type;
+    /// Key or mouse button, unused for mouse moves.
+    std::int32_t code;
+    /// Mouse position in window coordinates.
+    Vector2f position;
+    /// Seconds since the application started running.
+    double time;
+};
+
+/**************************************************************************************************
+ * @brief State of keyboard and mouse, captured from window events once per frame. Reading it is a
+ * bit lookup, and everything read during a frame agrees, unlike querying devices directly.
+ *
+ * Keys and buttons that went down or up since the previous frame are kept as edges, so a press
+ * and release within one frame is still seen.
+ *
+ *************************************************************************************************/
+class InputState
+{
+  public:
+    static constexpr std::uint32_t KEY_COUNT{sf::Keyboard::KeyCount};
+    static constexpr std::uint32_t BUTTON_COUNT{sf::Mouse::ButtonCount};
+
+    InputState();
+
+    /**************************************************************************************************
+     * @brief Starts a new frame, forgetting edges and events of the previous one. Keys and buttons
+     * stay down.
+     *
+     *************************************************************************************************/
+    void begin_frame();
+
+    /**************************************************************************************************
+     * @brief Updates the state with a window event. Events that aren't about input are ignored.
+     * Losing focus releases everything, as releases that happen outside the window are not seen.
+     *
+     * @param event Window event
+     * @param time Seconds since the application started running
+     *
+     *************************************************************************************************/
+    void handle_event(const sf::Event& event, double time);
+
+    /**************************************************************************************************
+     * @brief Updates the state with an input event, e.g. one replayed from a recording.
+     *
+     * @param event Input event
+     *
+     *************************************************************************************************/
+    void handle_event(const InputEvent& event);
+
+    /**************************************************************************************************
+     * @brief Sets mouse position without an event, e.g. when the window is first shown.
+     *
+     * @param position Mouse position in window coordinates
+     *
+     *************************************************************************************************/
+    void set_mouse_pos(Vector2f position);
+
+    /**************************************************************************************************
+     * @brief Computes mouse position in world coordinates.
+     *
+     * @param view View matrix in use
+     *
+     *************************************************************************************************/
+    void update_mouse_world_pos(const glm::mat4& view);
+
+    /**************************************************************************************************
+     * @brief Adds a later frame to this state. Current keys, buttons and mouse position are taken
+     * from the later frame, edges and events of both frames are kept. Lets a reader which runs
+     * less often than frames (e.g. simulation thread) see every press.
+     *
+     * @param later State of a later frame
+     *
+     *************************************************************************************************/
+    void add(const InputState& later);
+
+    /**************************************************************************************************
+     * @brief Checks whether a key is down.
+     *
+     * @param key Key to check
+     *
+     * @return true if key is down, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_key_down(sf::Keyboard::Key key) const;
+
+    /**************************************************************************************************
+     * @brief Checks whether a key went down this frame.
+     *
+     * @param key Key to check
+     *
+     * @return true if key was pressed this frame, false otherwise
+     *
+     *************************************************************************************************/
+    bool was_key_pressed(sf::Keyboard::Key key) const;
+
+    /**************************************************************************************************
+     * @brief Checks whether a key went up this frame.
+     *
+     * @param key Key to check
+     *
+     * @return true if key was released this frame, false otherwise
+     *
+     *************************************************************************************************/
+    bool was_key_released(sf::Keyboard::Key key) const;
+
+    /**************************************************************************************************
+     * @brief Checks whether a mouse button is down.
+     *
+     * @param button Button to check
+     *
+     * @return true if button is down, false otherwise
+     *
+     *************************************************************************************************/
+    bool is_button_down(sf::Mouse::Button button) const;
+
+    /**************************************************************************************************
+     * @brief Checks whether a mouse button went down this frame.
+     *
+     * @param button Button to check
+     *
+     * @return true if button was pressed this frame, false otherwise
+     *
+     *************************************************************************************************/
+    bool was_button_pressed(sf::Mouse::Button button) const;
+
+    /**************************************************************************************************
+     * @brief Checks whether a mouse button went up this frame.
+     *
+     * @param button Button to check
+     *
+     * @return true if button was released this frame, false otherwise
+     *
+     *************************************************************************************************/
+    bool was_button_released(sf::Mouse::Button button) const;
+
+    /**************************************************************************************************
+     * @brief Returns mouse position in window coordinates.
+     *
+     * @return Mouse position
+     *
+     *************************************************************************************************/
+    Vector2f get_mouse_pos() const;
+
+    /**************************************************************************************************
+     * @brief Returns mouse position in world coordinates, as of the last update_mouse_world_pos.
+     *
+     * @return Mouse position
+     *
+     *************************************************************************************************/
+    Vector2f get_mouse_world_pos() const;
+
+    /**************************************************************************************************
+     * @brief Returns input events of this frame, in the order they happened.
+     *
+     * @return Events
+     *
+     *************************************************************************************************/
+    const std::vector<InputEvent>& get_events() const;
+
+  private:
+    void release_all(double time);
+
+    std::bitset<KEY_COUNT>    keys_down_;
+    std::bitset<KEY_COUNT>    keys_pressed_;
+    std::bitset<KEY_COUNT>    keys_released_;
+    std::bitset<BUTTON_COUNT> buttons_down_;
+    std::bitset<BUTTON_COUNT> buttons_pressed_;
+    std::bitset<BUTTON_COUNT> buttons_released_;
+    Vector2f                  mouse_pos_;
+    Vector2f                  mouse_world_pos_;
+    std::vector<InputEvent>   events_;
+};
+
+} // namespace system
+
+} // namespace rinvid
+
+#endif // SYSTEM_INCLUDE_INPUT_STATE_H
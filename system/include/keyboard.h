@@ -28,12 +28,29 @@ class Keyboard
     using Key = sf::Keyboard::Key;
 
     /**************************************************************************************************
-     * @brief Check whether key is pressed.
+     * @brief Check whether key is pressed. Reads input state of the current frame (see
+     * Application::get_input_state), or the keyboard itself if there is no application.
      *
      * @param Key the key to check.
      *
      *************************************************************************************************/
     static bool is_key_pressed(Key key);
+
+    /**************************************************************************************************
+     * @brief Check whether key went down this frame. Always false if there is no application.
+     *
+     * @param Key the key to check.
+     *
+     *************************************************************************************************/
+    static bool was_key_pressed(Key key);
+
+    /**************************************************************************************************
+     * @brief Check whether key went up this frame. Always false if there is no application.
+     *
+     * @param Key the key to check.
+     *
+     *************************************************************************************************/
+    static bool was_key_released(Key key);
 };
 
 } // namespace system
@@ -33,7 +33,8 @@ class Mouse
     };
 
     /**************************************************************************************************
-     * @brief Check whether button is pressed.
+     * @brief Check whether button is pressed. Reads input state of the current frame (see
+     * Application::get_input_state), or the mouse itself if there is no application.
      *
      * @param mouse_button which mouse button.
      *
@@ -41,12 +42,36 @@ class Mouse
     static bool is_button_pressed(MouseButton mouse_button);
 
     /**************************************************************************************************
-     * @brief Returns mouse position
+     * @brief Check whether button went down this frame. Always false if there is no application.
+     *
+     * @param mouse_button which mouse button.
+     *
+     *************************************************************************************************/
+    static bool was_button_pressed(MouseButton mouse_button);
+
+    /**************************************************************************************************
+     * @brief Check whether button went up this frame. Always false if there is no application.
+     *
+     * @param mouse_button which mouse button.
+     *
+     *************************************************************************************************/
+    static bool was_button_released(MouseButton mouse_button);
+
+    /**************************************************************************************************
+     * @brief Returns mouse position in window coordinates
      *
      * @return Vector2 representing mouse position in 2D space
      *
      *************************************************************************************************/
     static Vector2f get_mouse_pos();
+
+    /**************************************************************************************************
+     * @brief Returns mouse position in world coordinates, i.e. with the view (camera) undone.
+     *
+     * @return Vector2 representing mouse position in 2D space
+     *
+     *************************************************************************************************/
+    static Vector2f get_mouse_world_pos();
 };
 
 } // namespace system
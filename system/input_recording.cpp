@@ -0,0 +1,175 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cstring>
+
+#include "include/input_recording.h"
+#include "util/include/error_handler.h"
+
+namespace rinvid
+{
+
+namespace system
+{
+
+InputRecorder::InputRecorder() : file_{}
+{
+}
+
+bool InputRecorder::open(const std::string& file_name)
+{
+    close();
+
+    file_.open(file_name, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+    {
+        errors::put_error_to_log("Could not create input recording: " + file_name);
+        return false;
+    }
+
+    const InputRecordingHeader header{INPUT_RECORDING_MAGIC, INPUT_RECORDING_VERSION};
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    return true;
+}
+
+bool InputRecorder::is_open() const
+{
+    return file_.is_open();
+}
+
+void InputRecorder::record_frame(double delta_time, const InputState& state)
+{
+    if (!file_.is_open())
+    {
+        return;
+    }
+
+    const auto&         events    = state.get_events();
+    const Vector2f      mouse_pos = state.get_mouse_pos();
+    const RecordedFrame frame{delta_time, mouse_pos.x, mouse_pos.y,
+                              static_cast<std::uint32_t>(events.size()), 0U};
+    file_.write(reinterpret_cast<const char*>(&frame), sizeof(frame));
+
+    for (const auto& event : events)
+    {
+        const RecordedInputEvent recorded{event.time,
+                                          event.position.x,
+                                          event.position.y,
+                                          static_cast<std::int16_t>(event.code),
+                                          static_cast<std::uint8_t>(event.type),
+                                          0U};
+        file_.write(reinterpret_cast<const char*>(&recorded), sizeof(recorded));
+    }
+}
+
+void InputRecorder::close()
+{
+    if (!file_.is_open())
+    {
+        return;
+    }
+
+    file_.close();
+    if (!file_)
+    {
+        errors::put_error_to_log("Could not write input recording");
+    }
+    file_.clear();
+}
+
+InputPlayer::InputPlayer() : data_{}, offset_{0U}
+{
+}
+
+bool InputPlayer::open(const std::string& file_name)
+{
+    close();
+
+    std::ifstream file{file_name, std::ios::binary | std::ios::ate};
+    if (!file.is_open())
+    {
+        errors::put_error_to_log("Could not open input recording: " + file_name);
+        return false;
+    }
+
+    data_.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data_.data()), static_cast<std::streamsize>(data_.size()));
+
+    InputRecordingHeader header{};
+    if (!file || (data_.size() < sizeof(header)))
+    {
+        errors::put_error_to_log("Could not read input recording: " + file_name);
+        close();
+        return false;
+    }
+
+    std::memcpy(&header, data_.data(), sizeof(header));
+    if ((header.magic != INPUT_RECORDING_MAGIC) || (header.version != INPUT_RECORDING_VERSION))
+    {
+        errors::put_error_to_log("Input recording has unknown format or version: " + file_name);
+        close();
+        return false;
+    }
+
+    offset_ = sizeof(header);
+
+    return true;
+}
+
+bool InputPlayer::is_open() const
+{
+    return offset_ != 0U;
+}
+
+bool InputPlayer::next_frame(double& delta_time, InputState& state)
+{
+    RecordedFrame frame{};
+    if (!is_open() || (data_.size() - offset_ < sizeof(frame)))
+    {
+        return false;
+    }
+
+    std::memcpy(&frame, data_.data() + offset_, sizeof(frame));
+    const std::size_t events_size = frame.event_count * sizeof(RecordedInputEvent);
+    if ((data_.size() - offset_ - sizeof(frame)) < events_size)
+    {
+        errors::put_error_to_log("Input recording is truncated");
+        return false;
+    }
+    offset_ += sizeof(frame);
+
+    state.begin_frame();
+    for (std::uint32_t i{0U}; i < frame.event_count; ++i)
+    {
+        RecordedInputEvent recorded{};
+        std::memcpy(&recorded, data_.data() + offset_, sizeof(recorded));
+        offset_ += sizeof(recorded);
+
+        state.handle_event(InputEvent{static_cast<InputEvent::Type>(recorded.type), recorded.code,
+                                      Vector2f{recorded.x, recorded.y}, recorded.time});
+    }
+    state.set_mouse_pos(Vector2f{frame.mouse_x, frame.mouse_y});
+
+    delta_time = frame.delta_time;
+
+    return true;
+}
+
+void InputPlayer::close()
+{
+    data_.clear();
+    data_.shrink_to_fit();
+    offset_ = 0U;
+}
+
+} // namespace system
+
+} // namespace rinvid
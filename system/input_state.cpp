@@ -0,0 +1,228 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include "extern/glm/glm/glm.hpp"
+#include "include/input_state.h"
+
+namespace rinvid
+{
+
+namespace system
+{
+
+namespace
+{
+
+template <std::size_t N>
+bool test_bit(const std::bitset<N>& bits, std::int32_t index)
+{
+    return (index >= 0) && (static_cast<std::size_t>(index) < N) && bits.test(index);
+}
+
+} // namespace
+
+InputState::InputState()
+    : keys_down_{}, keys_pressed_{}, keys_released_{}, buttons_down_{}, buttons_pressed_{},
+      buttons_released_{}, mouse_pos_{}, mouse_world_pos_{}, events_{}
+{
+}
+
+void InputState::begin_frame()
+{
+    keys_pressed_.reset();
+    keys_released_.reset();
+    buttons_pressed_.reset();
+    buttons_released_.reset();
+    events_.clear();
+}
+
+void InputState::handle_event(const sf::Event& event, double time)
+{
+    switch (event.type)
+    {
+        case sf::Event::KeyPressed:
+            handle_event(
+                InputEvent{InputEvent::Type::KeyPressed, event.key.code, mouse_pos_, time});
+            break;
+        case sf::Event::KeyReleased:
+            handle_event(
+                InputEvent{InputEvent::Type::KeyReleased, event.key.code, mouse_pos_, time});
+            break;
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+        {
+            const auto type = (event.type == sf::Event::MouseButtonPressed)
+                                  ? InputEvent::Type::ButtonPressed
+                                  : InputEvent::Type::ButtonReleased;
+            const Vector2f position{static_cast<float>(event.mouseButton.x),
+                                    static_cast<float>(event.mouseButton.y)};
+            handle_event(InputEvent{type, event.mouseButton.button, position, time});
+            break;
+        }
+        case sf::Event::MouseMoved:
+        {
+            const Vector2f position{static_cast<float>(event.mouseMove.x),
+                                    static_cast<float>(event.mouseMove.y)};
+            handle_event(InputEvent{InputEvent::Type::MouseMoved, 0, position, time});
+            break;
+        }
+        case sf::Event::LostFocus:
+            release_all(time);
+            break;
+        default:
+            break;
+    }
+}
+
+void InputState::handle_event(const InputEvent& event)
+{
+    switch (event.type)
+    {
+        case InputEvent::Type::KeyPressed:
+        case InputEvent::Type::KeyReleased:
+        {
+            if ((event.code < 0) || (event.code >= static_cast<std::int32_t>(KEY_COUNT)))
+            {
+                return;
+            }
+
+            const bool pressed = (event.type == InputEvent::Type::KeyPressed);
+            // Held keys repeat press events, only the first one is an edge
+            if (pressed == keys_down_.test(event.code))
+            {
+                return;
+            }
+
+            keys_down_.set(event.code, pressed);
+            (pressed ? keys_pressed_ : keys_released_).set(event.code);
+            break;
+        }
+        case InputEvent::Type::ButtonPressed:
+        case InputEvent::Type::ButtonReleased:
+        {
+            if ((event.code < 0) || (event.code >= static_cast<std::int32_t>(BUTTON_COUNT)))
+            {
+                return;
+            }
+
+            const bool pressed = (event.type == InputEvent::Type::ButtonPressed);
+            buttons_down_.set(event.code, pressed);
+            (pressed ? buttons_pressed_ : buttons_released_).set(event.code);
+            mouse_pos_ = event.position;
+            break;
+        }
+        case InputEvent::Type::MouseMoved:
+            mouse_pos_ = event.position;
+            break;
+        default:
+            return;
+    }
+
+    events_.push_back(event);
+}
+
+void InputState::set_mouse_pos(Vector2f position)
+{
+    mouse_pos_ = position;
+}
+
+void InputState::update_mouse_world_pos(const glm::mat4& view)
+{
+    const glm::vec4 window_pos{mouse_pos_.x, mouse_pos_.y, 1.0F, 1.0F};
+    const glm::vec4 world_pos = glm::inverse(view) * window_pos;
+
+    mouse_world_pos_ = Vector2f{world_pos.x, world_pos.y};
+}
+
+void InputState::add(const InputState& later)
+{
+    keys_down_       = later.keys_down_;
+    buttons_down_    = later.buttons_down_;
+    mouse_pos_       = later.mouse_pos_;
+    mouse_world_pos_ = later.mouse_world_pos_;
+
+    keys_pressed_ |= later.keys_pressed_;
+    keys_released_ |= later.keys_released_;
+    buttons_pressed_ |= later.buttons_pressed_;
+    buttons_released_ |= later.buttons_released_;
+    events_.insert(events_.end(), later.events_.begin(), later.events_.end());
+}
+
+bool InputState::is_key_down(sf::Keyboard::Key key) const
+{
+    return test_bit(keys_down_, key);
+}
+
+bool InputState::was_key_pressed(sf::Keyboard::Key key) const
+{
+    return test_bit(keys_pressed_, key);
+}
+
+bool InputState::was_key_released(sf::Keyboard::Key key) const
+{
+    return test_bit(keys_released_, key);
+}
+
+bool InputState::is_button_down(sf::Mouse::Button button) const
+{
+    return test_bit(buttons_down_, button);
+}
+
+bool InputState::was_button_pressed(sf::Mouse::Button button) const
+{
+    return test_bit(buttons_pressed_, button);
+}
+
+bool InputState::was_button_released(sf::Mouse::Button button) const
+{
+    return test_bit(buttons_released_, button);
+}
+
+Vector2f InputState::get_mouse_pos() const
+{
+    return mouse_pos_;
+}
+
+Vector2f InputState::get_mouse_world_pos() const
+{
+    return mouse_world_pos_;
+}
+
+const std::vector<InputEvent>& InputState::get_events() const
+{
+    return events_;
+}
+
+void InputState::release_all(double time)
+{
+    for (std::int32_t key{0}; key < static_cast<std::int32_t>(KEY_COUNT); ++key)
+    {
+        if (keys_down_.test(key))
+        {
+            keys_released_.set(key);
+            events_.push_back(InputEvent{InputEvent::Type::KeyReleased, key, mouse_pos_, time});
+        }
+    }
+    for (std::int32_t button{0}; button < static_cast<std::int32_t>(BUTTON_COUNT); ++button)
+    {
+        if (buttons_down_.test(button))
+        {
+            buttons_released_.set(button);
+            events_.push_back(
+                InputEvent{InputEvent::Type::ButtonReleased, button, mouse_pos_, time});
+        }
+    }
+
+    keys_down_.reset();
+    buttons_down_.reset();
+}
+
+} // namespace system
+
+} // namespace rinvid
@@ -7,6 +7,8 @@
  * repository for more details.
  **********************************************************************/
 
+#include "core/include/application.h"
+#include "core/include/rinvid_gfx.h"
 #include "include/keyboard.h"
 
 namespace rinvid
@@ -17,7 +19,27 @@ namespace system
 
 bool Keyboard::is_key_pressed(Key key)
 {
-    return sf::Keyboard::isKeyPressed(key);
+    const auto* application = RinvidGfx::get_application();
+    if (application == nullptr)
+    {
+        return sf::Keyboard::isKeyPressed(key);
+    }
+
+    return application->get_input_state().is_key_down(key);
+}
+
+bool Keyboard::was_key_pressed(Key key)
+{
+    const auto* application = RinvidGfx::get_application();
+
+    return (application != nullptr) && application->get_input_state().was_key_pressed(key);
+}
+
+bool Keyboard::was_key_released(Key key)
+{
+    const auto* application = RinvidGfx::get_application();
+
+    return (application != nullptr) && application->get_input_state().was_key_released(key);
 }
 
 } // namespace system
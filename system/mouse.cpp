@@ -9,6 +9,7 @@
 
 #include <SFML/Window.hpp>
 
+#include "core/include/application.h"
 #include "core/include/rinvid_gfx.h"
 #include "include/mouse.h"
 
@@ -18,22 +19,63 @@ namespace rinvid
 namespace system
 {
 
+namespace
+{
+
+sf::Mouse::Button to_sf_button(Mouse::MouseButton button)
+{
+    return (button == Mouse::Right) ? sf::Mouse::Button::Right : sf::Mouse::Button::Left;
+}
+
+} // namespace
+
 bool Mouse::is_button_pressed(MouseButton button)
 {
-    sf::Mouse::Button sf_button = sf::Mouse::Button::Left;
-    if (button == Right)
+    const auto* application = RinvidGfx::get_application();
+    if (application == nullptr)
     {
-        sf_button = sf::Mouse::Button::Right;
+        return sf::Mouse::isButtonPressed(to_sf_button(button));
     }
 
-    return sf::Mouse::isButtonPressed(sf_button);
+    return application->get_input_state().is_button_down(to_sf_button(button));
+}
+
+bool Mouse::was_button_pressed(MouseButton button)
+{
+    const auto* application = RinvidGfx::get_application();
+
+    return (application != nullptr) &&
+           application->get_input_state().was_button_pressed(to_sf_button(button));
+}
+
+bool Mouse::was_button_released(MouseButton button)
+{
+    const auto* application = RinvidGfx::get_application();
+
+    return (application != nullptr) &&
+           application->get_input_state().was_button_released(to_sf_button(button));
 }
 
 Vector2f Mouse::get_mouse_pos()
 {
-    sf::Vector2i mouse_position = sf::Mouse::getPosition(RinvidGfx::get_application()->window_);
+    const auto* application = RinvidGfx::get_application();
+    if (application == nullptr)
+    {
+        return Vector2f{0.0F, 0.0F};
+    }
+
+    return application->get_input_state().get_mouse_pos();
+}
+
+Vector2f Mouse::get_mouse_world_pos()
+{
+    const auto* application = RinvidGfx::get_application();
+    if (application == nullptr)
+    {
+        return Vector2f{0.0F, 0.0F};
+    }
 
-    return Vector2f{static_cast<float>(mouse_position.x), static_cast<float>(mouse_position.y)};
+    return application->get_input_state().get_mouse_world_pos();
 }
 
 } // namespace system
@@ -0,0 +1,156 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cmath>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "platformers/include/aabb_tree.h"
+#include "util/include/collision_detection.h"
+
+using namespace rinvid;
+
+namespace
+{
+
+std::set<std::int32_t> query_ids(const AabbTree<std::int32_t>& tree, const Rect& rect)
+{
+    std::set<std::int32_t> ids{};
+    tree.query(rect, [&ids](std::int32_t, std::int32_t id) {
+        ids.insert(id);
+        return true;
+    });
+
+    return ids;
+}
+
+} // namespace
+
+TEST(AabbTreeTest, Queries_MatchTestingEveryRect)
+{
+    std::mt19937                          generator{3U};
+    std::uniform_real_distribution<float> position{-500.0F, 500.0F};
+    std::uniform_int_distribution<int>    size{1, 40};
+    std::uniform_real_distribution<float> step{-30.0F, 30.0F};
+
+    AabbTree<std::int32_t>    tree{};
+    std::vector<Rect>         rects{};
+    std::vector<std::int32_t> proxies{};
+    for (std::int32_t id{0}; id < 500; ++id)
+    {
+        rects.push_back(Rect{Vector2f{position(generator), position(generator)}, size(generator),
+                             size(generator)});
+        proxies.push_back(tree.create_proxy(rects.back(), id));
+    }
+
+    // Move every rect a few times and remove every fifth one, so the tree is reshaped
+    std::vector<bool> alive(rects.size(), true);
+    for (std::uint32_t round{0U}; round < 3U; ++round)
+    {
+        for (std::size_t id{0U}; id < rects.size(); ++id)
+        {
+            rects[id].position.x += step(generator);
+            rects[id].position.y += step(generator);
+            tree.move_proxy(proxies[id], rects[id]);
+        }
+    }
+    for (std::size_t id{0U}; id < rects.size(); id += 5U)
+    {
+        tree.destroy_proxy(proxies[id]);
+        alive[id] = false;
+    }
+
+    EXPECT_EQ(tree.get_proxy_count(), 400U);
+    // Balanced tree of 400 leaves is about 9 levels high
+    EXPECT_LE(tree.get_height(), 16);
+
+    for (std::uint32_t i{0U}; i < 50U; ++i)
+    {
+        const Rect region{Vector2f{position(generator), position(generator)}, 100, 60};
+
+        std::set<std::int32_t> expected{};
+        for (std::size_t id{0U}; id < rects.size(); ++id)
+        {
+            if (alive[id] && intersects(rects[id], region))
+            {
+                expected.insert(static_cast<std::int32_t>(id));
+            }
+        }
+
+        EXPECT_EQ(query_ids(tree, region), expected);
+    }
+
+    std::set<std::pair<std::int32_t, std::int32_t>> expected_pairs{};
+    for (std::size_t i{0U}; i < rects.size(); ++i)
+    {
+        for (std::size_t j{i + 1U}; j < rects.size(); ++j)
+        {
+            if (alive[i] && alive[j] && intersects(rects[i], rects[j]))
+            {
+                expected_pairs.emplace(i, j);
+            }
+        }
+    }
+
+    std::set<std::pair<std::int32_t, std::int32_t>> pairs{};
+    tree.for_each_pair([&pairs](std::int32_t id_1, std::int32_t id_2) {
+        EXPECT_TRUE(pairs.emplace(std::min(id_1, id_2), std::max(id_1, id_2)).second);
+    });
+
+    EXPECT_FALSE(expected_pairs.empty());
+    EXPECT_EQ(pairs, expected_pairs);
+}
+
+TEST(AabbTreeTest, QueryPoint_FindsRectsContainingPoint)
+{
+    AabbTree<std::int32_t> tree{};
+    tree.create_proxy(Rect{Vector2f{0.0F, 0.0F}, 10, 10}, 1);
+    tree.create_proxy(Rect{Vector2f{5.0F, 5.0F}, 10, 10}, 2);
+    tree.create_proxy(Rect{Vector2f{50.0F, 50.0F}, 10, 10}, 3);
+
+    std::set<std::int32_t> ids{};
+    tree.query_point(Vector2f{7.0F, 7.0F}, [&ids](std::int32_t, std::int32_t id) {
+        ids.insert(id);
+        return true;
+    });
+
+    EXPECT_EQ(ids, (std::set<std::int32_t>{1, 2}));
+}
+
+TEST(AabbTreeTest, RayCast_FindsClosestHit)
+{
+    AabbTree<std::int32_t> tree{};
+    tree.create_proxy(Rect{Vector2f{80.0F, -5.0F}, 10, 10}, 1);
+    tree.create_proxy(Rect{Vector2f{40.0F, -5.0F}, 10, 10}, 2);
+    tree.create_proxy(Rect{Vector2f{40.0F, 30.0F}, 10, 10}, 3);
+
+    std::int32_t closest{0};
+    float        closest_fraction{1.0F};
+    tree.ray_cast(Vector2f{0.0F, 0.0F}, Vector2f{100.0F, 0.0F},
+                  [&closest, &closest_fraction](std::int32_t id, float fraction) {
+                      closest          = id;
+                      closest_fraction = fraction;
+                      return fraction;
+                  });
+
+    EXPECT_EQ(closest, 2);
+    EXPECT_FLOAT_EQ(closest_fraction, 0.4F);
+
+    std::int32_t hits{0};
+    tree.ray_cast(Vector2f{45.0F, 100.0F}, Vector2f{45.0F, -100.0F}, [&hits](std::int32_t, float) {
+        ++hits;
+        return 1.0F;
+    });
+
+    EXPECT_EQ(hits, 2);
+}
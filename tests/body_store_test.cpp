@@ -0,0 +1,227 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/include/body_store.h"
+#include "core/include/object.h"
+#include "platformers/include/world.h"
+
+using namespace rinvid;
+
+TEST(BodyStoreTest, Destroy_InvalidatesHandleOfReusedSlot)
+{
+    BodyStore  store{};
+    BodyHandle first  = store.create(Vector2f{1.0F, 2.0F});
+    BodyHandle second = store.create(Vector2f{3.0F, 4.0F});
+
+    store.destroy(first);
+    BodyHandle third = store.create(Vector2f{5.0F, 6.0F});
+
+    EXPECT_EQ(third.index, first.index);
+    EXPECT_FALSE(store.is_valid(first));
+    EXPECT_TRUE(store.is_valid(second));
+    EXPECT_TRUE(store.is_valid(third));
+    EXPECT_EQ(store.get_count(), 2U);
+
+    // Destroying through a stale handle must not remove the body now in its slot
+    store.destroy(first);
+    EXPECT_TRUE(store.is_valid(third));
+    EXPECT_EQ(store.get_position(third).x, 5.0F);
+}
+
+TEST(BodyStoreTest, Destroy_KeepsOtherBodies)
+{
+    BodyStore               store{};
+    std::vector<BodyHandle> bodies{};
+    for (std::uint32_t i{0U}; i < 4U; ++i)
+    {
+        bodies.push_back(store.create(Vector2f{static_cast<float>(i), 0.0F}));
+        store.set_velocity(bodies.back(), Vector2f{0.0F, static_cast<float>(i)});
+    }
+
+    store.destroy(bodies[1]);
+    store.destroy(bodies[0]);
+
+    EXPECT_EQ(store.get_count(), 2U);
+    EXPECT_EQ(store.get_position(bodies[2]).x, 2.0F);
+    EXPECT_EQ(store.get_velocity(bodies[2]).y, 2.0F);
+    EXPECT_EQ(store.get_position(bodies[3]).x, 3.0F);
+    EXPECT_EQ(store.get_velocity(bodies[3]).y, 3.0F);
+
+    store.clear();
+    EXPECT_EQ(store.get_count(), 0U);
+    EXPECT_FALSE(store.is_valid(bodies[3]));
+}
+
+TEST(BodyStoreTest, Integrate_MatchesObjectUpdate)
+{
+    constexpr double TIME_STEP{1.0 / 60.0};
+
+    // More bodies than fit in a vector register, so remainder of the loop is covered as well
+    BodyStore               store{};
+    std::vector<Object>     objects(11U);
+    std::vector<BodyHandle> bodies{};
+    for (std::uint32_t i{0U}; i < objects.size(); ++i)
+    {
+        const Vector2f position{10.0F * i, -5.0F * i};
+        const Vector2f velocity{(i % 2U == 0U) ? 300.0F : -700.0F, 50.0F * i};
+        bodies.push_back(store.create(position));
+        objects[i].reset(position);
+        objects[i].set_velocity(velocity);
+        store.set_velocity(bodies[i], velocity);
+    }
+
+    objects[1].set_acceleration(Vector2f{200.0F, -100.0F});
+    store.set_acceleration(bodies[1], Vector2f{200.0F, -100.0F});
+    objects[2].set_max_velocity(250.0F);
+    store.set_max_velocity(bodies[2], 250.0F);
+    objects[3].set_drag(Vector2f{20.0F, 30.0F});
+    store.set_drag(bodies[3], Vector2f{20.0F, 30.0F});
+    objects[4].set_gravity_scale(0.0F);
+    store.set_gravity_scale(bodies[4], 0.0F);
+    objects[5].set_gravity_scale(2.5F);
+    store.set_gravity_scale(bodies[5], 2.5F);
+    objects[6].set_movable(HORIZONTALLY);
+    store.set_movable(bodies[6], HORIZONTALLY);
+    objects[7].set_movable(VERTICALLY);
+    store.set_movable(bodies[7], VERTICALLY);
+    objects[8].set_movable(NOT);
+    store.set_movable(bodies[8], NOT);
+    objects[9].kill();
+    store.set_active(bodies[9], false);
+
+    for (std::uint32_t step{0U}; step < 30U; ++step)
+    {
+        for (auto& object : objects)
+        {
+            object.update(TIME_STEP);
+        }
+        store.integrate(TIME_STEP);
+    }
+
+    for (std::uint32_t i{0U}; i < objects.size(); ++i)
+    {
+        const Vector2f position = store.get_position(bodies[i]);
+        const Vector2f velocity = store.get_velocity(bodies[i]);
+        EXPECT_NEAR(position.x, objects[i].get_position().x, 0.01F) << "body " << i;
+        EXPECT_NEAR(position.y, objects[i].get_position().y, 0.01F) << "body " << i;
+        EXPECT_NEAR(velocity.x, objects[i].get_velocity().x, 0.01F) << "body " << i;
+        EXPECT_NEAR(velocity.y, objects[i].get_velocity().y, 0.01F) << "body " << i;
+
+        // Object's previous position is only set by update, which skips the killed one
+        if (i != 9U)
+        {
+            const Vector2f interpolated = store.get_interpolated_position(bodies[i], 0.5F);
+            EXPECT_NEAR(interpolated.x, objects[i].get_interpolated_position(0.5F).x, 0.01F);
+            EXPECT_NEAR(interpolated.y, objects[i].get_interpolated_position(0.5F).y, 0.01F);
+        }
+    }
+
+    EXPECT_EQ(store.get_interpolated_position(bodies[9], 0.5F).x, 90.0F);
+}
+
+TEST(BodyStoreTest, AttachedObject_MovesAsUpdatedObject)
+{
+    constexpr double TIME_STEP{1.0 / 60.0};
+
+    BodyStore store{};
+    Object    updated{};
+    Object    attached{};
+    for (Object* object : {&updated, &attached})
+    {
+        object->reset(Vector2f{10.0F, 20.0F});
+        object->set_velocity(Vector2f{300.0F, -100.0F});
+        object->set_acceleration(Vector2f{50.0F, 0.0F});
+        object->set_max_velocity(400.0F);
+    }
+    attached.attach_body(store);
+
+    for (std::uint32_t step{0U}; step < 30U; ++step)
+    {
+        updated.update(TIME_STEP);
+        attached.update(TIME_STEP);
+        World::integrate(store, TIME_STEP);
+    }
+
+    EXPECT_TRUE(attached.is_body_attached());
+    EXPECT_NEAR(attached.get_position().x, updated.get_position().x, 0.01F);
+    EXPECT_NEAR(attached.get_position().y, updated.get_position().y, 0.01F);
+    EXPECT_NEAR(attached.get_x_velocity(), updated.get_x_velocity(), 0.01F);
+    EXPECT_NEAR(attached.get_y_velocity(), updated.get_y_velocity(), 0.01F);
+    EXPECT_NEAR(attached.get_interpolated_position(0.5F).x,
+                updated.get_interpolated_position(0.5F).x, 0.01F);
+}
+
+TEST(BodyStoreTest, AttachedObjects_CollideThroughWorld)
+{
+    BodyStore store{};
+    Object    bullet{};
+    Object    wall{};
+
+    bullet.reset(Vector2f{0.0F, 0.0F});
+    bullet.resize(4.0F, 4.0F);
+    bullet.set_gravity_scale(0.0F);
+    bullet.set_drag(Vector2f{0.0F, 0.0F});
+    bullet.set_velocity(Vector2f{600.0F, 0.0F});
+    bullet.attach_body(store);
+
+    wall.reset(Vector2f{12.0F, -10.0F});
+    wall.resize(10.0F, 30.0F);
+    wall.set_movable(NOT);
+    wall.set_gravity_scale(0.0F);
+    wall.update(1.0 / 60.0);
+
+    // Separating the bullet changes its position and velocity, next step has to start from there
+    World::integrate(store, 1.0 / 60.0);
+    EXPECT_TRUE(World::collide(bullet, wall));
+    EXPECT_TRUE(bullet.is_touching(RIGHT));
+    EXPECT_FLOAT_EQ(bullet.get_position().x, 8.0F);
+    EXPECT_FLOAT_EQ(bullet.get_x_velocity(), 0.0F);
+
+    World::integrate(store, 1.0 / 60.0);
+    EXPECT_FLOAT_EQ(bullet.get_position().x, 8.0F);
+    EXPECT_FALSE(bullet.is_touching(RIGHT));
+}
+
+TEST(BodyStoreTest, AttachedObject_MovedCopiedAndDestroyed)
+{
+    BodyStore           store{};
+    std::vector<Object> objects{};
+
+    // Growing the vector moves attached objects, store has to follow them
+    for (std::uint32_t i{0U}; i < 8U; ++i)
+    {
+        objects.emplace_back();
+        objects.back().reset(Vector2f{static_cast<float>(i), 0.0F});
+        objects.back().set_gravity_scale(0.0F);
+        objects.back().set_velocity(Vector2f{0.0F, 60.0F});
+        objects.back().attach_body(store);
+    }
+
+    World::integrate(store, 1.0 / 60.0);
+    for (std::uint32_t i{0U}; i < objects.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(objects[i].get_position().x, static_cast<float>(i));
+        EXPECT_FLOAT_EQ(objects[i].get_position().y, 1.0F);
+    }
+
+    const Object copy{objects[0]};
+    EXPECT_FALSE(copy.is_body_attached());
+    EXPECT_EQ(store.get_count(), 8U);
+
+    objects.pop_back();
+    EXPECT_EQ(store.get_count(), 7U);
+
+    // Clearing the store detaches its objects
+    store.clear();
+    EXPECT_FALSE(objects[0].is_body_attached());
+}
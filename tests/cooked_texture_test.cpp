@@ -0,0 +1,161 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/include/texture.h"
+#include "include/texture_test.h"
+#include "util/include/cooked_texture.h"
+#include "util/include/error_handler.h"
+#include "util/include/image_loader.h"
+
+using namespace rinvid;
+
+TEST(CookedTextureTest, CookPremultipliesAlphaAndBuildsMipChain)
+{
+    // 3x2 image, red pixels with alpha going from opaque to transparent
+    std::vector<std::uint8_t> image{};
+    for (std::uint8_t alpha : {255, 128, 0, 255, 128, 0})
+    {
+        image.insert(image.end(), {255, 0, 0, alpha});
+    }
+
+    std::vector<std::uint8_t> cooked{};
+    ASSERT_TRUE(cook_texture(image.data(), 3, 2, true, cooked));
+
+    CookedTextureHeader             header{};
+    std::vector<CookedTextureLevel> levels{};
+    ASSERT_TRUE(parse_cooked_texture(cooked.data(), cooked.size(), header, levels));
+
+    EXPECT_EQ(header.width, 3U);
+    EXPECT_EQ(header.height, 2U);
+    EXPECT_NE(header.flags & COOKED_TEXTURE_PREMULTIPLIED_ALPHA, 0U);
+    ASSERT_EQ(levels.size(), 2U);
+    EXPECT_EQ(levels[1].width, 1);
+    EXPECT_EQ(levels[1].height, 1);
+
+    EXPECT_EQ(levels[0].data[0], 255U);
+    EXPECT_EQ(levels[0].data[4], 128U);
+    EXPECT_EQ(levels[0].data[8], 0U);
+}
+
+TEST(CookedTextureTest, CookWithoutMipmapsHasSingleLevel)
+{
+    std::vector<std::uint8_t> image(4U * 4U * 4U, 255U);
+    std::vector<std::uint8_t> cooked{};
+    ASSERT_TRUE(cook_texture(image.data(), 4, 4, false, cooked));
+
+    CookedTextureHeader             header{};
+    std::vector<CookedTextureLevel> levels{};
+    ASSERT_TRUE(parse_cooked_texture(cooked.data(), cooked.size(), header, levels));
+    EXPECT_EQ(header.mip_count, 1U);
+    EXPECT_EQ(cooked.size(), sizeof(CookedTextureHeader) + image.size());
+}
+
+TEST(CookedTextureTest, ParseRejectsTruncatedData)
+{
+    std::vector<std::uint8_t> image(8U * 8U * 4U, 255U);
+    std::vector<std::uint8_t> cooked{};
+    ASSERT_TRUE(cook_texture(image.data(), 8, 8, true, cooked));
+
+    CookedTextureHeader             header{};
+    std::vector<CookedTextureLevel> levels{};
+    EXPECT_FALSE(parse_cooked_texture(cooked.data(), cooked.size() - 1U, header, levels));
+    EXPECT_FALSE(parse_cooked_texture(cooked.data(), 10U, header, levels));
+}
+
+TEST_F(TextureTest, Constructor_CookedTextureFile)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    std::vector<std::uint8_t> image_data{};
+    std::int32_t              width{};
+    std::int32_t              height{};
+    ASSERT_TRUE(load_image("resources/valid_image.png", image_data, width, height));
+
+    std::vector<std::uint8_t> cooked{};
+    ASSERT_TRUE(cook_texture(image_data.data(), width, height, true, cooked));
+
+    const char* file_name = "cooked_valid_image.rtex";
+    {
+        std::ofstream file{file_name, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(cooked.data()),
+                   static_cast<std::streamsize>(cooked.size()));
+    }
+
+    {
+        Texture texture{file_name};
+        EXPECT_TRUE(texture.is_loaded());
+        EXPECT_TRUE(texture.has_premultiplied_alpha());
+        EXPECT_EQ(texture.get_width(), width);
+        EXPECT_EQ(texture.get_height(), height);
+    }
+
+    std::remove(file_name);
+
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
+
+TEST_F(TextureTest, Constructor_CookedTextureFile_UsesCookedMipChain)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    // 4x4 white image, cooked with levels of 4x4, 2x2 and 1x1
+    std::vector<std::uint8_t> image(4U * 4U * 4U, 255U);
+    std::vector<std::uint8_t> cooked{};
+    ASSERT_TRUE(cook_texture(image.data(), 4, 4, true, cooked));
+
+    // Only first two levels are kept, a generated chain would have the third one as well. Level 1
+    // is made green, which a generated chain wouldn't have either.
+    CookedTextureHeader header{};
+    std::memcpy(&header, cooked.data(), sizeof(header));
+    ASSERT_EQ(header.mip_count, 3U);
+    header.mip_count = 2U;
+    std::memcpy(cooked.data(), &header, sizeof(header));
+
+    std::uint8_t* level_1 = cooked.data() + sizeof(header) + image.size();
+    for (std::size_t pixel{0U}; pixel < 4U; ++pixel)
+    {
+        level_1[pixel * 4U]      = 0U;
+        level_1[pixel * 4U + 2U] = 0U;
+    }
+
+    const char* file_name = "cooked_mip_chain.rtex";
+    {
+        std::ofstream file{file_name, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(cooked.data()),
+                   static_cast<std::streamsize>(cooked.size()));
+    }
+
+    {
+        Texture texture{file_name};
+        EXPECT_TRUE(texture.has_mipmaps());
+
+        // Texture is left bound by its construction
+        GLint level_2_width{-1};
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 2, GL_TEXTURE_WIDTH, &level_2_width);
+        EXPECT_EQ(level_2_width, 0);
+
+        std::vector<std::uint8_t> pixels(2U * 2U * 4U, 255U);
+        glGetTexImage(GL_TEXTURE_2D, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        EXPECT_EQ(pixels[0], 0U);
+        EXPECT_EQ(pixels[1], 255U);
+        EXPECT_EQ(pixels[2], 0U);
+    }
+
+    std::remove(file_name);
+
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
@@ -0,0 +1,109 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/include/dynamic_texture.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/sprite.h"
+#include "include/texture_test.h"
+#include "util/include/error_handler.h"
+
+using namespace rinvid;
+
+TEST_F(TextureTest, DynamicTexture_UpdateRegionsAndDraw)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    RinvidGfx::init(nullptr);
+
+    DynamicTexture texture{16, 16};
+    EXPECT_EQ(texture.get_width(), 16);
+    EXPECT_EQ(texture.get_height(), 16);
+    EXPECT_TRUE(texture.is_loaded());
+
+    Sprite sprite{&texture, 16, 16, {0.0F, 0.0F}};
+
+    // More updates than there are pixel buffers, so buffers get reused
+    std::vector<std::uint8_t> pixels(16U * 16U * 4U, 255U);
+    for (std::int32_t i{0}; i < 8; ++i)
+    {
+        texture.update(Rect{Vector2f{static_cast<float>(i), 2.0F}, 4, 4}, pixels.data());
+        EXPECT_NO_THROW(sprite.draw());
+    }
+
+    // Region partially outside of texture, taken out of a bigger image
+    texture.update(Rect{Vector2f{-2.0F, 14.0F}, 8, 8}, pixels.data(), 16);
+    texture.update(pixels.data());
+
+    RinvidGfx::shutdown();
+
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
+
+TEST_F(TextureTest, DynamicTexture_UpdateClipsRegionToTexture)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    DynamicTexture texture{16, 16};
+
+    // Each texel holds its own coordinates, so misplaced rows or columns show
+    std::vector<std::uint8_t> background(16U * 16U * 4U);
+    for (std::size_t y{0U}; y < 16U; ++y)
+    {
+        for (std::size_t x{0U}; x < 16U; ++x)
+        {
+            auto* pixel = &background[(y * 16U + x) * 4U];
+            pixel[0]    = static_cast<std::uint8_t>(x);
+            pixel[1]    = static_cast<std::uint8_t>(y);
+            pixel[2]    = 1U;
+            pixel[3]    = 255U;
+        }
+    }
+    texture.update(background.data());
+
+    // 8x8 region of a 16 pixel wide image, only its 6x2 bottom right part is inside the texture
+    std::vector<std::uint8_t> image(16U * 8U * 4U);
+    for (std::size_t y{0U}; y < 8U; ++y)
+    {
+        for (std::size_t x{0U}; x < 16U; ++x)
+        {
+            auto* pixel = &image[(y * 16U + x) * 4U];
+            pixel[0]    = static_cast<std::uint8_t>(100U + x);
+            pixel[1]    = static_cast<std::uint8_t>(100U + y);
+            pixel[2]    = 2U;
+            pixel[3]    = 255U;
+        }
+    }
+    texture.update(Rect{Vector2f{-2.0F, 14.0F}, 8, 8}, image.data(), 16);
+
+    // Texture is left bound by the update
+    std::vector<std::uint8_t> pixels(16U * 16U * 4U, 0U);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+    for (std::size_t y{0U}; y < 16U; ++y)
+    {
+        for (std::size_t x{0U}; x < 16U; ++x)
+        {
+            const bool  updated  = (x < 6U) && (y >= 14U);
+            const auto* expected = updated ? &image[((y - 14U) * 16U + x + 2U) * 4U]
+                                           : &background[(y * 16U + x) * 4U];
+            const auto* pixel    = &pixels[(y * 16U + x) * 4U];
+            EXPECT_EQ(std::vector<std::uint8_t>(pixel, pixel + 4),
+                      std::vector<std::uint8_t>(expected, expected + 4))
+                << "texel " << x << ", " << y;
+        }
+    }
+
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
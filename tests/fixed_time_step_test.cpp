@@ -0,0 +1,78 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "core/include/fixed_time_step.h"
+#include "core/include/object.h"
+
+using namespace rinvid;
+
+TEST(FixedTimeStepTest, Disabled_TakesNoStepsAndRendersCurrentState)
+{
+    FixedTimeStep fixed_time_step{};
+
+    EXPECT_FALSE(fixed_time_step.is_enabled());
+    EXPECT_EQ(fixed_time_step.advance(0.1), 0U);
+    EXPECT_DOUBLE_EQ(fixed_time_step.get_alpha(), 1.0);
+}
+
+TEST(FixedTimeStepTest, Advance_CarriesRemainderOverToNextFrame)
+{
+    FixedTimeStep fixed_time_step{0.01};
+
+    EXPECT_EQ(fixed_time_step.advance(0.025), 2U);
+    EXPECT_NEAR(fixed_time_step.get_alpha(), 0.5, 1e-9);
+
+    EXPECT_EQ(fixed_time_step.advance(0.004), 0U);
+    EXPECT_NEAR(fixed_time_step.get_alpha(), 0.9, 1e-9);
+
+    EXPECT_EQ(fixed_time_step.advance(0.001), 1U);
+    EXPECT_NEAR(fixed_time_step.get_alpha(), 0.0, 1e-9);
+}
+
+TEST(FixedTimeStepTest, Advance_DropsStepsOverLimit)
+{
+    FixedTimeStep fixed_time_step{0.01, 4U};
+
+    // A 1 second hitch would need 100 steps
+    EXPECT_EQ(fixed_time_step.advance(1.0025), 4U);
+    EXPECT_EQ(fixed_time_step.get_dropped_steps(), 96U);
+    EXPECT_NEAR(fixed_time_step.get_alpha(), 0.25, 1e-6);
+
+    // Next frame isn't burdened with the dropped time
+    EXPECT_EQ(fixed_time_step.advance(0.01), 1U);
+}
+
+TEST(FixedTimeStepTest, Reset_DiscardsAccumulatedTime)
+{
+    FixedTimeStep fixed_time_step{0.01};
+
+    fixed_time_step.advance(0.009);
+    fixed_time_step.reset();
+
+    EXPECT_EQ(fixed_time_step.advance(0.009), 0U);
+    EXPECT_NEAR(fixed_time_step.get_alpha(), 0.9, 1e-9);
+}
+
+TEST(FixedTimeStepTest, ObjectInterpolatedPosition_BlendsLastTwoSteps)
+{
+    Object object{};
+    object.set_movable(HORIZONTALLY);
+    object.set_drag(Vector2f{0.0F, 0.0F});
+    object.set_velocity(Vector2f{100.0F, 0.0F});
+    object.reset(Vector2f{10.0F, 20.0F});
+
+    object.update(0.1);
+
+    EXPECT_FLOAT_EQ(object.get_interpolated_position(0.0F).x, 10.0F);
+    EXPECT_FLOAT_EQ(object.get_interpolated_position(0.5F).x, 15.0F);
+    EXPECT_FLOAT_EQ(object.get_interpolated_position(1.0F).x, 20.0F);
+    EXPECT_FLOAT_EQ(object.get_interpolated_position(0.5F).y, 20.0F);
+}
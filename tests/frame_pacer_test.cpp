@@ -0,0 +1,101 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "core/include/frame_pacer.h"
+
+using namespace rinvid;
+
+namespace
+{
+
+double get_seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST(FramePacerTest, Uncapped_NeverWaits)
+{
+    FramePacer frame_pacer{};
+    auto       start = std::chrono::steady_clock::now();
+
+    for (std::uint32_t i{0U}; i < 100U; ++i)
+    {
+        frame_pacer.begin_frame();
+        frame_pacer.end_frame();
+    }
+
+    // Only catches waits of 5 ms or more per frame, a busy machine can take far longer than 100
+    // empty frames need
+    EXPECT_LT(get_seconds_since(start), 0.5);
+    EXPECT_EQ(frame_pacer.get_missed_deadlines(), 0U);
+}
+
+TEST(FramePacerTest, Capped_GivesEachFrameItsSlot)
+{
+    FramePacer frame_pacer{50U};
+    auto       start = std::chrono::steady_clock::now();
+
+    // First frame starts right away, each following one a slot later, so the last one at 480 ms
+    for (std::uint32_t i{0U}; i < 25U; ++i)
+    {
+        frame_pacer.begin_frame();
+        frame_pacer.end_frame();
+    }
+
+    // Waiting two slots per frame would take 960 ms, anything below leaves room for preemption
+    const double elapsed = get_seconds_since(start);
+    EXPECT_GE(elapsed, 0.47);
+    EXPECT_LT(elapsed, 0.9);
+
+    // A busy machine can preempt the test for longer than a slot now and then
+    EXPECT_LE(frame_pacer.get_missed_deadlines(), 1U);
+}
+
+TEST(FramePacerTest, SlowFrame_IsCountedAndNotCaughtUpOn)
+{
+    FramePacer frame_pacer{10U};
+
+    frame_pacer.begin_frame();
+    std::this_thread::sleep_for(std::chrono::milliseconds{150});
+    frame_pacer.end_frame();
+
+    EXPECT_EQ(frame_pacer.get_missed_deadlines(), 1U);
+
+    // Next slot starts when the late frame ended, waiting for the slot after it would take 100 ms
+    auto start = std::chrono::steady_clock::now();
+    frame_pacer.begin_frame();
+    EXPECT_LT(get_seconds_since(start), 0.05);
+}
+
+TEST(FramePacerTest, LowLatency_StartsFrameAsLateAsPossible)
+{
+    FramePacer frame_pacer{50U};
+    auto       start = std::chrono::steady_clock::now();
+
+    // Frame slots are 20 ms long. First frame takes about 5 ms, which gives work time estimate.
+    frame_pacer.begin_frame();
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    frame_pacer.end_frame();
+
+    EXPECT_GE(frame_pacer.get_estimated_work_time(), 0.005);
+
+    // Second slot spans 20 to 40 ms, frame starts about 6 ms before its end instead of at 20 ms
+    frame_pacer.set_low_latency(true);
+    frame_pacer.begin_frame();
+    const double frame_start = get_seconds_since(start);
+
+    EXPECT_GE(frame_start, 0.03);
+}
@@ -0,0 +1,78 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "core/include/rectangle_shape.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/sprite.h"
+#include "core/include/texture.h"
+#include "tests/include/opengl_test.h"
+
+using namespace rinvid;
+
+TEST_F(OpenGLTest, FrameStats_CountShapeDraws)
+{
+    RinvidGfx::set_viewport(0, 0, 32, 32);
+    RinvidGfx::init(nullptr);
+
+    RectangleShape rectangle{Vector2f{16.0F, 16.0F}, 8.0F, 8.0F};
+
+    RinvidGfx::reset_frame_stats();
+    rectangle.draw();
+    rectangle.draw();
+
+    const FrameStats stats = RinvidGfx::get_frame_stats();
+    EXPECT_EQ(stats.draw_calls, 2U);
+    EXPECT_EQ(stats.triangles, 4U);
+    // Second draw uses the same program
+    EXPECT_LE(stats.program_switches, 1U);
+    // Model view projection matrix and color, per draw
+    EXPECT_EQ(stats.uniform_sets, 4U);
+    EXPECT_EQ(stats.texture_binds, 0U);
+    EXPECT_EQ(stats.buffer_upload_bytes, 0U);
+
+    RinvidGfx::reset_frame_stats();
+
+    EXPECT_EQ(RinvidGfx::get_last_frame_stats().draw_calls, 2U);
+    EXPECT_EQ(RinvidGfx::get_frame_stats().draw_calls, 0U);
+
+    RinvidGfx::shutdown();
+}
+
+TEST_F(OpenGLTest, FrameStats_CountSpriteDrawsAndUploads)
+{
+    RinvidGfx::set_viewport(0, 0, 32, 32);
+    RinvidGfx::init(nullptr);
+
+    Texture texture{"resources/valid_image.png"};
+    Sprite  sprite{&texture, 8, 8, Vector2f{0.0F, 0.0F}, Vector2f{8.0F, 8.0F}};
+
+    RinvidGfx::reset_frame_stats();
+    sprite.draw();
+
+    EXPECT_EQ(RinvidGfx::get_frame_stats().draw_calls, 1U);
+    EXPECT_EQ(RinvidGfx::get_frame_stats().triangles, 2U);
+    EXPECT_EQ(RinvidGfx::get_frame_stats().texture_binds, 1U);
+
+    // Moving a sprite doesn't touch its vertex buffer
+    sprite.move(Vector2f{1.0F, 1.0F});
+    sprite.draw();
+
+    EXPECT_EQ(RinvidGfx::get_frame_stats().draw_calls, 2U);
+    EXPECT_EQ(RinvidGfx::get_frame_stats().buffer_upload_bytes, 0U);
+
+    std::ostringstream log{};
+    log << RinvidGfx::get_frame_stats();
+    EXPECT_NE(log.str().find("draw calls: 2"), std::string::npos);
+
+    RinvidGfx::shutdown();
+}
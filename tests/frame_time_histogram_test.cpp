@@ -0,0 +1,82 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "util/include/frame_time_histogram.h"
+
+using namespace rinvid;
+
+TEST(FrameTimeHistogramTest, Empty_ReportsZeros)
+{
+    FrameTimeHistogram histogram{};
+    auto               report = histogram.get_report("empty");
+
+    EXPECT_EQ(report.name, "empty");
+    EXPECT_EQ(report.frames, 0U);
+    EXPECT_DOUBLE_EQ(report.mean, 0.0);
+    EXPECT_DOUBLE_EQ(report.p99, 0.0);
+    EXPECT_EQ(report.stutters, 0U);
+}
+
+TEST(FrameTimeHistogramTest, Percentiles_AreWithinBucketPrecision)
+{
+    FrameTimeHistogram histogram{};
+
+    // 1 ms to 100 ms in 1 ms steps, so percentile p is about p ms
+    for (std::uint32_t i{1U}; i <= 100U; ++i)
+    {
+        histogram.record(i / 1000.0);
+    }
+
+    EXPECT_EQ(histogram.get_count(), 100U);
+    EXPECT_NEAR(histogram.get_percentile(50.0), 0.050, 0.050 * 0.04);
+    EXPECT_NEAR(histogram.get_percentile(95.0), 0.095, 0.095 * 0.04);
+    EXPECT_NEAR(histogram.get_percentile(99.0), 0.099, 0.099 * 0.04);
+    EXPECT_DOUBLE_EQ(histogram.get_percentile(100.0), 0.1);
+    EXPECT_NEAR(histogram.get_percentile(0.0), 0.001, 0.001 * 0.04);
+}
+
+TEST(FrameTimeHistogramTest, Record_ClampsTimesOutOfRange)
+{
+    FrameTimeHistogram histogram{};
+
+    histogram.record(-1.0);
+    histogram.record(3600.0);
+
+    EXPECT_EQ(histogram.get_count(), 2U);
+    EXPECT_DOUBLE_EQ(histogram.get_percentile(50.0), 0.0000005);
+    EXPECT_DOUBLE_EQ(histogram.get_percentile(100.0), 3600.0);
+}
+
+TEST(FrameTimeHistogramTest, Report_CountsStuttersAndClearResets)
+{
+    FrameTimeHistogram histogram{};
+
+    for (std::uint32_t i{0U}; i < 60U; ++i)
+    {
+        histogram.record((i % 20U == 19U) ? 0.050 : 0.016);
+    }
+
+    auto report = histogram.get_report("level");
+    EXPECT_EQ(report.frames, 60U);
+    EXPECT_EQ(report.stutters, 3U);
+    EXPECT_DOUBLE_EQ(report.max, 0.050);
+    EXPECT_NEAR(report.p50, 0.016, 0.016 * 0.04);
+
+    std::ostringstream stream{};
+    stream << report;
+    EXPECT_EQ(stream.str().rfind("Frame times of level (ms): 60 frames", 0), 0U);
+
+    histogram.clear();
+    EXPECT_EQ(histogram.get_count(), 0U);
+    EXPECT_EQ(histogram.get_report("level").stutters, 0U);
+}
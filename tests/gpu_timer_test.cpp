@@ -0,0 +1,50 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "core/include/gpu_timer.h"
+#include "core/include/rinvid_gl.h"
+#include "tests/include/opengl_test.h"
+#include "util/include/error_handler.h"
+
+using namespace rinvid;
+
+// GpuTimer is called directly rather than through RINVID_GPU_PASS, so the test doesn't depend on
+// whether the library was built with GPU timing
+TEST_F(OpenGLTest, GpuTimer_CollectsPassTimesFramesLater)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    // Enough clearing for the pass to take measurable time
+    GpuTimer::begin_pass(GpuPass::Shapes);
+    for (std::uint32_t i{0U}; i < 100U; ++i)
+    {
+        GL_CALL(glClearColor(static_cast<float>(i % 2U), 0.0F, 0.0F, 1.0F));
+        GL_CALL(glClear(GL_COLOR_BUFFER_BIT));
+    }
+    GpuTimer::begin_pass(GpuPass::Other);
+    GL_CALL(glClear(GL_COLOR_BUFFER_BIT));
+    GpuTimer::end_frame();
+
+    // Results of a frame are read when its slot in the ring is reused
+    GL_CALL(glFinish());
+    for (std::uint32_t frame{0U}; frame < 3U; ++frame)
+    {
+        GpuTimer::end_frame();
+    }
+
+    EXPECT_GT(GpuTimer::get_pass_time(GpuPass::Shapes), 0.0);
+    EXPECT_EQ(GpuTimer::get_pass_time(GpuPass::Text), 0.0);
+    EXPECT_EQ(GpuTimer::get_pass_time(GpuPass::Textures), 0.0);
+    EXPECT_EQ(GpuTimer::get_dropped_frame_count(), 0U);
+    EXPECT_EQ(number_of_errors, errors::get_error_count());
+
+    GpuTimer::shutdown();
+}
@@ -0,0 +1,81 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <filesystem>
+#include <fstream>
+
+#include <SFML/Window.hpp>
+#include <gtest/gtest.h>
+
+#include "system/include/input_recording.h"
+
+using namespace rinvid;
+using namespace rinvid::system;
+
+TEST(InputRecordingTest, Replay_ReproducesRecordedFrames)
+{
+    const std::filesystem::path recording_file{"input_recording_test.rinp"};
+
+    InputState    state{};
+    InputRecorder recorder{};
+    ASSERT_TRUE(recorder.open(recording_file.string()));
+
+    state.begin_frame();
+    state.set_mouse_pos(Vector2f{10.0F, 20.0F});
+    state.handle_event(InputEvent{InputEvent::Type::KeyPressed, sf::Keyboard::W,
+                                  Vector2f{10.0F, 20.0F}, 0.5});
+    recorder.record_frame(1.0 / 60.0, state);
+
+    state.begin_frame();
+    state.handle_event(InputEvent{InputEvent::Type::ButtonPressed, sf::Mouse::Left,
+                                  Vector2f{30.0F, 40.0F}, 0.52});
+    state.handle_event(
+        InputEvent{InputEvent::Type::KeyReleased, sf::Keyboard::W, Vector2f{30.0F, 40.0F}, 0.53});
+    recorder.record_frame(1.0 / 30.0, state);
+    recorder.close();
+
+    InputState  replayed{};
+    InputPlayer player{};
+    ASSERT_TRUE(player.open(recording_file.string()));
+    std::filesystem::remove(recording_file);
+
+    double delta_time{0.0};
+    ASSERT_TRUE(player.next_frame(delta_time, replayed));
+    EXPECT_DOUBLE_EQ(delta_time, 1.0 / 60.0);
+    EXPECT_TRUE(replayed.was_key_pressed(sf::Keyboard::W));
+    EXPECT_FLOAT_EQ(replayed.get_mouse_pos().y, 20.0F);
+
+    ASSERT_TRUE(player.next_frame(delta_time, replayed));
+    EXPECT_DOUBLE_EQ(delta_time, 1.0 / 30.0);
+    EXPECT_FALSE(replayed.is_key_down(sf::Keyboard::W));
+    EXPECT_TRUE(replayed.was_key_released(sf::Keyboard::W));
+    EXPECT_FALSE(replayed.was_key_pressed(sf::Keyboard::W));
+    EXPECT_TRUE(replayed.is_button_down(sf::Mouse::Left));
+    ASSERT_EQ(replayed.get_events().size(), 2U);
+    EXPECT_DOUBLE_EQ(replayed.get_events()[0].time, 0.52);
+    EXPECT_FLOAT_EQ(replayed.get_mouse_pos().x, 30.0F);
+
+    EXPECT_FALSE(player.next_frame(delta_time, replayed));
+}
+
+TEST(InputRecordingTest, Open_RejectsOtherFiles)
+{
+    const std::filesystem::path other_file{"input_recording_test_other.rinp"};
+    {
+        std::ofstream file{other_file, std::ios::binary};
+        file << "not a recording";
+    }
+
+    InputPlayer player{};
+    EXPECT_FALSE(player.open(other_file.string()));
+    EXPECT_FALSE(player.is_open());
+    std::filesystem::remove(other_file);
+
+    EXPECT_FALSE(player.open("no_such_recording.rinp"));
+}
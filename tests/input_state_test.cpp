@@ -0,0 +1,155 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <SFML/Window.hpp>
+#include <gtest/gtest.h>
+
+#include "extern/glm/glm/gtc/matrix_transform.hpp"
+#include "system/include/input_state.h"
+
+using namespace rinvid;
+using namespace rinvid::system;
+
+namespace
+{
+
+sf::Event key_event(sf::Event::EventType type, sf::Keyboard::Key key)
+{
+    sf::Event event{};
+    event.type     = type;
+    event.key.code = key;
+
+    return event;
+}
+
+sf::Event button_event(sf::Event::EventType type, sf::Mouse::Button button, int x, int y)
+{
+    sf::Event event{};
+    event.type               = type;
+    event.mouseButton.button = button;
+    event.mouseButton.x      = x;
+    event.mouseButton.y      = y;
+
+    return event;
+}
+
+sf::Event move_event(int x, int y)
+{
+    sf::Event event{};
+    event.type        = sf::Event::MouseMoved;
+    event.mouseMove.x = x;
+    event.mouseMove.y = y;
+
+    return event;
+}
+
+} // namespace
+
+TEST(InputStateTest, HandleEvent_KeepsPressAndReleaseWithinAFrame)
+{
+    InputState state{};
+
+    state.begin_frame();
+    state.handle_event(key_event(sf::Event::KeyPressed, sf::Keyboard::A), 0.0);
+    state.handle_event(key_event(sf::Event::KeyReleased, sf::Keyboard::A), 0.1);
+
+    EXPECT_FALSE(state.is_key_down(sf::Keyboard::A));
+    EXPECT_TRUE(state.was_key_pressed(sf::Keyboard::A));
+    EXPECT_TRUE(state.was_key_released(sf::Keyboard::A));
+
+    state.begin_frame();
+
+    EXPECT_FALSE(state.was_key_pressed(sf::Keyboard::A));
+    EXPECT_FALSE(state.was_key_released(sf::Keyboard::A));
+}
+
+TEST(InputStateTest, HandleEvent_IgnoresKeyRepeat)
+{
+    InputState state{};
+
+    state.handle_event(key_event(sf::Event::KeyPressed, sf::Keyboard::A), 0.0);
+    state.begin_frame();
+    state.handle_event(key_event(sf::Event::KeyPressed, sf::Keyboard::A), 0.5);
+
+    EXPECT_TRUE(state.is_key_down(sf::Keyboard::A));
+    EXPECT_FALSE(state.was_key_pressed(sf::Keyboard::A));
+    EXPECT_TRUE(state.get_events().empty());
+}
+
+TEST(InputStateTest, HandleEvent_LostFocusReleasesEverything)
+{
+    InputState state{};
+
+    state.handle_event(key_event(sf::Event::KeyPressed, sf::Keyboard::A), 0.0);
+    state.handle_event(button_event(sf::Event::MouseButtonPressed, sf::Mouse::Left, 1, 2), 0.0);
+    state.begin_frame();
+
+    sf::Event lost_focus{};
+    lost_focus.type = sf::Event::LostFocus;
+    state.handle_event(lost_focus, 1.0);
+
+    EXPECT_FALSE(state.is_key_down(sf::Keyboard::A));
+    EXPECT_TRUE(state.was_key_released(sf::Keyboard::A));
+    EXPECT_FALSE(state.is_button_down(sf::Mouse::Left));
+    EXPECT_TRUE(state.was_button_released(sf::Mouse::Left));
+    EXPECT_EQ(state.get_events().size(), 2U);
+}
+
+TEST(InputStateTest, HandleEvent_RecordsEventsInOrder)
+{
+    InputState state{};
+
+    state.handle_event(move_event(10, 20), 0.25);
+    state.handle_event(button_event(sf::Event::MouseButtonPressed, sf::Mouse::Right, 30, 40), 0.5);
+
+    const auto& events = state.get_events();
+    ASSERT_EQ(events.size(), 2U);
+    EXPECT_EQ(events[0].type, InputEvent::Type::MouseMoved);
+    EXPECT_FLOAT_EQ(events[0].position.x, 10.0F);
+    EXPECT_DOUBLE_EQ(events[0].time, 0.25);
+    EXPECT_EQ(events[1].type, InputEvent::Type::ButtonPressed);
+    EXPECT_EQ(events[1].code, sf::Mouse::Right);
+    EXPECT_FLOAT_EQ(events[1].position.y, 40.0F);
+    EXPECT_DOUBLE_EQ(events[1].time, 0.5);
+
+    EXPECT_TRUE(state.was_button_pressed(sf::Mouse::Right));
+    EXPECT_FLOAT_EQ(state.get_mouse_pos().x, 30.0F);
+    EXPECT_FLOAT_EQ(state.get_mouse_pos().y, 40.0F);
+}
+
+TEST(InputStateTest, UpdateMouseWorldPos_UndoesView)
+{
+    InputState state{};
+
+    state.set_mouse_pos(Vector2f{100.0F, 50.0F});
+    state.update_mouse_world_pos(glm::translate(glm::mat4{1.0F}, glm::vec3{-40.0F, -10.0F, 0.0F}));
+
+    EXPECT_FLOAT_EQ(state.get_mouse_world_pos().x, 140.0F);
+    EXPECT_FLOAT_EQ(state.get_mouse_world_pos().y, 60.0F);
+}
+
+TEST(InputStateTest, Add_KeepsEdgesOfBothFrames)
+{
+    InputState total{};
+    InputState frame{};
+
+    frame.handle_event(key_event(sf::Event::KeyPressed, sf::Keyboard::A), 0.0);
+    total.add(frame);
+
+    frame.begin_frame();
+    frame.handle_event(key_event(sf::Event::KeyReleased, sf::Keyboard::A), 0.1);
+    frame.handle_event(move_event(5, 6), 0.1);
+    total.add(frame);
+
+    EXPECT_FALSE(total.is_key_down(sf::Keyboard::A));
+    EXPECT_TRUE(total.was_key_pressed(sf::Keyboard::A));
+    EXPECT_TRUE(total.was_key_released(sf::Keyboard::A));
+    EXPECT_FLOAT_EQ(total.get_mouse_pos().x, 5.0F);
+    EXPECT_EQ(total.get_events().size(), 3U);
+}
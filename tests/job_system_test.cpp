@@ -0,0 +1,122 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/include/job_system.h"
+
+using namespace rinvid;
+
+TEST(JobSystemTest, Wait_ReturnsOnceAllCountedJobsAreDone)
+{
+    std::atomic<std::uint32_t> done{0U};
+    JobCounter                 counter{};
+
+    for (std::uint32_t i{0U}; i < 1000U; ++i)
+    {
+        JobSystem::run([&done]() { ++done; }, &counter);
+    }
+    JobSystem::wait(counter);
+
+    EXPECT_TRUE(counter.is_done());
+    EXPECT_EQ(done, 1000U);
+    EXPECT_GE(JobSystem::get_worker_count(), 1U);
+}
+
+TEST(JobSystemTest, RunAfter_StartsJobOnceDependencyIsDone)
+{
+    std::vector<std::uint32_t> values(64U, 0U);
+    std::uint32_t              sum{0U};
+    JobCounter                 values_written{};
+    JobCounter                 sum_written{};
+
+    for (std::uint32_t i{0U}; i < values.size(); ++i)
+    {
+        JobSystem::run(
+            [&values, i]() {
+                std::this_thread::yield();
+                values[i] = i;
+            },
+            &values_written);
+    }
+    JobSystem::run_after(
+        values_written,
+        [&values, &sum]() {
+            for (auto value : values)
+            {
+                sum += value;
+            }
+        },
+        &sum_written);
+
+    JobSystem::wait(sum_written);
+
+    EXPECT_EQ(sum, 64U * 63U / 2U);
+}
+
+TEST(JobSystemTest, ParallelFor_CoversEveryIndexOnce)
+{
+    std::vector<std::atomic<std::uint32_t>> visits(10000U);
+
+    JobSystem::parallel_for(10000U, 64U, [&visits](std::uint32_t begin, std::uint32_t end) {
+        for (std::uint32_t i{begin}; i < end; ++i)
+        {
+            ++visits[i];
+        }
+    });
+
+    for (const auto& count : visits)
+    {
+        ASSERT_EQ(count, 1U);
+    }
+}
+
+TEST(JobSystemTest, MainThreadJobs_OnlyRunWhenProcessed)
+{
+    const auto main_thread = std::this_thread::get_id();
+    bool       ran_on_main_thread{false};
+    JobCounter decoded{};
+    JobCounter uploaded{};
+
+    JobSystem::run([]() {}, &decoded);
+    JobSystem::run_on_main_thread_after(
+        decoded, [&]() { ran_on_main_thread = (std::this_thread::get_id() == main_thread); },
+        &uploaded);
+
+    JobSystem::wait(decoded);
+    EXPECT_FALSE(uploaded.is_done());
+
+    EXPECT_EQ(JobSystem::process_main_thread_jobs(), 1U);
+    EXPECT_TRUE(uploaded.is_done());
+    EXPECT_TRUE(ran_on_main_thread);
+    EXPECT_EQ(JobSystem::process_main_thread_jobs(), 0U);
+}
+
+TEST(JobSystemTest, Shutdown_RunsQueuedJobsAndAllowsRestart)
+{
+    std::atomic<std::uint32_t> done{0U};
+
+    for (std::uint32_t i{0U}; i < 100U; ++i)
+    {
+        JobSystem::run([&done]() { ++done; });
+    }
+    JobSystem::shutdown();
+
+    EXPECT_EQ(done, 100U);
+
+    JobCounter counter{};
+    JobSystem::run([&done]() { ++done; }, &counter);
+    JobSystem::wait(counter);
+
+    EXPECT_EQ(done, 101U);
+}
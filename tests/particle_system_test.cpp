@@ -0,0 +1,106 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/include/particle_system.h"
+#include "core/include/rinvid_gfx.h"
+#include "tests/include/opengl_test.h"
+#include "util/include/error_handler.h"
+
+using namespace rinvid;
+
+static void simulate_and_draw(ParticleBackend backend)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    RinvidGfx::set_viewport(0, 0, 32, 32);
+    RinvidGfx::init(nullptr);
+
+    ParticleSystem        particles{1000U, backend};
+    ParticleEmitterParams params{};
+    params.position     = Vector2f{16.0F, 16.0F};
+    params.acceleration = Vector2f{0.0F, 100.0F};
+    particles.set_emitter(params);
+
+    for (std::uint32_t frame{0}; frame < 10U; ++frame)
+    {
+        particles.update(1.0 / 60.0);
+        particles.draw();
+    }
+
+    EXPECT_EQ(particles.get_backend(), backend);
+    EXPECT_EQ(particles.get_max_particles(), 1000U);
+    EXPECT_EQ(number_of_errors, errors::get_error_count());
+}
+
+TEST_F(OpenGLTest, ParticleSystem_CpuBackendSimulatesAndDraws)
+{
+    simulate_and_draw(ParticleBackend::Cpu);
+}
+
+TEST_F(OpenGLTest, ParticleSystem_TransformFeedbackBackendSimulatesAndDraws)
+{
+    simulate_and_draw(ParticleBackend::TransformFeedback);
+}
+
+static std::vector<Vector2f> simulate_and_read_back(ParticleBackend backend, std::uint32_t frames)
+{
+    ParticleSystem        particles{64U, backend};
+    ParticleEmitterParams params{};
+    params.position     = Vector2f{16.0F, 16.0F};
+    params.min_velocity = Vector2f{30.0F, -20.0F};
+    params.max_velocity = params.min_velocity;
+    params.acceleration = Vector2f{0.0F, 100.0F};
+    params.min_lifetime = 1.0F;
+    params.max_lifetime = 1.0F;
+    particles.set_emitter(params);
+
+    for (std::uint32_t frame{0}; frame < frames; ++frame)
+    {
+        particles.update(1.0 / 60.0);
+    }
+
+    return particles.get_positions();
+}
+
+TEST_F(OpenGLTest, ParticleSystem_BackendsSimulateAlike)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    RinvidGfx::set_viewport(0, 0, 32, 32);
+    RinvidGfx::init(nullptr);
+
+    // Spawn ranges are collapsed, so the result doesn't depend on how precise sin is on the GPU.
+    // Births are staggered over the default lifetime of two seconds, none of them falls on one of
+    // the first twelve frame boundaries, where rounding could move a birth by a frame.
+    const auto cpu = simulate_and_read_back(ParticleBackend::Cpu, 12U);
+    const auto gpu = simulate_and_read_back(ParticleBackend::TransformFeedback, 12U);
+
+    ASSERT_EQ(cpu.size(), 64U);
+    ASSERT_EQ(gpu.size(), 64U);
+
+    std::uint32_t moved{0U};
+    for (std::uint32_t i{0U}; i < cpu.size(); ++i)
+    {
+        EXPECT_NEAR(cpu[i].x, gpu[i].x, 0.01F) << "particle " << i;
+        EXPECT_NEAR(cpu[i].y, gpu[i].y, 0.01F) << "particle " << i;
+
+        if (cpu[i].x > 16.0F)
+        {
+            ++moved;
+        }
+    }
+
+    // Particles born during the first eleven frames have moved since
+    EXPECT_EQ(moved, 6U);
+    EXPECT_EQ(number_of_errors, errors::get_error_count());
+}
@@ -0,0 +1,71 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "core/include/perf_hud.h"
+#include "core/include/rinvid_gfx.h"
+#include "tests/include/opengl_test.h"
+#include "util/include/error_handler.h"
+
+using namespace rinvid;
+
+TEST_F(OpenGLTest, PerfHud_PercentilesOverSampleRing)
+{
+    PerfHud hud{};
+
+    EXPECT_EQ(hud.get_frame_time_percentile(50.0), 0.0);
+
+    // Oldest samples fall out of the ring
+    for (std::uint32_t frame{0U}; frame < PerfHud::NUMBER_OF_SAMPLES; ++frame)
+    {
+        hud.add_frame(1.0);
+    }
+    for (std::uint32_t frame{1U}; frame <= PerfHud::NUMBER_OF_SAMPLES; ++frame)
+    {
+        hud.add_frame(frame / 1000.0);
+    }
+
+    EXPECT_NEAR(hud.get_frame_time_percentile(50.0), 0.120, 1e-6);
+    EXPECT_NEAR(hud.get_frame_time_percentile(100.0), 0.240, 1e-6);
+    EXPECT_NEAR(hud.get_frame_time_percentile(0.0), 0.001, 1e-6);
+}
+
+TEST_F(OpenGLTest, PerfHud_DrawIsLeftOutOfFrameStats)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    RinvidGfx::set_viewport(0, 0, 640, 480);
+    RinvidGfx::init(nullptr);
+
+    PerfHud hud{};
+    for (std::uint32_t frame{0U}; frame < 10U; ++frame)
+    {
+        hud.add_frame(0.016);
+    }
+
+    // Stands in for what the screen has drawn this frame
+    RinvidGfx::reset_frame_stats();
+    RinvidGfx::count_draw_call(2U);
+    RinvidGfx::count_buffer_upload(64U);
+
+    hud.set_visible(true);
+    hud.draw();
+
+    const FrameStats& stats = RinvidGfx::get_frame_stats();
+    EXPECT_EQ(stats.draw_calls, 1U);
+    EXPECT_EQ(stats.triangles, 2U);
+    EXPECT_EQ(stats.program_switches, 0U);
+    EXPECT_EQ(stats.texture_binds, 0U);
+    EXPECT_EQ(stats.buffer_upload_bytes, 64U);
+    EXPECT_EQ(stats.uniform_sets, 0U);
+    EXPECT_EQ(number_of_errors, errors::get_error_count());
+
+    RinvidGfx::shutdown();
+}
@@ -0,0 +1,87 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "util/include/profiler.h"
+
+using namespace rinvid;
+
+TEST(ProfilerTest, ChromeTraceContainsZonesOfAllThreads)
+{
+    profiler::clear();
+
+    {
+        profiler::Zone zone{"main thread zone"};
+    }
+    std::thread worker{[] { profiler::Zone zone{"worker \"thread\" zone"}; }};
+    worker.join();
+
+    EXPECT_EQ(profiler::get_zone_count(), 2U);
+
+    const std::filesystem::path trace_file{"profiler_test_trace.json"};
+    ASSERT_TRUE(profiler::write_chrome_trace(trace_file.string()));
+
+    std::ifstream file{trace_file};
+    std::string   trace{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    file.close();
+    std::filesystem::remove(trace_file);
+
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0U);
+    EXPECT_NE(trace.find("\"name\":\"main thread zone\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"worker \\\"thread\\\" zone\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+}
+
+TEST(ProfilerTest, RingKeepsOnlyNewestZones)
+{
+    profiler::clear();
+
+    for (std::uint32_t i{0U}; i < profiler::ZONES_PER_THREAD + 10U; ++i)
+    {
+        profiler::record_zone("zone", profiler::get_time(), 0U);
+    }
+
+    EXPECT_EQ(profiler::get_zone_count(), profiler::ZONES_PER_THREAD);
+
+    profiler::clear();
+
+    EXPECT_EQ(profiler::get_zone_count(), 0U);
+}
+
+TEST(ProfilerTest, SummarizeZonesSumsZonesByName)
+{
+    profiler::clear();
+
+    const std::uint64_t start = profiler::get_time();
+    profiler::record_zone("long", start, 300U);
+    profiler::record_zone("short", start, 100U);
+    profiler::record_zone("long", start, 200U);
+    std::thread worker{[start] { profiler::record_zone("short", start, 50U); }};
+    worker.join();
+    profiler::record_zone("too early", start - 1U, 1000U);
+
+    const auto summaries = profiler::summarize_zones(start);
+
+    ASSERT_EQ(summaries.size(), 2U);
+    EXPECT_STREQ(summaries[0].name, "long");
+    EXPECT_EQ(summaries[0].total_duration, 500U);
+    EXPECT_EQ(summaries[0].count, 2U);
+    EXPECT_STREQ(summaries[1].name, "short");
+    EXPECT_EQ(summaries[1].total_duration, 150U);
+    EXPECT_EQ(summaries[1].count, 2U);
+
+    profiler::clear();
+}
@@ -0,0 +1,51 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "core/include/render_snapshot.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/sprite.h"
+#include "core/include/texture.h"
+#include "tests/include/opengl_test.h"
+
+using namespace rinvid;
+
+TEST_F(OpenGLTest, RenderSnapshot_DrawsSpritesAsTheyWereWhenAdded)
+{
+    RinvidGfx::set_viewport(0, 0, 32, 32);
+    RinvidGfx::init(nullptr);
+
+    Texture        texture{"resources/valid_image.png"};
+    Sprite         sprite{&texture, 8, 8, Vector2f{4.0F, 4.0F}, Vector2f{0.0F, 0.0F}};
+    RenderSnapshot snapshot{};
+
+    snapshot.add(sprite);
+    snapshot.add(sprite);
+
+    // Sprite is ready to draw once added, later changes don't reach the snapshot
+    EXPECT_FLOAT_EQ(sprite.get_origin().x, 8.0F);
+    sprite.move(Vector2f{10.0F, 10.0F});
+    EXPECT_EQ(snapshot.get_draw_count(), 2U);
+
+    RinvidGfx::reset_frame_stats();
+    snapshot.draw();
+    EXPECT_EQ(RinvidGfx::get_frame_stats().draw_calls, 2U);
+    // Sprite isn't animated, its vertices are not uploaded again
+    EXPECT_EQ(RinvidGfx::get_frame_stats().buffer_upload_bytes, 0U);
+
+    snapshot.clear();
+    EXPECT_EQ(snapshot.get_draw_count(), 0U);
+
+    RinvidGfx::reset_frame_stats();
+    snapshot.draw();
+    EXPECT_EQ(RinvidGfx::get_frame_stats().draw_calls, 0U);
+
+    RinvidGfx::shutdown();
+}
@@ -0,0 +1,84 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "core/include/resource_manager.h"
+#include "core/include/text.h"
+#include "tests/include/opengl_test.h"
+#include "util/include/error_handler.h"
+
+using namespace rinvid;
+
+namespace
+{
+
+std::string get_font_path()
+{
+    std::string file_path{__FILE__};
+    const auto  last_separator = file_path.find_last_of("/\\");
+    file_path.resize(last_separator);
+
+    const auto tests_separator = file_path.find_last_of("/\\");
+    file_path.resize(tests_separator);
+
+    return file_path + "/examples/full_demo/resources/aquifer.ttf";
+}
+
+} // namespace
+
+TEST_F(OpenGLTest, ResourceManager_SamePathReturnsSameTexture)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    ResourceManager resources{};
+    auto            texture1 = resources.get_texture("resources/valid_image.png");
+    auto            texture2 = resources.get_texture("resources/../resources/valid_image.png");
+
+    EXPECT_EQ(texture1, texture2);
+    EXPECT_EQ(resources.get_resource_count(), 1U);
+    EXPECT_EQ(resources.get_memory_usage().textures,
+              static_cast<std::size_t>(texture1->get_width() * texture1->get_height() * 4));
+    EXPECT_EQ(number_of_errors, errors::get_error_count());
+}
+
+TEST_F(OpenGLTest, ResourceManager_PurgeUnusedKeepsResourcesInUse)
+{
+    ResourceManager resources{};
+    resources.preload_textures({"resources/valid_image.png"});
+    auto font = resources.get_font(get_font_path());
+
+    EXPECT_EQ(resources.get_resource_count(), 2U);
+    EXPECT_GT(resources.get_memory_usage().fonts, 0U);
+
+    // Only the font is still referenced from outside of the cache
+    EXPECT_EQ(resources.purge_unused(), 1U);
+    EXPECT_EQ(resources.get_resource_count(), 1U);
+    EXPECT_EQ(resources.get_memory_usage().textures, 0U);
+
+    font.reset();
+    EXPECT_EQ(resources.purge_unused(), 1U);
+    EXPECT_EQ(resources.get_resource_count(), 0U);
+}
+
+TEST_F(OpenGLTest, ResourceManager_TextsShareFont)
+{
+    ResourceManager resources{};
+    auto            font = resources.get_font(get_font_path());
+
+    {
+        Text text1{"Hello", font, {0.0F, 0.0F}, Color{255, 255, 255, 255}, 18U};
+        Text text2{"World", font, {0.0F, 0.0F}, Color{255, 255, 255, 255}, 24U};
+        EXPECT_EQ(font.use_count(), 4);
+    }
+
+    EXPECT_EQ(font.use_count(), 2);
+}
@@ -7,6 +7,8 @@
  * repository for more details.
  **********************************************************************/
 
+#include <filesystem>
+#include <fstream>
 #include <utility>
 
 #include <gtest/gtest.h>
@@ -14,6 +16,7 @@
 #include "core/include/rinvid_gfx.h"
 #include "core/include/shader.h"
 #include "tests/include/opengl_test.h"
+#include "util/include/error_handler.h"
 
 namespace
 {
@@ -34,6 +37,14 @@ constexpr const char* fragment_shader_source =
     "    out_color = vec4(1.0, 1.0, 1.0, 1.0);\n"
     "}\n";
 
+constexpr const char* broken_fragment_shader_source =
+    "#version 330 core\n"
+    "out vec4 out_color;\n"
+    "void main()\n"
+    "{\n"
+    "    out_color = undeclared_color;\n"
+    "}\n";
+
 } // namespace
 
 TEST_F(OpenGLTest, ShaderMoveAssignment_LeavesDestinationUsable)
@@ -69,3 +80,86 @@ TEST_F(OpenGLTest, RinvidGfxShutdown_ReleasesDefaultShadersAndAllowsReinit)
     EXPECT_NE(rinvid::RinvidGfx::get_texture_default_shader_id(), 0U);
     EXPECT_NE(rinvid::RinvidGfx::get_text_default_shader_id(), 0U);
 }
+
+TEST_F(OpenGLTest, ShaderCache_SecondCompileLoadsBinary)
+{
+    GLint number_of_formats{0};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &number_of_formats);
+    if (number_of_formats == 0)
+    {
+        GTEST_SKIP();
+    }
+
+    const std::filesystem::path cache_directory{"shader_cache_test"};
+    std::filesystem::remove_all(cache_directory);
+    Shader::set_cache_directory(cache_directory.string());
+
+    Shader compiled{vertex_shader_source, fragment_shader_source};
+    // Binary is saved once link status is checked on first use
+    compiled.use();
+    Shader cached{vertex_shader_source, fragment_shader_source};
+
+    EXPECT_FALSE(compiled.is_loaded_from_cache());
+    EXPECT_TRUE(cached.is_loaded_from_cache());
+    EXPECT_NE(cached.get_id(), 0U);
+    EXPECT_NO_THROW(cached.use());
+
+    // Binary the driver rejects is replaced by a freshly compiled one
+    for (const auto& entry : std::filesystem::directory_iterator{cache_directory})
+    {
+        std::ofstream file{entry.path(), std::ios::binary | std::ios::trunc};
+        file << "not a program binary";
+    }
+
+    Shader recompiled{vertex_shader_source, fragment_shader_source};
+    recompiled.use();
+    Shader cached_again{vertex_shader_source, fragment_shader_source};
+
+    EXPECT_FALSE(recompiled.is_loaded_from_cache());
+    EXPECT_NE(recompiled.get_id(), 0U);
+    EXPECT_TRUE(cached_again.is_loaded_from_cache());
+
+    Shader::set_cache_directory("");
+    std::filesystem::remove_all(cache_directory);
+}
+
+TEST_F(OpenGLTest, ShaderCompileBatch_CreatesUsablePrograms)
+{
+    auto number_of_errors = rinvid::errors::get_error_count();
+
+    auto shaders = Shader::compile_batch({{vertex_shader_source, fragment_shader_source},
+                                          {vertex_shader_source, fragment_shader_source},
+                                          {vertex_shader_source, nullptr, {"gl_Position"}}});
+
+    ASSERT_EQ(shaders.size(), 3U);
+    for (const auto& shader : shaders)
+    {
+        EXPECT_NE(shader.get_id(), 0U);
+        shader.use();
+        EXPECT_TRUE(shader.is_ready());
+    }
+
+    EXPECT_EQ(number_of_errors, rinvid::errors::get_error_count());
+}
+
+TEST_F(OpenGLTest, ShaderCompileBatch_ReportsFailureOnFirstUse)
+{
+#ifndef RINVID_DEBUG_MODE
+    GTEST_SKIP();
+#endif
+    auto shaders = Shader::compile_batch({{vertex_shader_source, broken_fragment_shader_source}});
+
+    auto number_of_errors = rinvid::errors::get_error_count();
+    shaders[0].use();
+    auto errors_after_first_use = rinvid::errors::get_error_count();
+    shaders[0].use();
+
+    // Using a program that failed to link raises GL_INVALID_OPERATION, don't leak it to next test
+    while (glGetError() != GL_NO_ERROR)
+    {
+    }
+
+    EXPECT_GT(errors_after_first_use, number_of_errors);
+    // Failure is only reported once
+    EXPECT_EQ(errors_after_first_use, rinvid::errors::get_error_count());
+}
@@ -0,0 +1,145 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "core/include/object.h"
+#include "platformers/include/spatial_hash.h"
+#include "util/include/collision_detection.h"
+#include "util/include/error_handler.h"
+
+using namespace rinvid;
+
+TEST(SpatialHashTest, FindPairs_ReportsPairSpanningSeveralCellsOnce)
+{
+    Object big{};
+    big.reset(Vector2f{-50.0F, -50.0F});
+    big.resize(200.0F, 200.0F);
+    Object small{};
+    small.reset(Vector2f{60.0F, 60.0F});
+    small.resize(100.0F, 100.0F);
+
+    std::vector<Object*> group{&big, &small};
+    SpatialHash          hash{32.0F};
+
+    const auto& pairs = hash.find_pairs(group, group);
+
+    ASSERT_EQ(pairs.size(), 1U);
+    EXPECT_EQ(pairs[0].first, &big);
+    EXPECT_EQ(pairs[0].second, &small);
+}
+
+TEST(SpatialHashTest, SetCellSize_IgnoresSizesNotPositiveAndFinite)
+{
+    SpatialHash hash{32.0F};
+
+    for (float cell_size : {0.0F, -16.0F, std::numeric_limits<float>::infinity(),
+                            std::numeric_limits<float>::quiet_NaN()})
+    {
+        hash.set_cell_size(cell_size);
+        EXPECT_EQ(hash.get_cell_size(), 32.0F);
+    }
+
+    const SpatialHash default_hash{0.0F};
+    EXPECT_EQ(default_hash.get_cell_size(), DEFAULT_SPATIAL_HASH_CELL_SIZE);
+#ifdef RINVID_DEBUG_MODE
+    EXPECT_TRUE(errors::has_error_occured("SpatialHash: cell size must be positive and finite"));
+#endif
+}
+
+TEST(SpatialHashTest, FindPairs_FarAwayObjectsShareOutermostCells)
+{
+    Object far{};
+    far.reset(Vector2f{1.0e30F, 1.0e30F});
+    far.resize(10.0F, 10.0F);
+    Object also_far{};
+    also_far.reset(Vector2f{1.0e30F, 1.0e30F});
+    also_far.resize(10.0F, 10.0F);
+    Object far_other_side{};
+    far_other_side.reset(Vector2f{-1.0e30F, 1.0e30F});
+    far_other_side.resize(10.0F, 10.0F);
+
+    std::vector<Object*> group{&far, &also_far, &far_other_side};
+    SpatialHash          hash{32.0F};
+
+    const auto& pairs = hash.find_pairs(group, group);
+
+    ASSERT_EQ(pairs.size(), 1U);
+    EXPECT_EQ(pairs[0].first, &far);
+    EXPECT_EQ(pairs[0].second, &also_far);
+}
+
+TEST(SpatialHashTest, FindPairs_PairsOnlyAcrossGroups)
+{
+    Object a{};
+    Object b{};
+    Object c{};
+    for (auto* object : {&a, &b, &c})
+    {
+        object->reset(Vector2f{0.0F, 0.0F});
+        object->resize(10.0F, 10.0F);
+    }
+
+    std::vector<Object*> group_1{&a, &b};
+    std::vector<Object*> group_2{&c};
+    SpatialHash          hash{};
+
+    const auto& pairs = hash.find_pairs(group_1, group_2);
+
+    ASSERT_EQ(pairs.size(), 2U);
+    EXPECT_EQ(pairs[0].first, &a);
+    EXPECT_EQ(pairs[0].second, &c);
+    EXPECT_EQ(pairs[1].first, &b);
+    EXPECT_EQ(pairs[1].second, &c);
+}
+
+TEST(SpatialHashTest, FindPairs_MatchesTestingEveryPair)
+{
+    std::mt19937                          generator{7U};
+    std::uniform_real_distribution<float> position{-300.0F, 300.0F};
+    std::uniform_real_distribution<float> size{1.0F, 80.0F};
+
+    std::vector<std::unique_ptr<Object>> objects{};
+    std::vector<Object*>                 group{};
+    for (std::uint32_t i{0U}; i < 300U; ++i)
+    {
+        objects.push_back(std::make_unique<Object>());
+        objects.back()->reset(Vector2f{position(generator), position(generator)});
+        objects.back()->resize(size(generator), size(generator));
+        group.push_back(objects.back().get());
+    }
+
+    std::set<std::pair<Object*, Object*>> expected{};
+    for (std::size_t i{0U}; i < group.size(); ++i)
+    {
+        for (std::size_t j{i + 1U}; j < group.size(); ++j)
+        {
+            if (intersects(group[i]->bounding_rect(), group[j]->bounding_rect()))
+            {
+                expected.emplace(group[i], group[j]);
+            }
+        }
+    }
+
+    SpatialHash                           hash{};
+    std::set<std::pair<Object*, Object*>> found{};
+    for (const auto& pair : hash.find_pairs(group, group))
+    {
+        EXPECT_TRUE(found.emplace(pair.first, pair.second).second);
+    }
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(found, expected);
+}
@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include "core/include/font.h"
 #include "core/include/text.h"
 #include "core/include/ttf_lib.h"
 #include "tests/include/opengl_test.h"
@@ -45,7 +46,7 @@ TEST_F(OpenGLTest, TextDestroy_IsSafeAfterExplicitTTFLibDestroyRequest)
     EXPECT_NO_THROW(rinvid::TTFLib::destroy());
 }
 
-TEST_F(OpenGLTest, TextSetSize_RecreatesGlyphResources)
+TEST_F(OpenGLTest, TextSetSize_SwitchesBetweenGlyphSizes)
 {
     const auto font_path = get_font_path();
 
@@ -56,3 +57,27 @@ TEST_F(OpenGLTest, TextSetSize_RecreatesGlyphResources)
 
     rinvid::TTFLib::destroy();
 }
+
+TEST_F(OpenGLTest, FontGetGlyphs_RendersEachSizeOnce)
+{
+    rinvid::Font font{get_font_path()};
+
+    const auto& glyphs_18 = font.get_glyphs(18U);
+    EXPECT_EQ(glyphs_18.size(), 128U);
+    EXPECT_NE(glyphs_18.at('A').texture_id, 0U);
+    const auto glyph_memory = font.get_glyph_memory();
+    EXPECT_GT(glyph_memory, 0U);
+
+    // Texts of the same size share glyphs, switching back to a size doesn't render it again
+    {
+        rinvid::Text text{"Hello", std::shared_ptr<rinvid::Font>{&font, [](rinvid::Font*) {}},
+                          {0.0F, 0.0F}, rinvid::Color{255, 255, 255, 255}, 18U};
+        text.set_size(24U);
+        text.set_size(18U);
+    }
+    const auto& glyphs_24 = font.get_glyphs(24U);
+    EXPECT_EQ(&font.get_glyphs(18U), &glyphs_18);
+    EXPECT_NE(&glyphs_24, &glyphs_18);
+    EXPECT_GT(glyphs_24.at('A').size.y, glyphs_18.at('A').size.y);
+    EXPECT_GT(font.get_glyph_memory(), glyph_memory);
+}
@@ -7,11 +7,15 @@
  * repository for more details.
  **********************************************************************/
 
+#include <chrono>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "core/include/application.h"
 #include "core/include/sprite.h"
 #include "core/include/texture.h"
+#include "core/include/texture_loader.h"
 #include "include/texture_test.h"
 #include "util/include/error_handler.h"
 
@@ -97,3 +101,84 @@ TEST_F(TextureTest, Destructor)
     // Check that the number of errors did not increase.
     ASSERT_TRUE(number_of_errors == errors::get_error_count());
 }
+
+// Pumps uploads until there is nothing left to load or time runs out
+static void wait_for_texture_loader()
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+
+    while ((TextureLoader::get_pending_count() != 0U) &&
+           (std::chrono::steady_clock::now() < deadline))
+    {
+        TextureLoader::process_uploads();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+// Test asynchronous loading with a valid image file
+TEST_F(TextureTest, LoadAsync_ValidImageFile)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    auto texture = Texture::load_async("resources/valid_image.png");
+    EXPECT_FALSE(texture->is_loaded());
+
+    wait_for_texture_loader();
+    TextureLoader::shutdown();
+
+    EXPECT_TRUE(texture->is_loaded());
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
+
+// Test asynchronous loading with an invalid image file
+TEST_F(TextureTest, LoadAsync_InvalidImageFile)
+{
+    auto texture = Texture::load_async("invalid_image.png");
+
+    wait_for_texture_loader();
+    TextureLoader::shutdown();
+
+    EXPECT_FALSE(texture->is_loaded());
+}
+
+// Test that a texture dropped before loading finishes is skipped
+TEST_F(TextureTest, LoadAsync_DroppedTexture)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    {
+        auto texture = Texture::load_async("resources/valid_image.png");
+    }
+
+    wait_for_texture_loader();
+    TextureLoader::shutdown();
+
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
+
+// Test mipmap generation at load time
+TEST_F(TextureTest, Constructor_GenerateMipmaps)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    Texture texture{"resources/valid_image.png", true};
+    EXPECT_TRUE(texture.has_mipmaps());
+
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
+
+// Test changing filters with and without mip levels
+TEST_F(TextureTest, SetFilter)
+{
+    auto number_of_errors = errors::get_error_count();
+
+    Texture texture{"resources/valid_image.png"};
+    EXPECT_FALSE(texture.has_mipmaps());
+    texture.set_filter(TextureFilter::Nearest, TextureFilter::Nearest);
+
+    texture.generate_mipmaps();
+    EXPECT_TRUE(texture.has_mipmaps());
+    texture.set_filter(TextureFilter::Linear, TextureFilter::Nearest, TextureFilter::Nearest);
+
+    ASSERT_TRUE(number_of_errors == errors::get_error_count());
+}
@@ -0,0 +1,96 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "util/include/triple_buffer.h"
+
+using namespace rinvid;
+
+TEST(TripleBufferTest, AcquireLatest_ReturnsLastPublishedValue)
+{
+    TripleBuffer<int> buffer{};
+
+    EXPECT_EQ(buffer.acquire_latest(), 0);
+
+    buffer.get_write_buffer() = 1;
+    buffer.publish();
+    buffer.get_write_buffer() = 2;
+    buffer.publish();
+
+    EXPECT_EQ(buffer.acquire_latest(), 2);
+
+    // Nothing new was published, same value is returned again
+    EXPECT_EQ(buffer.acquire_latest(), 2);
+}
+
+TEST(TripleBufferTest, Publish_NeverHandsWriterTheBufferBeingRead)
+{
+    TripleBuffer<int> buffer{};
+
+    buffer.get_write_buffer() = 1;
+    buffer.publish();
+    const int& read = buffer.acquire_latest();
+
+    for (int value{2}; value < 10; ++value)
+    {
+        buffer.get_write_buffer() = value;
+        buffer.publish();
+        EXPECT_EQ(read, 1);
+    }
+
+    EXPECT_EQ(buffer.acquire_latest(), 9);
+}
+
+TEST(TripleBufferTest, Threads_ReaderOnlySeesWholeValuesInOrder)
+{
+    struct Value
+    {
+        std::uint64_t first;
+        std::uint64_t second;
+    };
+
+    TripleBuffer<Value>     buffer{};
+    constexpr std::uint64_t LAST_VALUE{100000U};
+
+    std::thread writer{[&buffer]() {
+        for (std::uint64_t value{1U}; value <= LAST_VALUE; ++value)
+        {
+            auto& write = buffer.get_write_buffer();
+            write.first  = value;
+            write.second = value;
+            buffer.publish();
+        }
+    }};
+
+    std::uint64_t previous{0U};
+    while (previous != LAST_VALUE)
+    {
+        const auto& read = buffer.acquire_latest();
+        ASSERT_EQ(read.first, read.second);
+        ASSERT_GE(read.first, previous);
+        previous = read.first;
+    }
+
+    writer.join();
+}
+
+TEST(TripleBufferTest, Reset_ForgetsPublishedValues)
+{
+    TripleBuffer<int> buffer{};
+
+    buffer.get_write_buffer() = 1;
+    buffer.publish();
+    buffer.reset();
+
+    EXPECT_EQ(buffer.acquire_latest(), 0);
+    EXPECT_EQ(buffer.get_write_buffer(), 0);
+}
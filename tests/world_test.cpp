@@ -7,11 +7,15 @@
  * repository for more details.
  **********************************************************************/
 
+#include <limits>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "core/include/object.h"
 #include "platformers/include/world.h"
 #include "tests/include/world_test.h"
+#include "util/include/error_handler.h"
 
 using namespace rinvid;
 
@@ -30,6 +34,15 @@ bool false_resolver(Object&, Object&)
     return false;
 }
 
+// Groups collided again by nested_resolver
+static std::vector<Object*> nested_group{};
+
+bool nested_resolver(Object&, Object&)
+{
+    ++resolver_call_count;
+    return World::collide(nested_group, nested_group, mock_resolver);
+}
+
 static void disable_physics_side_effects(Object& object)
 {
     object.set_drag({0.0F, 0.0F});
@@ -138,6 +151,24 @@ TEST_F(WorldTest, GroupGroup_TwoCollisions)
     EXPECT_EQ(resolver_call_count, 2);
 }
 
+TEST_F(WorldTest, GroupGroup_InvalidCellSizeIgnored)
+{
+    std::vector<Object*> group1{&a, &b};
+    std::vector<Object*> group2{&ab, &c, &d};
+
+    World::set_broadphase_cell_size(0.0F);
+    World::set_broadphase_cell_size(std::numeric_limits<float>::quiet_NaN());
+#ifdef RINVID_DEBUG_MODE
+    EXPECT_TRUE(
+        errors::has_error_occured("World: broadphase cell size must be positive and finite"));
+#endif
+
+    bool result = World::collide(group1, group2, mock_resolver);
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(resolver_call_count, 2);
+}
+
 TEST_F(WorldTest, GroupGroup_NoCollisions)
 {
     std::vector<Object*> group1{&a, &b};
@@ -160,16 +191,97 @@ TEST_F(WorldTest, GroupGroup_SkipsSameObjects_NoCollisions)
     EXPECT_EQ(resolver_call_count, 0);
 }
 
-TEST_F(WorldTest, GroupGroup_IdenticalGroups_SixCollisions)
+TEST_F(WorldTest, GroupGroup_IdenticalGroups_EachPairOnce)
 {
     std::vector<Object*> group1{&a, &b, &ab, &c, &d};
 
     bool result = World::collide(group1, group1, mock_resolver);
 
+    EXPECT_TRUE(result);
+    EXPECT_EQ(resolver_call_count, 3);
+}
+
+TEST_F(WorldTest, GroupGroup_SharedObjects_EachPairOnce)
+{
+    std::vector<Object*> group1{&a, &b};
+    std::vector<Object*> group2{&b, &a, &ab};
+
+    bool result = World::collide(group1, group2, mock_resolver);
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(resolver_call_count, 3);
+}
+
+TEST_F(WorldTest, GroupGroup_ResolverCollidesGroups_OuterPairsKept)
+{
+    std::vector<Object*> group1{&a, &b, &ab, &c, &d};
+    nested_group = {&a, &b, &c};
+
+    bool result = World::collide(group1, group1, nested_resolver);
+
+    // Each of the 3 outer pairs is resolved, and each resolve finds the 1 nested pair
     EXPECT_TRUE(result);
     EXPECT_EQ(resolver_call_count, 6);
 }
 
+TEST_F(WorldTest, GroupGroup_OwnBroadphase_TwoCollisions)
+{
+    std::vector<Object*> group1{&a, &b};
+    std::vector<Object*> group2{&ab, &c, &d};
+    SpatialHash          broadphase{8.0F};
+
+    bool result = World::collide(group1, group2, broadphase, mock_resolver);
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(resolver_call_count, 2);
+}
+
+/* ------------------------------------------------------------
+ * Tree
+ * ------------------------------------------------------------ */
+
+TEST_F(WorldTest, Tree_EachPairOnce)
+{
+    AabbTree<Object*> tree{};
+    for (auto* object : {&a, &b, &ab, &c, &d})
+    {
+        tree.create_proxy(object->bounding_rect(), object);
+    }
+
+    bool result = World::collide(tree, mock_resolver);
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(resolver_call_count, 3);
+}
+
+TEST_F(WorldTest, ObjectTree_SkipsSelf)
+{
+    AabbTree<Object*> tree{};
+    for (auto* object : {&a, &b, &c})
+    {
+        tree.create_proxy(object->bounding_rect(), object);
+    }
+
+    bool result = World::collide(a, tree, mock_resolver);
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(resolver_call_count, 1);
+}
+
+TEST_F(WorldTest, Refit_FollowsMovedObjects)
+{
+    AabbTree<Object*> tree{};
+    tree.create_proxy(c.bounding_rect(), &c);
+
+    c.reset(Vector2f{1.0F, 1.0F});
+    World::refit(tree);
+
+    bool result = World::collide(a, tree, mock_resolver);
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(resolver_call_count, 1);
+}
+
 /* ------------------------------------------------------------
  * Separation
  * ------------------------------------------------------------ */
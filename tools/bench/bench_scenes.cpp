@@ -0,0 +1,509 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_scenes.h"
+#include "core/include/animation.h"
+#include "core/include/circle_shape.h"
+#include "core/include/dynamic_texture.h"
+#include "core/include/font.h"
+#include "core/include/light.h"
+#include "core/include/light_manager.h"
+#include "core/include/object.h"
+#include "core/include/particle_system.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/sprite.h"
+#include "core/include/sprite_object.h"
+#include "core/include/text.h"
+#include "platformers/include/world.h"
+#include "util/include/color.h"
+#include "util/include/vector2.h"
+
+using namespace rinvid;
+
+namespace
+{
+
+constexpr std::uint32_t NUMBER_OF_SPRITES{2000U};
+constexpr std::uint32_t NUMBER_OF_ANIMATED_SPRITES{1000U};
+constexpr std::uint32_t NUMBER_OF_CIRCLES{2000U};
+constexpr std::uint32_t NUMBER_OF_TEXTS{20U};
+constexpr std::uint32_t NUMBER_OF_LIT_SPRITES{500U};
+constexpr std::uint32_t NUMBER_OF_COLLIDING_OBJECTS{400U};
+constexpr std::uint32_t NUMBER_OF_PARTICLES{200000U};
+constexpr std::uint32_t NUMBER_OF_MIPMAPPED_SPRITES{1000U};
+
+// Fixed seed, so that every run places objects the same way
+constexpr std::uint32_t RANDOM_SEED{1234U};
+
+const char* const LONG_TEXT{
+    "The quick brown fox jumps over the lazy dog while five boxing wizards jump quickly. "
+    "Pack my box with five dozen liquor jugs, then sphinx of black quartz, judge my vow. "
+    "How vexingly quick daft zebras jump! Jackdaws love my big sphinx of quartz. 0123456789"};
+
+/**************************************************************************************************
+ * @brief Creates a texture with a checkerboard pattern, so that scenes need no image files.
+ *
+ *************************************************************************************************/
+std::unique_ptr<DynamicTexture> make_checker_texture(std::int32_t width, std::int32_t height,
+                                                     std::int32_t cell_size)
+{
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width * height * 4));
+    for (std::int32_t y{0}; y < height; ++y)
+    {
+        for (std::int32_t x{0}; x < width; ++x)
+        {
+            const bool         light_cell = (((x / cell_size) + (y / cell_size)) % 2) == 0;
+            const std::uint8_t value      = light_cell ? 230U : 60U;
+            auto*              pixel = &pixels[static_cast<std::size_t>((y * width + x) * 4)];
+            pixel[0]                 = value;
+            pixel[1]                 = static_cast<std::uint8_t>((x * 255) / width);
+            pixel[2]                 = static_cast<std::uint8_t>((y * 255) / height);
+            pixel[3]                 = 255U;
+        }
+    }
+
+    auto texture = std::make_unique<DynamicTexture>(width, height);
+    texture->update(pixels.data());
+
+    return texture;
+}
+
+/**************************************************************************************************
+ * @brief Position and velocity of something bouncing around the screen.
+ *
+ *************************************************************************************************/
+struct Mover
+{
+    Vector2f position;
+    Vector2f velocity;
+};
+
+std::vector<Mover> make_movers(std::uint32_t count, float size)
+{
+    std::mt19937                          generator{RANDOM_SEED};
+    std::uniform_real_distribution<float> x{0.0F, RinvidGfx::get_width() - size};
+    std::uniform_real_distribution<float> y{0.0F, RinvidGfx::get_height() - size};
+    std::uniform_real_distribution<float> speed{-150.0F, 150.0F};
+
+    std::vector<Mover> movers{};
+    movers.reserve(count);
+    for (std::uint32_t i{0U}; i < count; ++i)
+    {
+        movers.push_back(Mover{Vector2f{x(generator), y(generator)},
+                               Vector2f{speed(generator), speed(generator)}});
+    }
+
+    return movers;
+}
+
+/**************************************************************************************************
+ * @brief Moves mover, bouncing it off screen edges.
+ *
+ * @return Distance moved
+ *
+ *************************************************************************************************/
+Vector2f step(Mover& mover, double delta_time, float size)
+{
+    const float time = static_cast<float>(delta_time);
+    Vector2f    move{mover.velocity.x * time, mover.velocity.y * time};
+
+    const float max_x = RinvidGfx::get_width() - size;
+    const float max_y = RinvidGfx::get_height() - size;
+    if (((mover.position.x + move.x) < 0.0F) || ((mover.position.x + move.x) > max_x))
+    {
+        mover.velocity.x = -mover.velocity.x;
+        move.x           = -move.x;
+    }
+    if (((mover.position.y + move.y) < 0.0F) || ((mover.position.y + move.y) > max_y))
+    {
+        mover.velocity.y = -mover.velocity.y;
+        move.y           = -move.y;
+    }
+    mover.position.x += move.x;
+    mover.position.y += move.y;
+
+    return move;
+}
+
+/**************************************************************************************************
+ * @brief Moving sprites sharing one texture.
+ *
+ *************************************************************************************************/
+class SpritesScene : public BenchScene
+{
+  public:
+    SpritesScene() : texture_{make_checker_texture(64, 64, 8)}
+    {
+        movers_ = make_movers(NUMBER_OF_SPRITES, SIZE);
+        for (const auto& mover : movers_)
+        {
+            sprites_.push_back(std::make_unique<Sprite>(texture_.get(), 32, 32, mover.position));
+        }
+    }
+
+    void update(double delta_time) override
+    {
+        for (std::uint32_t i{0U}; i < sprites_.size(); ++i)
+        {
+            sprites_[i]->move(step(movers_[i], delta_time, SIZE));
+            sprites_[i]->draw();
+        }
+    }
+
+  private:
+    static constexpr float SIZE{32.0F};
+
+    std::unique_ptr<DynamicTexture>      texture_;
+    std::vector<Mover>                   movers_;
+    std::vector<std::unique_ptr<Sprite>> sprites_;
+};
+
+/**************************************************************************************************
+ * @brief Moving sprites playing a looping animation from a sprite sheet.
+ *
+ *************************************************************************************************/
+class AnimatedSpritesScene : public BenchScene
+{
+  public:
+    AnimatedSpritesScene() : texture_{make_checker_texture(256, 64, 16)}
+    {
+        movers_ = make_movers(NUMBER_OF_ANIMATED_SPRITES, SIZE);
+        for (const auto& mover : movers_)
+        {
+            auto  sprite    = std::make_unique<Sprite>(texture_.get(), 64, 64, mover.position);
+            auto& animation = sprite->get_animation();
+            animation.add_animation("spin",
+                                    Animation{12.0, animation.split_animation_frames(64, 64, 4, 1),
+                                              AnimationMode::Looping});
+            animation.play("spin");
+            sprites_.push_back(std::move(sprite));
+        }
+    }
+
+    void update(double delta_time) override
+    {
+        for (std::uint32_t i{0U}; i < sprites_.size(); ++i)
+        {
+            sprites_[i]->move(step(movers_[i], delta_time, SIZE));
+            sprites_[i]->draw(delta_time);
+        }
+    }
+
+  private:
+    static constexpr float SIZE{64.0F};
+
+    std::unique_ptr<DynamicTexture>      texture_;
+    std::vector<Mover>                   movers_;
+    std::vector<std::unique_ptr<Sprite>> sprites_;
+};
+
+/**************************************************************************************************
+ * @brief Moving circles of different colors.
+ *
+ *************************************************************************************************/
+class CirclesScene : public BenchScene
+{
+  public:
+    CirclesScene()
+    {
+        movers_ = make_movers(NUMBER_OF_CIRCLES, 2.0F * RADIUS);
+        for (std::uint32_t i{0U}; i < movers_.size(); ++i)
+        {
+            const Vector2f center{movers_[i].position.x + RADIUS, movers_[i].position.y + RADIUS};
+            auto           circle = std::make_unique<CircleShape>(center, RADIUS);
+            circle->set_color(Color{(i % 3U) / 2.0F, (i % 5U) / 4.0F, (i % 7U) / 6.0F, 1.0F});
+            circles_.push_back(std::move(circle));
+        }
+    }
+
+    void update(double delta_time) override
+    {
+        for (std::uint32_t i{0U}; i < circles_.size(); ++i)
+        {
+            circles_[i]->move(step(movers_[i], delta_time, 2.0F * RADIUS));
+            circles_[i]->draw();
+        }
+    }
+
+  private:
+    static constexpr float RADIUS{8.0F};
+
+    std::vector<Mover>                        movers_;
+    std::vector<std::unique_ptr<CircleShape>> circles_;
+};
+
+/**************************************************************************************************
+ * @brief Long wrapped texts scrolling up the screen.
+ *
+ *************************************************************************************************/
+class TextScene : public BenchScene
+{
+  public:
+    TextScene(const std::string& resource_dir)
+        : font_{std::make_shared<Font>(resource_dir + "/aquifer.ttf")}, scroll_{0.0F}
+    {
+        for (std::uint32_t i{0U}; i < NUMBER_OF_TEXTS; ++i)
+        {
+            auto text = std::make_unique<Text>(LONG_TEXT, font_, Vector2f{20.0F, 0.0F},
+                                               Color{1.0F, 1.0F, 1.0F, 1.0F}, 16U);
+            text->set_max_width(RinvidGfx::get_width() - 40.0F);
+            texts_.push_back(std::move(text));
+        }
+    }
+
+    void update(double delta_time) override
+    {
+        scroll_ = std::fmod(scroll_ + 60.0F * static_cast<float>(delta_time), LINE_SPACING);
+        for (std::uint32_t i{0U}; i < texts_.size(); ++i)
+        {
+            texts_[i]->set_position(Vector2f{20.0F, i * LINE_SPACING - scroll_});
+            texts_[i]->draw();
+        }
+    }
+
+  private:
+    static constexpr float LINE_SPACING{30.0F};
+
+    std::shared_ptr<Font>              font_;
+    std::vector<std::unique_ptr<Text>> texts_;
+    float                              scroll_;
+};
+
+/**************************************************************************************************
+ * @brief Maximum number of lights circling over sprites lit by them.
+ *
+ *************************************************************************************************/
+class LightsScene : public BenchScene
+{
+  public:
+    LightsScene() : texture_{make_checker_texture(64, 64, 8)}, angle_{0.0F}
+    {
+        LightManager::activate_ambient_light(0.1F);
+
+        movers_ = make_movers(NUMBER_OF_LIT_SPRITES, SIZE);
+        for (const auto& mover : movers_)
+        {
+            sprites_.push_back(std::make_unique<Sprite>(texture_.get(), 32, 32, mover.position));
+        }
+
+        lights_.reserve(MAX_NUMBER_OF_LIGHTS);
+        for (std::uint32_t i{0U}; i < MAX_NUMBER_OF_LIGHTS; ++i)
+        {
+            lights_.emplace_back(light_position(i), 0.6F, 0.5F);
+        }
+    }
+
+    void update(double delta_time) override
+    {
+        angle_ += static_cast<float>(delta_time);
+        for (std::uint32_t i{0U}; i < lights_.size(); ++i)
+        {
+            lights_[i].set_position(light_position(i));
+            lights_[i].update();
+        }
+
+        for (std::uint32_t i{0U}; i < sprites_.size(); ++i)
+        {
+            sprites_[i]->move(step(movers_[i], delta_time, SIZE));
+            sprites_[i]->draw();
+        }
+    }
+
+  private:
+    static constexpr float SIZE{32.0F};
+
+    Vector2f light_position(std::uint32_t light) const
+    {
+        const float    radius = 40.0F + (light % 10U) * 25.0F;
+        const float    angle  = angle_ + light * 0.6F;
+        const Vector2f center{RinvidGfx::get_width() / 2.0F, RinvidGfx::get_height() / 2.0F};
+
+        return Vector2f{center.x + radius * std::cos(angle), center.y + radius * std::sin(angle)};
+    }
+
+    std::unique_ptr<DynamicTexture>      texture_;
+    std::vector<Mover>                   movers_;
+    std::vector<std::unique_ptr<Sprite>> sprites_;
+    std::vector<Light>                   lights_;
+    float                                angle_;
+};
+
+/**************************************************************************************************
+ * @brief Falling objects piling up in a box, all of them colliding as one group.
+ *
+ *************************************************************************************************/
+class CollisionsScene : public BenchScene
+{
+  public:
+    CollisionsScene() : texture_{make_checker_texture(16, 16, 4)}
+    {
+        const float width  = static_cast<float>(RinvidGfx::get_width());
+        const float height = static_cast<float>(RinvidGfx::get_height());
+        add_wall(Vector2f{0.0F, height - WALL_THICKNESS}, width, WALL_THICKNESS);
+        add_wall(Vector2f{0.0F, 0.0F}, WALL_THICKNESS, height);
+        add_wall(Vector2f{width - WALL_THICKNESS, 0.0F}, WALL_THICKNESS, height);
+
+        std::mt19937                          generator{RANDOM_SEED};
+        std::uniform_real_distribution<float> speed{-100.0F, 100.0F};
+
+        // Start objects on a grid, so that they don't overlap
+        const std::uint32_t columns = 40U;
+        for (std::uint32_t i{0U}; i < NUMBER_OF_COLLIDING_OBJECTS; ++i)
+        {
+            const Vector2f position{WALL_THICKNESS + 4.0F + (i % columns) * (SIZE + 2.0F),
+                                    20.0F + (i / columns) * (SIZE + 2.0F)};
+            auto object = std::make_unique<SpriteObject>(texture_.get(), 16, 16, position);
+            object->set_velocity(Vector2f{speed(generator), speed(generator)});
+            object->set_drag(Vector2f{20.0F, 0.0F});
+            object->set_max_velocity(400.0F);
+            group_.push_back(object.get());
+            objects_.push_back(std::move(object));
+        }
+    }
+
+    void update(double delta_time) override
+    {
+        for (auto& object : objects_)
+        {
+            object->update(delta_time);
+        }
+
+        World::collide(group_, group_);
+
+        for (auto& object : objects_)
+        {
+            object->draw(delta_time);
+        }
+    }
+
+  private:
+    static constexpr float SIZE{16.0F};
+    static constexpr float WALL_THICKNESS{16.0F};
+
+    void add_wall(Vector2f top_left, float width, float height)
+    {
+        auto wall =
+            std::make_unique<SpriteObject>(texture_.get(), static_cast<std::int32_t>(width),
+                                           static_cast<std::int32_t>(height), top_left);
+        wall->set_gravity_scale(0.0F);
+        wall->set_movable(NOT);
+        group_.push_back(wall.get());
+        objects_.push_back(std::move(wall));
+    }
+
+    std::unique_ptr<DynamicTexture>            texture_;
+    std::vector<std::unique_ptr<SpriteObject>> objects_;
+    std::vector<Object*>                       group_;
+};
+
+/**************************************************************************************************
+ * @brief Rain effect simulated on the GPU.
+ *
+ *************************************************************************************************/
+class ParticlesScene : public BenchScene
+{
+  public:
+    ParticlesScene() : particles_{NUMBER_OF_PARTICLES, ParticleBackend::TransformFeedback}
+    {
+        ParticleEmitterParams params{};
+        params.position     = Vector2f{RinvidGfx::get_width() / 2.0F, -20.0F};
+        params.spawn_area   = Vector2f{RinvidGfx::get_width() / 2.0F, 10.0F};
+        params.min_velocity = Vector2f{-20.0F, 300.0F};
+        params.max_velocity = Vector2f{20.0F, 500.0F};
+        params.acceleration = Vector2f{30.0F, 400.0F};
+        params.min_lifetime = 1.0F;
+        params.max_lifetime = 1.6F;
+        params.size         = 2.0F;
+        params.start_color  = Color{0.6F, 0.7F, 1.0F, 0.9F};
+        params.end_color    = Color{0.6F, 0.7F, 1.0F, 0.0F};
+        particles_.set_emitter(params);
+    }
+
+    void update(double delta_time) override
+    {
+        particles_.update(delta_time);
+        particles_.draw();
+    }
+
+  private:
+    ParticleSystem particles_;
+};
+
+/**************************************************************************************************
+ * @brief Large mipmapped texture drawn scaled down many times.
+ *
+ *************************************************************************************************/
+class MipmappedSpritesScene : public BenchScene
+{
+  public:
+    MipmappedSpritesScene() : texture_{make_checker_texture(256, 256, 4)}
+    {
+        texture_->generate_mipmaps();
+        texture_->set_filter(TextureFilter::Linear, TextureFilter::Linear, TextureFilter::Linear);
+
+        movers_ = make_movers(NUMBER_OF_MIPMAPPED_SPRITES, SIZE);
+        for (const auto& mover : movers_)
+        {
+            auto sprite = std::make_unique<Sprite>(texture_.get(), 256, 256, mover.position);
+            sprite->set_scale(SIZE / 256.0F);
+            sprites_.push_back(std::move(sprite));
+        }
+    }
+
+    void update(double delta_time) override
+    {
+        for (std::uint32_t i{0U}; i < sprites_.size(); ++i)
+        {
+            sprites_[i]->move(step(movers_[i], delta_time, SIZE));
+            sprites_[i]->draw();
+        }
+    }
+
+  private:
+    static constexpr float SIZE{32.0F};
+
+    std::unique_ptr<DynamicTexture>      texture_;
+    std::vector<Mover>                   movers_;
+    std::vector<std::unique_ptr<Sprite>> sprites_;
+};
+
+template <typename T>
+std::unique_ptr<BenchScene> create_scene(const std::string&)
+{
+    return std::make_unique<T>();
+}
+
+std::unique_ptr<BenchScene> create_text_scene(const std::string& resource_dir)
+{
+    return std::make_unique<TextScene>(resource_dir);
+}
+
+} // namespace
+
+const std::vector<BenchSceneInfo>& get_bench_scenes()
+{
+    static const std::vector<BenchSceneInfo> scenes{
+        {"sprites", NUMBER_OF_SPRITES, create_scene<SpritesScene>},
+        {"animated_sprites", NUMBER_OF_ANIMATED_SPRITES, create_scene<AnimatedSpritesScene>},
+        {"circles", NUMBER_OF_CIRCLES, create_scene<CirclesScene>},
+        {"text", NUMBER_OF_TEXTS, create_text_scene},
+        {"lights", MAX_NUMBER_OF_LIGHTS, create_scene<LightsScene>},
+        {"collisions", NUMBER_OF_COLLIDING_OBJECTS, create_scene<CollisionsScene>},
+        {"particles", NUMBER_OF_PARTICLES, create_scene<ParticlesScene>},
+        {"mipmapped_sprites", NUMBER_OF_MIPMAPPED_SPRITES, create_scene<MipmappedSpritesScene>}};
+
+    return scenes;
+}
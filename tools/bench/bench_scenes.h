@@ -0,0 +1,61 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef TOOLS_BENCH_BENCH_SCENES_H
+#define TOOLS_BENCH_BENCH_SCENES_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**************************************************************************************************
+ * @brief A scripted scene. Scenes don't read input and don't depend on frame time, so every run
+ * draws exactly the same frames.
+ *
+ *************************************************************************************************/
+class BenchScene
+{
+  public:
+    virtual ~BenchScene()
+    {
+    }
+
+    /**************************************************************************************************
+     * @brief Simulates and draws one frame.
+     *
+     * @param delta_time Time step in seconds
+     *
+     *************************************************************************************************/
+    virtual void update(double delta_time) = 0;
+};
+
+/**************************************************************************************************
+ * @brief Describes a scene and how to create it.
+ *
+ *************************************************************************************************/
+struct BenchSceneInfo
+{
+    /// Name used in reports and on the command line.
+    const char* name;
+    /// Number of objects (sprites, shapes, lights...) the scene is made of.
+    std::uint32_t object_count;
+    /// Creates the scene. Rendering must already be initialized. Resource directory is passed in.
+    std::unique_ptr<BenchScene> (*create)(const std::string& resource_dir);
+};
+
+/**************************************************************************************************
+ * @brief Returns all scenes, in the order they are run.
+ *
+ * @return Scene descriptions
+ *
+ *************************************************************************************************/
+const std::vector<BenchSceneInfo>& get_bench_scenes();
+
+#endif // TOOLS_BENCH_BENCH_SCENES_H
@@ -0,0 +1,355 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <SFML/Window/Context.hpp>
+
+#include "bench_scenes.h"
+#include "core/include/rinvid_gfx.h"
+#include "core/include/rinvid_gl.h"
+#include "core/include/ttf_lib.h"
+#include "util/include/error_handler.h"
+
+using namespace rinvid;
+
+namespace
+{
+
+constexpr std::int32_t SCREEN_WIDTH{800};
+constexpr std::int32_t SCREEN_HEIGHT{600};
+// Scenes are stepped with a fixed time step, so that they don't depend on how fast frames are
+constexpr double TIME_STEP{1.0 / 60.0};
+
+struct Options
+{
+    std::uint32_t warmup_frames{30U};
+    std::uint32_t frames{300U};
+    std::string   scene{};
+    std::string   output{};
+};
+
+struct SceneResult
+{
+    const BenchSceneInfo* info;
+    std::vector<double>   frame_times;
+    FrameStats            frame_stats;
+};
+
+void print_usage()
+{
+    std::cout << "Usage: rinvid_bench [--frames N] [--warmup N] [--scene NAME] [--output FILE]"
+                 " [--list]\n";
+}
+
+bool parse_count(const char* text, std::uint32_t& count)
+{
+    char*               end   = nullptr;
+    const unsigned long value = std::strtoul(text, &end, 10);
+    if ((end == text) || (*end != '\0'))
+    {
+        return false;
+    }
+    count = static_cast<std::uint32_t>(value);
+
+    return true;
+}
+
+/**************************************************************************************************
+ * @brief Offscreen render target, so that nothing has to be shown and no swap can wait on vsync.
+ *
+ *************************************************************************************************/
+class OffscreenTarget
+{
+  public:
+    OffscreenTarget(std::int32_t width, std::int32_t height)
+    {
+        GL_CALL(glGenRenderbuffers(1, &renderbuffer_));
+        GL_CALL(glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer_));
+        GL_CALL(glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height));
+
+        GL_CALL(glGenFramebuffers(1, &framebuffer_));
+        GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_));
+        GL_CALL(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                          renderbuffer_));
+    }
+
+    ~OffscreenTarget()
+    {
+        GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+        GL_CALL(glDeleteFramebuffers(1, &framebuffer_));
+        GL_CALL(glDeleteRenderbuffers(1, &renderbuffer_));
+    }
+
+    OffscreenTarget(const OffscreenTarget& other) = delete;
+
+    OffscreenTarget& operator=(const OffscreenTarget& other) = delete;
+
+    bool is_complete() const
+    {
+        return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    }
+
+  private:
+    std::uint32_t framebuffer_{};
+    std::uint32_t renderbuffer_{};
+};
+
+SceneResult run_scene(const BenchSceneInfo& info, const Options& options,
+                      const std::string& resource_dir)
+{
+    SceneResult result{&info, {}, {}};
+    result.frame_times.reserve(options.frames);
+
+    // Each scene gets fresh default shaders, so that state set by one (e.g. lights) doesn't leak
+    // into the next one
+    RinvidGfx::set_viewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    RinvidGfx::init(nullptr);
+
+    {
+        auto scene = info.create(resource_dir);
+
+        for (std::uint32_t frame{0U}; frame < options.warmup_frames + options.frames; ++frame)
+        {
+            RinvidGfx::reset_frame_stats();
+            auto start = std::chrono::steady_clock::now();
+
+            RinvidGfx::clear_screen(0.1F, 0.1F, 0.1F, 1.0F);
+            scene->update(TIME_STEP);
+            // Wait for the GPU, so that frame time covers the work it was given
+            glFinish();
+
+            std::chrono::duration<double> frame_time = std::chrono::steady_clock::now() - start;
+            if (frame >= options.warmup_frames)
+            {
+                result.frame_times.push_back(frame_time.count());
+            }
+        }
+
+        result.frame_stats = RinvidGfx::get_frame_stats();
+    }
+
+    RinvidGfx::shutdown();
+
+    return result;
+}
+
+double get_percentile(const std::vector<double>& sorted_times, double percentile)
+{
+    if (sorted_times.empty())
+    {
+        return 0.0;
+    }
+
+    const double rank = std::ceil(percentile / 100.0 * sorted_times.size());
+    const auto   index =
+        static_cast<std::size_t>(std::clamp(rank, 1.0, static_cast<double>(sorted_times.size())));
+
+    return sorted_times[index - 1U];
+}
+
+std::string escape_json(const std::string& text)
+{
+    std::string escaped{};
+    for (const char character : text)
+    {
+        if ((character == '"') || (character == '\\'))
+        {
+            escaped += '\\';
+        }
+        if (static_cast<unsigned char>(character) >= 0x20U)
+        {
+            escaped += character;
+        }
+    }
+
+    return escaped;
+}
+
+void write_report(std::ostream& stream, const std::string& renderer,
+                  const std::vector<SceneResult>& results)
+{
+    stream << std::fixed << std::setprecision(4);
+    stream << "{\n  \"renderer\": \"" << escape_json(renderer) << "\",\n";
+    stream << "  \"width\": " << SCREEN_WIDTH << ",\n  \"height\": " << SCREEN_HEIGHT << ",\n";
+    stream << "  \"scenes\": [";
+
+    for (std::size_t i{0U}; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+        auto        sorted = result.frame_times;
+        std::sort(sorted.begin(), sorted.end());
+
+        double total_time{0.0};
+        for (const auto frame_time : sorted)
+        {
+            total_time += frame_time;
+        }
+        const double mean = sorted.empty() ? 0.0 : total_time / sorted.size();
+        const double max  = sorted.empty() ? 0.0 : sorted.back();
+        const auto&  stats = result.frame_stats;
+
+        double squared_deviations{0.0};
+        for (const auto frame_time : sorted)
+        {
+            squared_deviations += (frame_time - mean) * (frame_time - mean);
+        }
+        const double stddev =
+            (sorted.size() < 2U) ? 0.0 : std::sqrt(squared_deviations / (sorted.size() - 1U));
+
+        stream << ((i == 0U) ? "\n" : ",\n");
+        stream << "    {\"name\": \"" << result.info->name << "\""
+               << ", \"objects\": " << result.info->object_count
+               << ", \"frames\": " << sorted.size() << ",\n";
+        stream << "     \"mean_ms\": " << mean * 1000.0
+               << ", \"p50_ms\": " << get_percentile(sorted, 50.0) * 1000.0
+               << ", \"p99_ms\": " << get_percentile(sorted, 99.0) * 1000.0
+               << ", \"max_ms\": " << max * 1000.0 << ", \"stddev_ms\": " << stddev * 1000.0
+               << ",\n";
+        stream << "     \"draw_calls\": " << stats.draw_calls
+               << ", \"triangles\": " << stats.triangles
+               << ", \"program_switches\": " << stats.program_switches
+               << ", \"texture_binds\": " << stats.texture_binds
+               << ", \"buffer_upload_bytes\": " << stats.buffer_upload_bytes
+               << ", \"uniform_sets\": " << stats.uniform_sets << "}";
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options{};
+
+    for (int i{1}; i < argc; ++i)
+    {
+        const bool has_value = (i + 1) < argc;
+        if (std::strcmp(argv[i], "--list") == 0)
+        {
+            for (const auto& scene : get_bench_scenes())
+            {
+                std::cout << scene.name << '\n';
+            }
+            return 0;
+        }
+        else if ((std::strcmp(argv[i], "--frames") == 0) && has_value &&
+                 parse_count(argv[i + 1], options.frames))
+        {
+            ++i;
+        }
+        else if ((std::strcmp(argv[i], "--warmup") == 0) && has_value &&
+                 parse_count(argv[i + 1], options.warmup_frames))
+        {
+            ++i;
+        }
+        else if ((std::strcmp(argv[i], "--scene") == 0) && has_value)
+        {
+            options.scene = argv[++i];
+        }
+        else if ((std::strcmp(argv[i], "--output") == 0) && has_value)
+        {
+            options.output = argv[++i];
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    std::vector<const BenchSceneInfo*> scenes{};
+    for (const auto& scene : get_bench_scenes())
+    {
+        if (options.scene.empty() || (options.scene == scene.name))
+        {
+            scenes.push_back(&scene);
+        }
+    }
+    if (scenes.empty())
+    {
+        std::cerr << "Unknown scene: " << options.scene << '\n';
+        return 1;
+    }
+
+    // No window is needed, scenes are drawn into an offscreen target
+    sf::Context context{};
+    if (!context.setActive(true))
+    {
+        std::cerr << "Failed to activate OpenGL context\n";
+        return 1;
+    }
+#ifdef _WIN32
+    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(sf::Context::getFunction)))
+    {
+        std::cerr << "Failed to load OpenGL functions\n";
+        return 1;
+    }
+#endif
+
+    const auto* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    const auto  resource_dir =
+        (std::filesystem::path{argv[0]}.parent_path() / "resources").generic_string();
+
+    std::vector<SceneResult> results{};
+    {
+        OffscreenTarget target{SCREEN_WIDTH, SCREEN_HEIGHT};
+        if (!target.is_complete())
+        {
+            std::cerr << "Failed to create offscreen render target\n";
+            return 1;
+        }
+
+        for (const auto* scene : scenes)
+        {
+            try
+            {
+                results.push_back(run_scene(*scene, options, resource_dir));
+            }
+            catch (...)
+            {
+                std::cerr << "Failed to create scene: " << scene->name << '\n';
+                RinvidGfx::shutdown();
+                return 1;
+            }
+        }
+    }
+
+    TTFLib::destroy();
+
+    const std::string renderer_name{(renderer != nullptr) ? renderer : "unknown"};
+    if (options.output.empty())
+    {
+        write_report(std::cout, renderer_name, results);
+    }
+    else
+    {
+        std::ofstream file{options.output};
+        write_report(file, renderer_name, results);
+        if (!file)
+        {
+            std::cerr << "Failed to write " << options.output << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
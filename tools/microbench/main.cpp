@@ -0,0 +1,303 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/include/animation.h"
+#include "core/include/body_store.h"
+#include "core/include/object.h"
+#include "core/include/sprite_animation.h"
+#include "core/include/sprite_object.h"
+#include "core/include/transformable.h"
+#include "microbench.h"
+#include "platformers/include/world.h"
+#include "util/include/collision_detection.h"
+#include "util/include/color.h"
+#include "util/include/rect.h"
+
+using namespace rinvid;
+
+namespace
+{
+
+constexpr double TIME_STEP{1.0 / 60.0};
+
+/**************************************************************************************************
+ * @brief Object whose previous position can be set directly, so that a collision can be set up
+ * again each iteration without simulating motion.
+ *
+ *************************************************************************************************/
+class BenchObject : public Object
+{
+  public:
+    void place(Vector2f previous_position, Vector2f position, std::int32_t size)
+    {
+        previous_position_ = previous_position;
+        position_          = position;
+        width_             = size;
+        height_            = size;
+        velocity_          = Vector2f{0.0F, 0.0F};
+    }
+};
+
+/**************************************************************************************************
+ * @brief Creates objects on a grid, spaced so that each one overlaps its neighbours.
+ *
+ *************************************************************************************************/
+std::vector<BenchObject> make_grid(std::int64_t count)
+{
+    constexpr std::int32_t size{32};
+    constexpr float        spacing{24.0F};
+    constexpr std::int64_t columns{16};
+
+    std::vector<BenchObject> objects(static_cast<std::size_t>(count));
+    for (std::int64_t i{0}; i < count; ++i)
+    {
+        const Vector2f position{(i % columns) * spacing, (i / columns) * spacing};
+        objects[static_cast<std::size_t>(i)].place(position, position, size);
+    }
+
+    return objects;
+}
+
+std::vector<Object*> get_pointers(std::vector<BenchObject>& objects)
+{
+    std::vector<Object*> pointers{};
+    for (auto& object : objects)
+    {
+        pointers.push_back(&object);
+    }
+
+    return pointers;
+}
+
+// Counts a collision without moving anything, so that every iteration sees the same overlaps
+bool keep_overlapping(Object&, Object&)
+{
+    return true;
+}
+
+void intersects_bench(microbench::State& state)
+{
+    Rect rect_1{Vector2f{0.0F, 0.0F}, 32, 32};
+    Rect rect_2{Vector2f{16.0F, 16.0F}, 32, 32};
+
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(rect_2);
+        bool result = intersects(rect_1, rect_2);
+        microbench::do_not_optimize(result);
+    }
+}
+
+void world_separate_bench(microbench::State& state)
+{
+    BenchObject object_1{};
+    BenchObject object_2{};
+
+    while (state.keep_running())
+    {
+        // Object 1 moved 6 pixels right, into object 2
+        object_1.place(Vector2f{0.0F, 0.0F}, Vector2f{6.0F, 0.0F}, 32);
+        object_2.place(Vector2f{34.0F, 0.0F}, Vector2f{34.0F, 0.0F}, 32);
+        bool result = World::separate(object_1, object_2);
+        microbench::do_not_optimize(result);
+    }
+}
+
+void world_collide_object_group_bench(microbench::State& state)
+{
+    auto objects = make_grid(state.get_argument());
+    auto group   = get_pointers(objects);
+
+    BenchObject object{};
+    object.place(Vector2f{40.0F, 40.0F}, Vector2f{40.0F, 40.0F}, 32);
+
+    while (state.keep_running())
+    {
+        bool result = World::collide(object, group, keep_overlapping);
+        microbench::do_not_optimize(result);
+    }
+}
+
+void world_collide_groups_bench(microbench::State& state)
+{
+    auto objects = make_grid(state.get_argument());
+    auto group   = get_pointers(objects);
+
+    while (state.keep_running())
+    {
+        bool result = World::collide(group, group, keep_overlapping);
+        microbench::do_not_optimize(result);
+    }
+}
+
+void object_update_bench(microbench::State& state)
+{
+    Object object{};
+    object.set_velocity(Vector2f{100.0F, -200.0F});
+    object.set_acceleration(Vector2f{50.0F, 0.0F});
+    object.set_max_velocity(400.0F);
+
+    double time_step = TIME_STEP;
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(time_step);
+        object.update(time_step);
+        microbench::do_not_optimize(object);
+    }
+}
+
+void body_store_integrate_bench(microbench::State& state)
+{
+    BodyStore store{};
+    for (std::int64_t i{0}; i < state.get_argument(); ++i)
+    {
+        BodyHandle body = store.create(Vector2f{static_cast<float>(i), 0.0F});
+        store.set_velocity(body, Vector2f{100.0F, -200.0F});
+        store.set_acceleration(body, Vector2f{50.0F, 0.0F});
+        store.set_max_velocity(body, 400.0F);
+    }
+
+    double time_step = TIME_STEP;
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(time_step);
+        store.integrate(time_step);
+        microbench::do_not_optimize(store);
+    }
+}
+
+void animation_frame_index_bench(microbench::State& state)
+{
+    SpriteAnimation sprite_animation{};
+    Animation animation{12.0, sprite_animation.split_animation_frames(64, 64, 8, 1),
+                        AnimationMode::Looping};
+    animation.advance(0.3);
+
+    double time_step = TIME_STEP;
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(time_step);
+        std::uint32_t index = animation.frame_index(time_step);
+        microbench::do_not_optimize(index);
+    }
+}
+
+void transformable_get_transform_bench(microbench::State& state)
+{
+    Transformable transformable{};
+    transformable.rotate(30.0F);
+    transformable.set_scale(2.0F);
+
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(transformable);
+        const auto& transform = transformable.get_transform();
+        microbench::do_not_optimize(transform);
+    }
+}
+
+// Argument 0 measures an untransformed sprite, 1 a rotated and scaled one
+void sprite_bounding_rect_bench(microbench::State& state)
+{
+    SpriteObject sprite{};
+    sprite.resize(64.0F, 64.0F);
+    sprite.reset(Vector2f{100.0F, 100.0F});
+    if (state.get_argument() != 0)
+    {
+        sprite.rotate(30.0F);
+        sprite.set_scale(2.0F);
+    }
+
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(sprite);
+        Rect rect = sprite.bounding_rect();
+        microbench::do_not_optimize(rect);
+    }
+}
+
+// Argument 0 keeps playing the same animation, 1 switches between two each iteration
+void sprite_animation_play_bench(microbench::State& state)
+{
+    SpriteAnimation animation{};
+    animation.split_animation_frames(64, 64, 8, 2);
+    animation.add_animation("walk", Animation{12.0, animation.get_regions({0, 1, 2, 3, 4, 5}),
+                                              AnimationMode::Looping});
+    animation.add_animation("run", Animation{12.0, animation.get_regions({8, 9, 10, 11, 12}),
+                                             AnimationMode::Looping});
+    const std::string names[]{"walk", "run"};
+    const bool        switching = state.get_argument() != 0;
+
+    std::uint32_t iteration{0U};
+    while (state.keep_running())
+    {
+        animation.play(names[switching ? (iteration & 1U) : 0U]);
+        microbench::do_not_optimize(animation);
+        ++iteration;
+    }
+}
+
+void color_from_floats_bench(microbench::State& state)
+{
+    float value = 0.5F;
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(value);
+        Color color{value, value, value, 1.0F};
+        microbench::do_not_optimize(color);
+    }
+}
+
+void color_from_bytes_bench(microbench::State& state)
+{
+    std::uint8_t value = 128U;
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(value);
+        Color color{value, value, value, static_cast<std::uint8_t>(255U)};
+        microbench::do_not_optimize(color);
+    }
+}
+
+void color_from_hex_bench(microbench::State& state)
+{
+    std::uint32_t value = 0xF5DD42FFU;
+    while (state.keep_running())
+    {
+        microbench::do_not_optimize(value);
+        Color color{value};
+        microbench::do_not_optimize(color);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::vector<microbench::Benchmark> benchmarks{
+        {"intersects", intersects_bench, {}},
+        {"world_separate", world_separate_bench, {}},
+        {"world_collide_object_group", world_collide_object_group_bench, {16, 128, 1024}},
+        {"world_collide_groups", world_collide_groups_bench, {16, 64, 256}},
+        {"object_update", object_update_bench, {}},
+        {"body_store_integrate", body_store_integrate_bench, {16, 256, 4096}},
+        {"animation_frame_index", animation_frame_index_bench, {}},
+        {"transformable_get_transform", transformable_get_transform_bench, {}},
+        {"sprite_bounding_rect", sprite_bounding_rect_bench, {0, 1}},
+        {"sprite_animation_play", sprite_animation_play_bench, {0, 1}},
+        {"color_from_floats", color_from_floats_bench, {}},
+        {"color_from_bytes", color_from_bytes_bench, {}},
+        {"color_from_hex", color_from_hex_bench, {}}};
+
+    return microbench::run(benchmarks, argc, argv);
+}
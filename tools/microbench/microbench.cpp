@@ -0,0 +1,330 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "microbench.h"
+
+namespace microbench
+{
+
+namespace
+{
+
+// Upper bound for calibration, so that a loop the compiler emptied anyway doesn't run forever
+constexpr std::uint64_t MAX_ITERATIONS{1000000000U};
+
+struct Options
+{
+    std::string   filter{};
+    double        min_time{0.2};
+    std::uint32_t repetitions{5U};
+    std::string   output{};
+};
+
+/**************************************************************************************************
+ * @brief Times of one repetition, per iteration, in nanoseconds.
+ *
+ *************************************************************************************************/
+struct Repetition
+{
+    double real_time;
+    double cpu_time;
+};
+
+struct Result
+{
+    std::string             name;
+    std::uint64_t           iterations;
+    std::vector<Repetition> repetitions;
+};
+
+void print_usage()
+{
+    std::cout << "Usage: rinvid_microbench [--filter TEXT] [--min-time SECONDS]"
+                 " [--repetitions N] [--output FILE] [--list]\n";
+}
+
+/**************************************************************************************************
+ * @brief Finds number of iterations for which the loop takes at least min_time.
+ *
+ *************************************************************************************************/
+std::uint64_t calibrate(const Benchmark& benchmark, std::int64_t argument, double min_time)
+{
+    std::uint64_t iterations{1U};
+    while (iterations < MAX_ITERATIONS)
+    {
+        State state{iterations, argument};
+        benchmark.function(state);
+
+        const double time = state.get_real_time();
+        if (time >= min_time)
+        {
+            break;
+        }
+
+        // Overshoot a bit, so that the next try likely is the last one
+        const double multiplier = (time <= 0.0) ? 10.0 : std::min(10.0, 1.4 * min_time / time);
+        iterations              = std::max(iterations + 1U,
+                                           static_cast<std::uint64_t>(iterations * multiplier));
+    }
+
+    return std::min(iterations, MAX_ITERATIONS);
+}
+
+Result run_benchmark(const Benchmark& benchmark, const std::string& name, std::int64_t argument,
+                     const Options& options)
+{
+    Result result{name, calibrate(benchmark, argument, options.min_time), {}};
+
+    for (std::uint32_t repetition{0U}; repetition < options.repetitions; ++repetition)
+    {
+        State state{result.iterations, argument};
+        benchmark.function(state);
+
+        const double iterations = static_cast<double>(result.iterations);
+        result.repetitions.push_back(
+            {state.get_real_time() * 1e9 / iterations, state.get_cpu_time() * 1e9 / iterations});
+    }
+
+    return result;
+}
+
+double get_median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const std::size_t middle = values.size() / 2U;
+
+    return ((values.size() % 2U) == 0U) ? (values[middle - 1U] + values[middle]) / 2.0
+                                        : values[middle];
+}
+
+double get_mean(const std::vector<double>& values)
+{
+    double sum{0.0};
+    for (const auto value : values)
+    {
+        sum += value;
+    }
+
+    return sum / values.size();
+}
+
+double get_stddev(const std::vector<double>& values)
+{
+    if (values.size() < 2U)
+    {
+        return 0.0;
+    }
+
+    const double mean = get_mean(values);
+    double       sum{0.0};
+    for (const auto value : values)
+    {
+        sum += (value - mean) * (value - mean);
+    }
+
+    return std::sqrt(sum / (values.size() - 1U));
+}
+
+std::string escape_json(const std::string& text)
+{
+    std::string escaped{};
+    for (const char character : text)
+    {
+        if ((character == '"') || (character == '\\'))
+        {
+            escaped += '\\';
+        }
+        if (static_cast<unsigned char>(character) >= 0x20U)
+        {
+            escaped += character;
+        }
+    }
+
+    return escaped;
+}
+
+void write_entry(std::ostream& stream, const std::string& name, const std::string& run_name,
+                 const char* run_type, std::uint64_t iterations, double real_time,
+                 double cpu_time)
+{
+    stream << "    {\"name\": \"" << name << "\", \"run_name\": \"" << run_name
+           << "\", \"run_type\": \"" << run_type << "\", \"iterations\": " << iterations
+           << ", \"real_time\": " << real_time << ", \"cpu_time\": " << cpu_time
+           << ", \"time_unit\": \"ns\"";
+}
+
+void write_report(std::ostream& stream, const char* executable, const Options& options,
+                  const std::vector<Result>& results)
+{
+    stream << std::setprecision(6);
+    stream << "{\n  \"context\": {\"executable\": \"" << escape_json(executable)
+           << "\", \"repetitions\": " << options.repetitions
+           << ", \"min_time\": " << options.min_time << "},\n";
+    stream << "  \"benchmarks\": [";
+
+    bool first{true};
+    auto next_entry = [&stream, &first]() {
+        stream << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    for (const auto& result : results)
+    {
+        std::vector<double> real_times{};
+        std::vector<double> cpu_times{};
+        for (std::size_t i{0U}; i < result.repetitions.size(); ++i)
+        {
+            const auto& repetition = result.repetitions[i];
+            real_times.push_back(repetition.real_time);
+            cpu_times.push_back(repetition.cpu_time);
+
+            next_entry();
+            write_entry(stream, result.name, result.name, "iteration", result.iterations,
+                        repetition.real_time, repetition.cpu_time);
+            stream << ", \"repetition_index\": " << i << "}";
+        }
+
+        const char* aggregate_names[]{"mean", "median", "stddev"};
+        const double aggregate_real_times[]{get_mean(real_times), get_median(real_times),
+                                            get_stddev(real_times)};
+        const double aggregate_cpu_times[]{get_mean(cpu_times), get_median(cpu_times),
+                                           get_stddev(cpu_times)};
+        for (std::size_t i{0U}; i < 3U; ++i)
+        {
+            next_entry();
+            write_entry(stream, result.name + "_" + aggregate_names[i], result.name, "aggregate",
+                        result.repetitions.size(), aggregate_real_times[i],
+                        aggregate_cpu_times[i]);
+            stream << ", \"aggregate_name\": \"" << aggregate_names[i] << "\"}";
+        }
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+bool parse_number(const char* text, double& number)
+{
+    char*        end   = nullptr;
+    const double value = std::strtod(text, &end);
+    if ((end == text) || (*end != '\0') || (value < 0.0))
+    {
+        return false;
+    }
+    number = value;
+
+    return true;
+}
+
+} // namespace
+
+int run(const std::vector<Benchmark>& benchmarks, int argc, char** argv)
+{
+    Options options{};
+
+    for (int i{1}; i < argc; ++i)
+    {
+        const bool has_value = (i + 1) < argc;
+        double     number{};
+        if (std::strcmp(argv[i], "--list") == 0)
+        {
+            for (const auto& benchmark : benchmarks)
+            {
+                std::cout << benchmark.name << '\n';
+            }
+            return 0;
+        }
+        else if ((std::strcmp(argv[i], "--filter") == 0) && has_value)
+        {
+            options.filter = argv[++i];
+        }
+        else if ((std::strcmp(argv[i], "--min-time") == 0) && has_value &&
+                 parse_number(argv[i + 1], options.min_time))
+        {
+            ++i;
+        }
+        else if ((std::strcmp(argv[i], "--repetitions") == 0) && has_value &&
+                 parse_number(argv[i + 1], number) && (number >= 1.0))
+        {
+            options.repetitions = static_cast<std::uint32_t>(number);
+            ++i;
+        }
+        else if ((std::strcmp(argv[i], "--output") == 0) && has_value)
+        {
+            options.output = argv[++i];
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    std::vector<Result> results{};
+    for (const auto& benchmark : benchmarks)
+    {
+        std::vector<std::int64_t> arguments = benchmark.arguments;
+        if (arguments.empty())
+        {
+            arguments.push_back(0);
+        }
+
+        for (const auto argument : arguments)
+        {
+            std::string name{benchmark.name};
+            if (!benchmark.arguments.empty())
+            {
+                name += "/" + std::to_string(argument);
+            }
+            if (name.find(options.filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            results.push_back(run_benchmark(benchmark, name, argument, options));
+
+            // Progress goes to stderr, so that report written to stdout stays valid JSON
+            std::vector<double> real_times{};
+            for (const auto& repetition : results.back().repetitions)
+            {
+                real_times.push_back(repetition.real_time);
+            }
+            std::cerr << std::left << std::setw(40) << name << std::right << std::setw(14)
+                      << std::fixed << std::setprecision(1) << get_median(real_times) << " ns\n";
+        }
+    }
+
+    if (options.output.empty())
+    {
+        write_report(std::cout, argv[0], options, results);
+    }
+    else
+    {
+        std::ofstream file{options.output};
+        write_report(file, argv[0], options, results);
+        if (!file)
+        {
+            std::cerr << "Failed to write " << options.output << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+} // namespace microbench
@@ -0,0 +1,170 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef TOOLS_MICROBENCH_MICROBENCH_H
+#define TOOLS_MICROBENCH_MICROBENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace microbench
+{
+
+/**************************************************************************************************
+ * @brief Passed to a benchmark function, which runs the measured code once per loop iteration:
+ *
+ *   while (state.keep_running())
+ *   {
+ *       ...
+ *   }
+ *
+ * Everything before the loop is setup and is not measured.
+ *
+ *************************************************************************************************/
+class State
+{
+  public:
+    /**************************************************************************************************
+     * @brief Constructor.
+     *
+     * @param iterations Number of times the loop will run
+     * @param argument Argument of the benchmark (e.g. number of objects), 0 if it has none
+     *
+     *************************************************************************************************/
+    State(std::uint64_t iterations, std::int64_t argument)
+        : iterations_{iterations}, remaining_iterations_{iterations}, argument_{argument},
+          start_time_{}, end_time_{}, start_cpu_time_{}, end_cpu_time_{}
+    {
+    }
+
+    /**************************************************************************************************
+     * @brief Checks whether there is another iteration to run. Starts timing on the first call and
+     * stops it on the last one.
+     *
+     * @return true if loop should run once more, false otherwise
+     *
+     *************************************************************************************************/
+    bool keep_running()
+    {
+        if (remaining_iterations_ == 0U)
+        {
+            end_time_     = std::chrono::steady_clock::now();
+            end_cpu_time_ = std::clock();
+            return false;
+        }
+        if (remaining_iterations_ == iterations_)
+        {
+            start_cpu_time_ = std::clock();
+            start_time_     = std::chrono::steady_clock::now();
+        }
+        --remaining_iterations_;
+
+        return true;
+    }
+
+    /**************************************************************************************************
+     * @brief Returns the argument of the benchmark.
+     *
+     * @return Argument, 0 if benchmark has none
+     *
+     *************************************************************************************************/
+    std::int64_t get_argument() const
+    {
+        return argument_;
+    }
+
+    /**************************************************************************************************
+     * @brief Returns number of iterations the loop runs.
+     *
+     * @return Number of iterations
+     *
+     *************************************************************************************************/
+    std::uint64_t get_iterations() const
+    {
+        return iterations_;
+    }
+
+    /**************************************************************************************************
+     * @brief Returns wall time the loop took.
+     *
+     * @return Time in seconds
+     *
+     *************************************************************************************************/
+    double get_real_time() const
+    {
+        return std::chrono::duration<double>(end_time_ - start_time_).count();
+    }
+
+    /**************************************************************************************************
+     * @brief Returns processor time the loop took.
+     *
+     * @return Time in seconds
+     *
+     *************************************************************************************************/
+    double get_cpu_time() const
+    {
+        return static_cast<double>(end_cpu_time_ - start_cpu_time_) / CLOCKS_PER_SEC;
+    }
+
+  private:
+    std::uint64_t                         iterations_;
+    std::uint64_t                         remaining_iterations_;
+    std::int64_t                          argument_;
+    std::chrono::steady_clock::time_point start_time_;
+    std::chrono::steady_clock::time_point end_time_;
+    std::clock_t                          start_cpu_time_;
+    std::clock_t                          end_cpu_time_;
+};
+
+/**************************************************************************************************
+ * @brief A benchmark function, run once for each of its arguments.
+ *
+ *************************************************************************************************/
+struct Benchmark
+{
+    /// Name used in reports, argument is appended as "name/argument".
+    const char* name;
+    /// Function running the measured loop.
+    void (*function)(State&);
+    /// Arguments to run the function with. If empty, function is run once with argument 0.
+    std::vector<std::int64_t> arguments;
+};
+
+/**************************************************************************************************
+ * @brief Makes compiler assume that value is read and written, so that code computing it isn't
+ * optimized away.
+ *
+ * @param value Result of the measured code
+ *
+ *************************************************************************************************/
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "m"(value) : "memory");
+}
+
+/**************************************************************************************************
+ * @brief Runs benchmarks as told by command line arguments and writes a JSON report. Report uses
+ * field names of Google Benchmark, so its tools (e.g. compare.py) can compare two reports.
+ *
+ * @param benchmarks Benchmarks to run
+ * @param argc Number of command line arguments
+ * @param argv Command line arguments
+ *
+ * @return Exit code of the program
+ *
+ *************************************************************************************************/
+int run(const std::vector<Benchmark>& benchmarks, int argc, char** argv);
+
+} // namespace microbench
+
+#endif // TOOLS_MICROBENCH_MICROBENCH_H
@@ -0,0 +1,257 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "json_reader.h"
+
+namespace
+{
+
+class JsonParser
+{
+  public:
+    explicit JsonParser(const std::string& text) : text_{text}, position_{0U}
+    {
+    }
+
+    bool parse(JsonValue& value)
+    {
+        if (!parse_value(value))
+        {
+            return false;
+        }
+        skip_whitespace();
+
+        return position_ == text_.size();
+    }
+
+  private:
+    void skip_whitespace()
+    {
+        while ((position_ < text_.size()) &&
+               std::isspace(static_cast<unsigned char>(text_[position_])))
+        {
+            ++position_;
+        }
+    }
+
+    bool consume(char character)
+    {
+        skip_whitespace();
+        if ((position_ < text_.size()) && (text_[position_] == character))
+        {
+            ++position_;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool consume_literal(const char* literal)
+    {
+        const std::size_t length = std::strlen(literal);
+        if (text_.compare(position_, length, literal) != 0)
+        {
+            return false;
+        }
+        position_ += length;
+
+        return true;
+    }
+
+    bool parse_value(JsonValue& value)
+    {
+        skip_whitespace();
+        if (position_ >= text_.size())
+        {
+            return false;
+        }
+
+        const char character = text_[position_];
+        if (character == '{')
+        {
+            return parse_object(value);
+        }
+        if (character == '[')
+        {
+            return parse_array(value);
+        }
+        if (character == '"')
+        {
+            value.type = JsonValue::Type::String;
+            return parse_string(value.string);
+        }
+        if (consume_literal("true"))
+        {
+            value.type    = JsonValue::Type::Boolean;
+            value.boolean = true;
+            return true;
+        }
+        if (consume_literal("false"))
+        {
+            value.type    = JsonValue::Type::Boolean;
+            value.boolean = false;
+            return true;
+        }
+        if (consume_literal("null"))
+        {
+            value.type = JsonValue::Type::Null;
+            return true;
+        }
+
+        return parse_number(value);
+    }
+
+    bool parse_number(JsonValue& value)
+    {
+        const char* start = text_.c_str() + position_;
+        char*       end   = nullptr;
+        value.number      = std::strtod(start, &end);
+        if (end == start)
+        {
+            return false;
+        }
+        value.type = JsonValue::Type::Number;
+        position_ += static_cast<std::size_t>(end - start);
+
+        return true;
+    }
+
+    bool parse_string(std::string& string)
+    {
+        ++position_;
+        while (position_ < text_.size())
+        {
+            const char character = text_[position_++];
+            if (character == '"')
+            {
+                return true;
+            }
+            if (character == '\\')
+            {
+                if (position_ >= text_.size())
+                {
+                    return false;
+                }
+                const char escaped = text_[position_++];
+                switch (escaped)
+                {
+                case 'n':
+                    string += '\n';
+                    break;
+                case 't':
+                    string += '\t';
+                    break;
+                case 'r':
+                    string += '\r';
+                    break;
+                case 'b':
+                    string += '\b';
+                    break;
+                case 'f':
+                    string += '\f';
+                    break;
+                case 'u':
+                    // Not decoded, kept as is
+                    string += "\\u";
+                    break;
+                default:
+                    string += escaped;
+                    break;
+                }
+            }
+            else
+            {
+                string += character;
+            }
+        }
+
+        return false;
+    }
+
+    bool parse_array(JsonValue& value)
+    {
+        ++position_;
+        value.type = JsonValue::Type::Array;
+        if (consume(']'))
+        {
+            return true;
+        }
+
+        do
+        {
+            value.array.emplace_back();
+            if (!parse_value(value.array.back()))
+            {
+                return false;
+            }
+        } while (consume(','));
+
+        return consume(']');
+    }
+
+    bool parse_object(JsonValue& value)
+    {
+        ++position_;
+        value.type = JsonValue::Type::Object;
+        if (consume('}'))
+        {
+            return true;
+        }
+
+        do
+        {
+            skip_whitespace();
+            std::string key{};
+            if ((position_ >= text_.size()) || (text_[position_] != '"') || !parse_string(key) ||
+                !consume(':'))
+            {
+                return false;
+            }
+
+            value.object.emplace_back(key, JsonValue{});
+            if (!parse_value(value.object.back().second))
+            {
+                return false;
+            }
+        } while (consume(','));
+
+        return consume('}');
+    }
+
+    const std::string& text_;
+    std::size_t        position_;
+};
+
+} // namespace
+
+const JsonValue* JsonValue::find(const std::string& key) const
+{
+    for (const auto& member : object)
+    {
+        if (member.first == key)
+        {
+            return &member.second;
+        }
+    }
+
+    return nullptr;
+}
+
+bool parse_json(const std::string& text, JsonValue& value)
+{
+    value = JsonValue{};
+    JsonParser parser{text};
+
+    return parser.parse(value);
+}
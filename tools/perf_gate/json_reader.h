@@ -0,0 +1,63 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef TOOLS_PERF_GATE_JSON_READER_H
+#define TOOLS_PERF_GATE_JSON_READER_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**************************************************************************************************
+ * @brief A parsed JSON value. Only what is needed to read benchmark reports is supported, e.g.
+ * unicode escapes are not decoded.
+ *
+ *************************************************************************************************/
+struct JsonValue
+{
+    enum class Type
+    {
+        Null = 0U,
+        Boolean,
+        Number,
+        String,
+        Array,
+        Object
+    };
+
+    Type                                           type{Type::Null};
+    bool                                           boolean{false};
+    double                                         number{0.0};
+    std::string                                    string{};
+    std::vector<JsonValue>                         array{};
+    std::vector<std::pair<std::string, JsonValue>> object{};
+
+    /**************************************************************************************************
+     * @brief Looks up a member of an object.
+     *
+     * @param key Name of the member
+     *
+     * @return Member, or nullptr if value isn't an object or has no such member
+     *
+     *************************************************************************************************/
+    const JsonValue* find(const std::string& key) const;
+};
+
+/**************************************************************************************************
+ * @brief Parses JSON text.
+ *
+ * @param text Text to parse
+ * @param value Parsed value
+ *
+ * @return True if text is valid JSON, false otherwise
+ *
+ *************************************************************************************************/
+bool parse_json(const std::string& text, JsonValue& value);
+
+#endif // TOOLS_PERF_GATE_JSON_READER_H
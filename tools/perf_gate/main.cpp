@@ -0,0 +1,531 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "json_reader.h"
+
+namespace
+{
+
+// Frame stats of a scene are the same on every machine, so they are compared exactly
+constexpr const char* EXACT_BENCH_FIELDS[]{"draw_calls",          "triangles",
+                                           "program_switches",    "texture_binds",
+                                           "buffer_upload_bytes", "uniform_sets"};
+constexpr const char* EXACT_TOLERANCE{"exact"};
+// Tolerance given to timings added by --update
+constexpr double DEFAULT_TIME_TOLERANCE{20.0};
+// Timing may exceed its allowed value by this many standard errors before it counts as regression
+constexpr double NOISE_SIGMAS{3.0};
+// Standard error of a median is about this many times the standard error of a mean
+constexpr double MEDIAN_ERROR_FACTOR{1.2533};
+
+struct Options
+{
+    std::string baseline{};
+    std::string bench{};
+    std::string microbench{};
+    bool        update{false};
+    bool        counts_only{false};
+};
+
+/**************************************************************************************************
+ * @brief A measured value.
+ *
+ *************************************************************************************************/
+struct Metric
+{
+    double value{0.0};
+    /// Standard error of value, 0 for counts.
+    double noise{0.0};
+    bool   exact{false};
+};
+
+/**************************************************************************************************
+ * @brief A line of the baseline file.
+ *
+ *************************************************************************************************/
+struct BaselineEntry
+{
+    std::string name{};
+    double      value{0.0};
+    bool        exact{false};
+    /// Percentage by which a timing may exceed value.
+    double      tolerance{0.0};
+};
+
+void print_usage()
+{
+    std::cout << "Usage: rinvid_perf_gate --baseline FILE [--bench PATH] [--microbench PATH]"
+                 " [--update] [--counts-only]\n";
+}
+
+std::string quote(const std::string& text)
+{
+    return "\"" + text + "\"";
+}
+
+bool read_file(const std::string& path, std::string& text)
+{
+    std::ifstream file{path};
+    if (!file)
+    {
+        return false;
+    }
+    std::stringstream stream{};
+    stream << file.rdbuf();
+    text = stream.str();
+
+    return true;
+}
+
+/**************************************************************************************************
+ * @brief Reads the baseline file. Each line holds a metric name, its value and tolerance, which is
+ * either "exact" or a percentage (e.g. "20%"). Empty lines and lines starting with # are skipped.
+ *
+ * @param path Path of the baseline file
+ * @param entries Read entries
+ *
+ * @return True if file was read, false if it doesn't exist or has an invalid line
+ *
+ *************************************************************************************************/
+bool read_baseline(const std::string& path, std::vector<BaselineEntry>& entries)
+{
+    std::ifstream file{path};
+    if (!file)
+    {
+        return false;
+    }
+
+    std::string line{};
+    std::size_t line_number{0U};
+    while (std::getline(file, line))
+    {
+        ++line_number;
+        std::istringstream stream{line};
+        BaselineEntry      entry{};
+        std::string        tolerance{};
+        if (!(stream >> entry.name) || (entry.name[0] == '#'))
+        {
+            continue;
+        }
+
+        char* end = nullptr;
+        if (!(stream >> entry.value >> tolerance))
+        {
+            std::cerr << path << ":" << line_number << ": expected <metric> <value> <tolerance>\n";
+            return false;
+        }
+        if (tolerance == EXACT_TOLERANCE)
+        {
+            entry.exact = true;
+        }
+        else
+        {
+            entry.tolerance = std::strtod(tolerance.c_str(), &end);
+            if ((end == tolerance.c_str()) || (std::strcmp(end, "%") != 0))
+            {
+                std::cerr << path << ":" << line_number << ": invalid tolerance " << tolerance
+                          << '\n';
+                return false;
+            }
+        }
+        entries.push_back(entry);
+    }
+
+    return true;
+}
+
+/**************************************************************************************************
+ * @brief Runs a benchmark executable and reads the JSON report it writes.
+ *
+ * @param command Executable and its arguments, without --output
+ * @param report_path File the report is written to
+ * @param report Parsed report
+ *
+ * @return True if executable succeeded and wrote a valid report, false otherwise
+ *
+ *************************************************************************************************/
+bool run_report(const std::string& command, const std::string& report_path, JsonValue& report)
+{
+    const std::string full_command = command + " --output " + quote(report_path);
+    std::cerr << "Running " << full_command << '\n';
+    if (std::system(full_command.c_str()) != 0)
+    {
+        std::cerr << "Command failed: " << full_command << '\n';
+        return false;
+    }
+
+    std::string     text{};
+    const bool      read = read_file(report_path, text);
+    std::error_code error{};
+    std::filesystem::remove(report_path, error);
+    if (!read || !parse_json(text, report))
+    {
+        std::cerr << "Failed to read report " << report_path << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+/**************************************************************************************************
+ * @brief Returns a path in the temporary directory no other perf gate run uses, so several runs
+ * (e.g. ctest -j) don't overwrite each other's reports.
+ *
+ * @param name Name of the report
+ *
+ * @return Path of the report file
+ *
+ *************************************************************************************************/
+std::string get_report_path(const std::string& name)
+{
+    static const auto run_id = std::random_device{}() ^
+                               static_cast<std::uint32_t>(
+                                   std::chrono::steady_clock::now().time_since_epoch().count());
+
+    std::ostringstream file_name{};
+    file_name << "rinvid_perf_gate_" << std::hex << run_id << '_' << name << ".json";
+
+    return (std::filesystem::temp_directory_path() / file_name.str()).string();
+}
+
+double get_number(const JsonValue& object, const std::string& key)
+{
+    const auto* value = object.find(key);
+
+    return ((value != nullptr) && (value->type == JsonValue::Type::Number)) ? value->number : 0.0;
+}
+
+std::string get_string(const JsonValue& object, const std::string& key)
+{
+    const auto* value = object.find(key);
+
+    return ((value != nullptr) && (value->type == JsonValue::Type::String)) ? value->string : "";
+}
+
+/**************************************************************************************************
+ * @brief Adds metrics of a rinvid_bench report: frame stats and median frame time of each scene.
+ *
+ *************************************************************************************************/
+void add_bench_metrics(const JsonValue& report, std::map<std::string, Metric>& metrics)
+{
+    const auto* scenes = report.find("scenes");
+    if (scenes == nullptr)
+    {
+        return;
+    }
+
+    for (const auto& scene : scenes->array)
+    {
+        const std::string prefix = "bench/" + get_string(scene, "name") + "/";
+        for (const auto* field : EXACT_BENCH_FIELDS)
+        {
+            metrics[prefix + field] = Metric{get_number(scene, field), 0.0, true};
+        }
+
+        const double frames = get_number(scene, "frames");
+        const double noise  = (frames > 0.0) ? MEDIAN_ERROR_FACTOR *
+                                                  get_number(scene, "stddev_ms") / std::sqrt(frames)
+                                             : 0.0;
+        metrics[prefix + "p50_ms"] = Metric{get_number(scene, "p50_ms"), noise, false};
+    }
+}
+
+/**************************************************************************************************
+ * @brief Adds metrics of a rinvid_microbench report: median time of each benchmark.
+ *
+ *************************************************************************************************/
+void add_microbench_metrics(const JsonValue& report, std::map<std::string, Metric>& metrics)
+{
+    const auto* context    = report.find("context");
+    const auto* benchmarks = report.find("benchmarks");
+    if ((context == nullptr) || (benchmarks == nullptr))
+    {
+        return;
+    }
+
+    const double                  repetitions = get_number(*context, "repetitions");
+    std::map<std::string, double> stddevs{};
+    for (const auto& benchmark : benchmarks->array)
+    {
+        if (get_string(benchmark, "aggregate_name") == "stddev")
+        {
+            stddevs[get_string(benchmark, "run_name")] = get_number(benchmark, "real_time");
+        }
+    }
+
+    for (const auto& benchmark : benchmarks->array)
+    {
+        if (get_string(benchmark, "aggregate_name") != "median")
+        {
+            continue;
+        }
+
+        const std::string run_name = get_string(benchmark, "run_name");
+        const double      noise =
+            (repetitions > 0.0) ? MEDIAN_ERROR_FACTOR * stddevs[run_name] / std::sqrt(repetitions)
+                                : 0.0;
+        metrics["micro/" + run_name + "/real_time"] =
+            Metric{get_number(benchmark, "real_time"), noise, false};
+    }
+}
+
+/**************************************************************************************************
+ * @brief Compares metrics against the baseline and prints the result of each.
+ *
+ * @return Number of regressions
+ *
+ *************************************************************************************************/
+std::uint32_t compare(const std::vector<BaselineEntry>& baseline,
+                      const std::map<std::string, Metric>& metrics, bool counts_only)
+{
+    std::uint32_t regressions{0U};
+    std::cout << std::left << std::setw(7) << "RESULT" << ' ' << std::setw(56) << "METRIC"
+              << std::right << std::setw(14) << "BASELINE" << std::setw(14) << "CURRENT"
+              << std::setw(14) << "LIMIT" << '\n';
+
+    for (const auto& entry : baseline)
+    {
+        if (counts_only && !entry.exact)
+        {
+            continue;
+        }
+
+        const auto  found = metrics.find(entry.name);
+        const char* result{"ok"};
+        double      current{0.0};
+        double      limit{entry.value};
+        if (found == metrics.end())
+        {
+            result = "MISSING";
+            ++regressions;
+        }
+        else if (entry.exact)
+        {
+            current = found->second.value;
+            if (current != entry.value)
+            {
+                result = "FAIL";
+                ++regressions;
+            }
+        }
+        else
+        {
+            current              = found->second.value;
+            const double allowed = entry.value * entry.tolerance / 100.0;
+            const double noise   = NOISE_SIGMAS * found->second.noise;
+            limit                = entry.value + allowed + noise;
+            if (current > limit)
+            {
+                result = "FAIL";
+                ++regressions;
+            }
+            else if (current < entry.value - allowed - noise)
+            {
+                // Not a failure, but baseline should be updated to catch regressions that follow
+                result = "faster";
+            }
+        }
+
+        std::cout << std::left << std::setw(7) << result << ' ' << std::setw(56) << entry.name
+                  << std::right << std::setw(14) << entry.value << std::setw(14) << current
+                  << std::setw(14) << limit << '\n';
+    }
+
+    for (const auto& metric : metrics)
+    {
+        bool in_baseline{false};
+        for (const auto& entry : baseline)
+        {
+            in_baseline = in_baseline || (entry.name == metric.first);
+        }
+        if (!in_baseline && (!counts_only || metric.second.exact))
+        {
+            std::cout << "new     " << metric.first << " (not in baseline)\n";
+        }
+    }
+
+    return regressions;
+}
+
+/**************************************************************************************************
+ * @brief Writes current metrics as the new baseline. Tolerances of metrics already in the old
+ * baseline are kept. Renderer is only noted if there are timings.
+ *
+ *************************************************************************************************/
+bool write_baseline(const std::string& path, const std::vector<BaselineEntry>& old_baseline,
+                    const std::map<std::string, Metric>& metrics, const std::string& renderer)
+{
+    std::ofstream file{path};
+    file << "# Rinvid performance baseline, written by rinvid_perf_gate --update\n";
+    for (const auto& metric : metrics)
+    {
+        if (!metric.second.exact)
+        {
+            file << "# Timings were measured on: " << renderer << "\n";
+            break;
+        }
+    }
+    file << "# <metric> <value> <tolerance>, tolerance is \"exact\" or percentage a timing may "
+            "exceed value by\n";
+    file << std::setprecision(8);
+
+    for (const auto& metric : metrics)
+    {
+        std::string tolerance{};
+        if (metric.second.exact)
+        {
+            tolerance = EXACT_TOLERANCE;
+        }
+        else
+        {
+            double percentage{DEFAULT_TIME_TOLERANCE};
+            for (const auto& entry : old_baseline)
+            {
+                if ((entry.name == metric.first) && !entry.exact)
+                {
+                    percentage = entry.tolerance;
+                }
+            }
+            std::ostringstream stream{};
+            stream << percentage << '%';
+            tolerance = stream.str();
+        }
+
+        file << metric.first << ' ' << metric.second.value << ' ' << tolerance << '\n';
+    }
+
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options{};
+
+    for (int i{1}; i < argc; ++i)
+    {
+        const bool has_value = (i + 1) < argc;
+        if ((std::strcmp(argv[i], "--baseline") == 0) && has_value)
+        {
+            options.baseline = argv[++i];
+        }
+        else if ((std::strcmp(argv[i], "--bench") == 0) && has_value)
+        {
+            options.bench = argv[++i];
+        }
+        else if ((std::strcmp(argv[i], "--microbench") == 0) && has_value)
+        {
+            options.microbench = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--update") == 0)
+        {
+            options.update = true;
+        }
+        else if (std::strcmp(argv[i], "--counts-only") == 0)
+        {
+            options.counts_only = true;
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    if (options.baseline.empty() || (options.bench.empty() && options.microbench.empty()))
+    {
+        print_usage();
+        return 1;
+    }
+
+    std::vector<BaselineEntry> baseline{};
+    if (!read_baseline(options.baseline, baseline) && !options.update)
+    {
+        std::cerr << "Failed to read baseline " << options.baseline << '\n';
+        return 1;
+    }
+
+    std::map<std::string, Metric> metrics{};
+    std::string                   renderer{"unknown"};
+
+    if (!options.bench.empty())
+    {
+        // Only frame stats are compared with --counts-only. They are the same in every frame but
+        // the first one, which binds default shaders for the first time.
+        const std::string frames =
+            options.counts_only ? " --frames 1 --warmup 1" : " --frames 30 --warmup 5";
+        const auto report_path = get_report_path("bench");
+        JsonValue  report{};
+        if (!run_report(quote(options.bench) + frames, report_path, report))
+        {
+            return 1;
+        }
+        add_bench_metrics(report, metrics);
+        renderer = get_string(report, "renderer");
+    }
+
+    if (!options.microbench.empty() && !options.counts_only)
+    {
+        const auto report_path = get_report_path("microbench");
+        JsonValue  report{};
+        if (!run_report(quote(options.microbench) + " --min-time 0.1 --repetitions 5",
+                        report_path, report))
+        {
+            return 1;
+        }
+        add_microbench_metrics(report, metrics);
+    }
+
+    // Timings of a run this short mean nothing
+    if (options.counts_only)
+    {
+        for (auto metric = metrics.begin(); metric != metrics.end();)
+        {
+            metric = metric->second.exact ? std::next(metric) : metrics.erase(metric);
+        }
+    }
+
+    if (options.update)
+    {
+        if (!write_baseline(options.baseline, baseline, metrics, renderer))
+        {
+            std::cerr << "Failed to write baseline " << options.baseline << '\n';
+            return 1;
+        }
+        std::cout << "Wrote " << metrics.size() << " metrics to " << options.baseline << '\n';
+        return 0;
+    }
+
+    const auto regressions = compare(baseline, metrics, options.counts_only);
+    if (regressions != 0U)
+    {
+        std::cout << regressions << " metric(s) regressed\n";
+        return 1;
+    }
+    std::cout << "No regressions\n";
+
+    return 0;
+}
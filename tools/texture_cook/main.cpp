@@ -0,0 +1,88 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "util/include/cooked_texture.h"
+#include "util/include/image_loader.h"
+
+using namespace rinvid;
+
+static void print_usage()
+{
+    std::cout << "Usage: texture_cook [--no-mipmaps] <input image> <output.rtex>\n";
+}
+
+int main(int argc, char** argv)
+{
+    bool        generate_mipmaps = true;
+    const char* input            = nullptr;
+    const char* output           = nullptr;
+
+    for (int i{1}; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--no-mipmaps") == 0)
+        {
+            generate_mipmaps = false;
+        }
+        else if (input == nullptr)
+        {
+            input = argv[i];
+        }
+        else if (output == nullptr)
+        {
+            output = argv[i];
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    if ((input == nullptr) || (output == nullptr))
+    {
+        print_usage();
+        return 1;
+    }
+
+    std::vector<std::uint8_t> image_data{};
+    std::int32_t              width{};
+    std::int32_t              height{};
+    if (!load_image(input, image_data, width, height))
+    {
+        std::cerr << "Could not load image: " << input << '\n';
+        return 1;
+    }
+
+    std::vector<std::uint8_t> cooked{};
+    if (!cook_texture(image_data.data(), width, height, generate_mipmaps, cooked))
+    {
+        std::cerr << "Could not cook image: " << input << '\n';
+        return 1;
+    }
+
+    std::ofstream file{output, std::ios::binary | std::ios::trunc};
+    file.write(reinterpret_cast<const char*>(cooked.data()),
+               static_cast<std::streamsize>(cooked.size()));
+    if (!file)
+    {
+        std::cerr << "Could not write cooked texture: " << output << '\n';
+        return 1;
+    }
+
+    std::cout << input << " -> " << output << " (" << width << "x" << height << ", "
+              << cooked.size() << " bytes)\n";
+
+    return 0;
+}
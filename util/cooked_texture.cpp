@@ -0,0 +1,189 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "util/include/cooked_texture.h"
+#include "util/include/error_handler.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+constexpr std::size_t BYTES_PER_PIXEL{4U};
+
+std::size_t level_size(std::int32_t width, std::int32_t height)
+{
+    return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * BYTES_PER_PIXEL;
+}
+
+void premultiply_alpha(std::uint8_t* pixels, std::size_t size)
+{
+    for (std::size_t i{0U}; i < size; i += BYTES_PER_PIXEL)
+    {
+        const std::uint32_t alpha = pixels[i + 3U];
+        for (std::size_t channel{0U}; channel < 3U; ++channel)
+        {
+            // Rounded division by 255
+            pixels[i + channel] = static_cast<std::uint8_t>((pixels[i + channel] * alpha + 127U) /
+                                                            255U);
+        }
+    }
+}
+
+// 2x2 box filter, last row or column is repeated for odd sizes
+void downsample(const std::uint8_t* source, std::int32_t source_width, std::int32_t source_height,
+                std::uint8_t* destination, std::int32_t width, std::int32_t height)
+{
+    for (std::int32_t y{0}; y < height; ++y)
+    {
+        const std::int32_t y0 = std::min(y * 2, source_height - 1);
+        const std::int32_t y1 = std::min(y * 2 + 1, source_height - 1);
+
+        for (std::int32_t x{0}; x < width; ++x)
+        {
+            const std::int32_t x0 = std::min(x * 2, source_width - 1);
+            const std::int32_t x1 = std::min(x * 2 + 1, source_width - 1);
+
+            const std::uint8_t* p00 = source + (y0 * source_width + x0) * BYTES_PER_PIXEL;
+            const std::uint8_t* p01 = source + (y0 * source_width + x1) * BYTES_PER_PIXEL;
+            const std::uint8_t* p10 = source + (y1 * source_width + x0) * BYTES_PER_PIXEL;
+            const std::uint8_t* p11 = source + (y1 * source_width + x1) * BYTES_PER_PIXEL;
+            std::uint8_t*       out = destination + (y * width + x) * BYTES_PER_PIXEL;
+
+            for (std::size_t channel{0U}; channel < BYTES_PER_PIXEL; ++channel)
+            {
+                out[channel] = static_cast<std::uint8_t>(
+                    (p00[channel] + p01[channel] + p10[channel] + p11[channel] + 2U) / 4U);
+            }
+        }
+    }
+}
+
+} // namespace
+
+bool cook_texture(const std::uint8_t* image_data, std::int32_t width, std::int32_t height,
+                  bool generate_mipmaps, std::vector<std::uint8_t>& cooked)
+{
+    if ((image_data == nullptr) || (width <= 0) || (height <= 0))
+    {
+        return false;
+    }
+
+    std::uint32_t mip_count{1U};
+    std::size_t   total_size = level_size(width, height);
+    if (generate_mipmaps)
+    {
+        std::int32_t level_width  = width;
+        std::int32_t level_height = height;
+        while ((level_width > 1) || (level_height > 1))
+        {
+            level_width  = std::max(level_width / 2, 1);
+            level_height = std::max(level_height / 2, 1);
+            total_size += level_size(level_width, level_height);
+            ++mip_count;
+        }
+    }
+
+    CookedTextureHeader header{COOKED_TEXTURE_MAGIC,
+                               COOKED_TEXTURE_VERSION,
+                               static_cast<std::uint32_t>(width),
+                               static_cast<std::uint32_t>(height),
+                               mip_count,
+                               COOKED_TEXTURE_PREMULTIPLIED_ALPHA};
+
+    cooked.resize(sizeof(header) + total_size);
+    std::memcpy(cooked.data(), &header, sizeof(header));
+
+    // Mips are filtered from premultiplied colors, so transparent pixels don't bleed into edges
+    std::uint8_t* level = cooked.data() + sizeof(header);
+    std::memcpy(level, image_data, level_size(width, height));
+    premultiply_alpha(level, level_size(width, height));
+
+    std::int32_t level_width  = width;
+    std::int32_t level_height = height;
+    for (std::uint32_t i{1U}; i < mip_count; ++i)
+    {
+        const std::int32_t next_width  = std::max(level_width / 2, 1);
+        const std::int32_t next_height = std::max(level_height / 2, 1);
+        std::uint8_t*      next_level  = level + level_size(level_width, level_height);
+
+        downsample(level, level_width, level_height, next_level, next_width, next_height);
+
+        level        = next_level;
+        level_width  = next_width;
+        level_height = next_height;
+    }
+
+    return true;
+}
+
+bool parse_cooked_texture(const std::uint8_t* data, std::size_t size, CookedTextureHeader& header,
+                          std::vector<CookedTextureLevel>& levels)
+{
+    if ((data == nullptr) || (size < sizeof(header)))
+    {
+        errors::put_error_to_log("Cooked texture is too small to hold a header");
+        return false;
+    }
+
+    std::memcpy(&header, data, sizeof(header));
+
+    if ((header.magic != COOKED_TEXTURE_MAGIC) || (header.version != COOKED_TEXTURE_VERSION))
+    {
+        errors::put_error_to_log("Cooked texture has unknown format or version");
+        return false;
+    }
+
+    if ((header.width == 0U) || (header.height == 0U) || (header.mip_count == 0U) ||
+        (header.mip_count > 32U))
+    {
+        errors::put_error_to_log("Cooked texture header is corrupted");
+        return false;
+    }
+
+    levels.clear();
+    levels.reserve(header.mip_count);
+
+    std::size_t  offset       = sizeof(header);
+    std::int32_t level_width  = static_cast<std::int32_t>(header.width);
+    std::int32_t level_height = static_cast<std::int32_t>(header.height);
+    for (std::uint32_t i{0U}; i < header.mip_count; ++i)
+    {
+        const std::size_t bytes = level_size(level_width, level_height);
+        if (size - offset < bytes)
+        {
+            errors::put_error_to_log("Cooked texture is truncated");
+            return false;
+        }
+
+        levels.push_back(CookedTextureLevel{data + offset, level_width, level_height});
+        offset += bytes;
+
+        level_width  = std::max(level_width / 2, 1);
+        level_height = std::max(level_height / 2, 1);
+    }
+
+    return true;
+}
+
+bool is_cooked_texture_file(const char* file_name)
+{
+    const std::string name{file_name};
+    const std::string extension{".rtex"};
+
+    return (name.size() >= extension.size()) &&
+           (name.compare(name.size() - extension.size(), extension.size(), extension) == 0);
+}
+
+} // namespace rinvid
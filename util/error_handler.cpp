@@ -9,6 +9,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -27,6 +28,8 @@ namespace errors
 {
 
 static std::set<std::string> errors;
+// Errors can be reported from worker threads too (e.g. while decoding textures in the background)
+static std::mutex errors_mutex;
 
 void put_error_to_log(const std::string& error_description)
 {
@@ -34,6 +37,8 @@ void put_error_to_log(const std::string& error_description)
     return;
 #endif
 
+    std::lock_guard<std::mutex> lock{errors_mutex};
+
     if (errors.find(error_description) != errors.end())
     {
         return;
@@ -56,6 +61,8 @@ void put_error_to_log(const char* error_description)
     return;
 #endif
 
+    std::lock_guard<std::mutex> lock{errors_mutex};
+
     if (errors.find(error_description) != errors.end())
     {
         return;
@@ -119,11 +126,13 @@ void handle_gl_errors(const char* file, std::uint32_t line)
 
 std::uint32_t get_error_count()
 {
+    std::lock_guard<std::mutex> lock{errors_mutex};
     return errors.size();
 }
 
 bool has_error_occured(const std::string& description)
 {
+    std::lock_guard<std::mutex> lock{errors_mutex};
     return errors.find(description) != errors.end();
 }
 
@@ -0,0 +1,156 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "include/frame_time_histogram.h"
+
+namespace rinvid
+{
+
+namespace
+{
+
+// A frame is a stutter if it takes this many times longer than recent frames on average
+constexpr double STUTTER_FACTOR{2.0};
+// Weight of the newest frame in the moving average of recent frames
+constexpr double AVERAGE_WEIGHT{0.1};
+
+} // namespace
+
+std::ostream& operator<<(std::ostream& stream, const FrameTimeReport& report)
+{
+    stream << "Frame times of " << report.name << " (ms): " << report.frames << " frames, mean "
+           << report.mean * 1000.0 << ", p50 " << report.p50 * 1000.0 << ", p95 "
+           << report.p95 * 1000.0 << ", p99 " << report.p99 * 1000.0 << ", max "
+           << report.max * 1000.0 << ", " << report.stutters << " stutters";
+
+    return stream;
+}
+
+FrameTimeHistogram::FrameTimeHistogram()
+    : buckets_{}, count_{0U}, total_{0.0}, max_{0.0}, average_{0.0}, stutters_{0U}
+{
+}
+
+void FrameTimeHistogram::record(double frame_time)
+{
+    frame_time = std::max(frame_time, 0.0);
+
+    ++buckets_[get_bucket_index(static_cast<std::uint64_t>(frame_time * 1000000.0))];
+
+    if ((count_ > 0U) && (frame_time > STUTTER_FACTOR * average_))
+    {
+        ++stutters_;
+    }
+    average_ = (count_ == 0U) ? frame_time : average_ + AVERAGE_WEIGHT * (frame_time - average_);
+
+    ++count_;
+    total_ += frame_time;
+    max_ = std::max(max_, frame_time);
+}
+
+double FrameTimeHistogram::get_percentile(double percentile) const
+{
+    if (count_ == 0U)
+    {
+        return 0.0;
+    }
+
+    const auto rank = std::max(
+        static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * count_)),
+        std::uint64_t{1U});
+    if (rank == count_)
+    {
+        return max_;
+    }
+
+    std::uint64_t frames{0U};
+    for (std::uint32_t index{0U}; index < NUMBER_OF_BUCKETS; ++index)
+    {
+        frames += buckets_[index];
+        if (frames >= rank)
+        {
+            return std::min(get_bucket_middle(index), max_);
+        }
+    }
+
+    return max_;
+}
+
+std::uint64_t FrameTimeHistogram::get_count() const
+{
+    return count_;
+}
+
+FrameTimeReport FrameTimeHistogram::get_report(const std::string& name) const
+{
+    const double mean = (count_ == 0U) ? 0.0 : total_ / count_;
+
+    return FrameTimeReport{name,
+                           count_,
+                           mean,
+                           get_percentile(50.0),
+                           get_percentile(95.0),
+                           get_percentile(99.0),
+                           max_,
+                           stutters_};
+}
+
+void FrameTimeHistogram::clear()
+{
+    buckets_.fill(0U);
+    count_    = 0U;
+    total_    = 0.0;
+    max_      = 0.0;
+    average_  = 0.0;
+    stutters_ = 0U;
+}
+
+std::uint32_t FrameTimeHistogram::get_bucket_index(std::uint64_t microseconds)
+{
+    // Values below 2 * SUB_BUCKETS get a bucket each
+    if (microseconds < 2U * SUB_BUCKETS)
+    {
+        return static_cast<std::uint32_t>(microseconds);
+    }
+
+    // Above that, value is shifted right until it falls into [SUB_BUCKETS, 2 * SUB_BUCKETS)
+    std::uint32_t shift{0U};
+    while ((microseconds >> shift) >= 2U * SUB_BUCKETS)
+    {
+        ++shift;
+    }
+    if (shift > MAGNITUDES)
+    {
+        return NUMBER_OF_BUCKETS - 1U;
+    }
+
+    const auto sub_bucket = static_cast<std::uint32_t>(microseconds >> shift) - SUB_BUCKETS;
+
+    return 2U * SUB_BUCKETS + (shift - 1U) * SUB_BUCKETS + sub_bucket;
+}
+
+double FrameTimeHistogram::get_bucket_middle(std::uint32_t index)
+{
+    if (index < 2U * SUB_BUCKETS)
+    {
+        return (index + 0.5) / 1000000.0;
+    }
+
+    const std::uint32_t shift      = (index - 2U * SUB_BUCKETS) / SUB_BUCKETS + 1U;
+    const std::uint32_t sub_bucket = (index - 2U * SUB_BUCKETS) % SUB_BUCKETS + SUB_BUCKETS;
+    const double        lower      = static_cast<double>(std::uint64_t{sub_bucket} << shift);
+    const double        width      = static_cast<double>(std::uint64_t{1U} << shift);
+
+    return (lower + width / 2.0) / 1000000.0;
+}
+
+} // namespace rinvid
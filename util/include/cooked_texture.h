@@ -0,0 +1,103 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef UTIL_INCLUDE_COOKED_TEXTURE_H
+#define UTIL_INCLUDE_COOKED_TEXTURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rinvid
+{
+
+/*
+ * Cooked texture (.rtex) file layout, all values little endian:
+ *
+ *   CookedTextureHeader
+ *   mip level 0 pixels (width * height * 4 bytes, RGBA8, rows top to bottom)
+ *   mip level 1 pixels (half the size of level 0, rounded down, at least 1x1)
+ *   ...
+ *
+ * Pixel data can be passed to glTexImage2D as is, there is no decoding step.
+ */
+
+/// "RTEX" read as a little endian integer
+constexpr std::uint32_t COOKED_TEXTURE_MAGIC{0x58455452U};
+constexpr std::uint32_t COOKED_TEXTURE_VERSION{1U};
+
+/// Color channels are multiplied by alpha.
+constexpr std::uint32_t COOKED_TEXTURE_PREMULTIPLIED_ALPHA{1U << 0U};
+
+struct CookedTextureHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t mip_count;
+    std::uint32_t flags;
+};
+
+static_assert(sizeof(CookedTextureHeader) == 24U, "Cooked texture header must not be padded");
+
+/**************************************************************************************************
+ * @brief A single mip level of a cooked texture, pointing into cooked data.
+ *
+ *************************************************************************************************/
+struct CookedTextureLevel
+{
+    const std::uint8_t* data;
+    std::int32_t        width;
+    std::int32_t        height;
+};
+
+/**************************************************************************************************
+ * @brief Converts a decoded RGBA8 image into cooked texture format. Colors are premultiplied by
+ * alpha, mip levels are generated with a box filter.
+ *
+ * @param image_data RGBA8 pixels
+ * @param width Width of the image
+ * @param height Height of the image
+ * @param generate_mipmaps Whether to precompute the full mip chain
+ * @param cooked Output buffer, contents of a .rtex file
+ *
+ * @return true if image has been cooked, false if it is empty
+ *
+ *************************************************************************************************/
+bool cook_texture(const std::uint8_t* image_data, std::int32_t width, std::int32_t height,
+                  bool generate_mipmaps, std::vector<std::uint8_t>& cooked);
+
+/**************************************************************************************************
+ * @brief Validates cooked texture data and locates its mip levels. Does not copy any pixels.
+ *
+ * @param data Contents of a .rtex file
+ * @param size Size of data in bytes
+ * @param header Parsed header
+ * @param levels Mip levels, level 0 first
+ *
+ * @return true if data is a valid cooked texture, false otherwise
+ *
+ *************************************************************************************************/
+bool parse_cooked_texture(const std::uint8_t* data, std::size_t size, CookedTextureHeader& header,
+                          std::vector<CookedTextureLevel>& levels);
+
+/**************************************************************************************************
+ * @brief Checks whether file name has the cooked texture extension (.rtex).
+ *
+ * @param file_name Path to file
+ *
+ * @return true if file is a cooked texture, false otherwise
+ *
+ *************************************************************************************************/
+bool is_cooked_texture_file(const char* file_name);
+
+} // namespace rinvid
+
+#endif // UTIL_INCLUDE_COOKED_TEXTURE_H
@@ -0,0 +1,119 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef UTIL_INCLUDE_FRAME_TIME_HISTOGRAM_H
+#define UTIL_INCLUDE_FRAME_TIME_HISTOGRAM_H
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Summary of frame times recorded by a FrameTimeHistogram. Times are in seconds.
+ *
+ *************************************************************************************************/
+struct FrameTimeReport
+{
+    /// What the frames belong to, e.g. name of a screen.
+    std::string   name;
+    std::uint64_t frames;
+    double        mean;
+    double        p50;
+    double        p95;
+    double        p99;
+    double        max;
+    /// Frames that took more than twice as long as recent frames on average.
+    std::uint64_t stutters;
+};
+
+/**************************************************************************************************
+ * @brief Writes a report as a single line, with times in milliseconds.
+ *
+ *************************************************************************************************/
+std::ostream& operator<<(std::ostream& stream, const FrameTimeReport& report);
+
+/**************************************************************************************************
+ * @brief Histogram of frame times with logarithmic buckets, in the manner of HdrHistogram. Each
+ * power of two of microseconds is split into 32 buckets, so a percentile is accurate to about 3%
+ * for any frame time from a microsecond up to a minute. Memory is fixed and recording a frame
+ * doesn't allocate.
+ *
+ *************************************************************************************************/
+class FrameTimeHistogram
+{
+  public:
+    /// Number of buckets per power of two.
+    static constexpr std::uint32_t SUB_BUCKETS{32U};
+    /// Number of powers of two covered above the linear range [0, 2 * SUB_BUCKETS) microseconds.
+    static constexpr std::uint32_t MAGNITUDES{20U};
+    static constexpr std::uint32_t NUMBER_OF_BUCKETS{2U * SUB_BUCKETS + MAGNITUDES * SUB_BUCKETS};
+
+    FrameTimeHistogram();
+
+    /**************************************************************************************************
+     * @brief Records a frame.
+     *
+     * @param frame_time Duration of the frame in seconds
+     *
+     *************************************************************************************************/
+    void record(double frame_time);
+
+    /**************************************************************************************************
+     * @brief Returns frame time below which given percentage of recorded frames fall.
+     *
+     * @param percentile Percentage in range [0, 100]
+     *
+     * @return Frame time in seconds, 0 if no frames are recorded
+     *
+     *************************************************************************************************/
+    double get_percentile(double percentile) const;
+
+    /**************************************************************************************************
+     * @brief Returns number of recorded frames.
+     *
+     * @return Number of frames
+     *
+     *************************************************************************************************/
+    std::uint64_t get_count() const;
+
+    /**************************************************************************************************
+     * @brief Summarizes recorded frames.
+     *
+     * @param name Name to give the report
+     *
+     * @return Report
+     *
+     *************************************************************************************************/
+    FrameTimeReport get_report(const std::string& name) const;
+
+    /**************************************************************************************************
+     * @brief Forgets all recorded frames.
+     *
+     *************************************************************************************************/
+    void clear();
+
+  private:
+    static std::uint32_t get_bucket_index(std::uint64_t microseconds);
+    static double        get_bucket_middle(std::uint32_t index);
+
+    std::array<std::uint32_t, NUMBER_OF_BUCKETS> buckets_;
+    std::uint64_t                                count_;
+    double                                       total_;
+    double                                       max_;
+    double                                       average_;
+    std::uint64_t                                stutters_;
+};
+
+} // namespace rinvid
+
+#endif // UTIL_INCLUDE_FRAME_TIME_HISTOGRAM_H
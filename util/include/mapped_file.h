@@ -0,0 +1,102 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef UTIL_INCLUDE_MAPPED_FILE_H
+#define UTIL_INCLUDE_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief A read only file mapped into memory. Contents are paged in by the OS on first access,
+ * without being copied to a buffer of our own.
+ *
+ *************************************************************************************************/
+class MappedFile
+{
+  public:
+    /**************************************************************************************************
+     * @brief Default constructor. Creates an empty mapping, call open to map a file.
+     *
+     *************************************************************************************************/
+    MappedFile() = default;
+
+    MappedFile(const MappedFile& other) = delete;
+
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Move constructor.
+     *
+     * @param other object being moved
+     *
+     *************************************************************************************************/
+    MappedFile(MappedFile&& other);
+
+    /**************************************************************************************************
+     * @brief Move assignement operator.
+     *
+     * @param other object being moved
+     *
+     *************************************************************************************************/
+    MappedFile& operator=(MappedFile&& other);
+
+    /**************************************************************************************************
+     * @brief Destructor. Unmaps the file.
+     *
+     *************************************************************************************************/
+    ~MappedFile();
+
+    /**************************************************************************************************
+     * @brief Maps a file into memory, unmapping previously mapped one.
+     *
+     * @param file_name Path to file
+     *
+     * @return true if file is mapped, false otherwise
+     *
+     *************************************************************************************************/
+    bool open(const char* file_name);
+
+    /**************************************************************************************************
+     * @brief Unmaps the file.
+     *
+     *************************************************************************************************/
+    void close();
+
+    /**************************************************************************************************
+     * @brief Returns mapped contents.
+     *
+     * @return Pointer to first byte of the file, nullptr if no file is mapped
+     *
+     *************************************************************************************************/
+    const std::uint8_t* get_data() const;
+
+    /**************************************************************************************************
+     * @brief Returns size of mapped file.
+     *
+     * @return Size in bytes
+     *
+     *************************************************************************************************/
+    std::size_t get_size() const;
+
+  private:
+    const std::uint8_t* data_{nullptr};
+    std::size_t         size_{0U};
+#ifdef _WIN32
+    void* file_handle_{nullptr};
+    void* mapping_handle_{nullptr};
+#endif
+};
+
+} // namespace rinvid
+
+#endif // UTIL_INCLUDE_MAPPED_FILE_H
@@ -0,0 +1,138 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef UTIL_INCLUDE_PROFILER_H
+#define UTIL_INCLUDE_PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// Zones are only recorded if RINVID_PROFILING is defined (CMake option of the same name).
+/// Otherwise RINVID_PROFILE_ZONE expands to nothing and profiling costs nothing.
+#define RINVID_PROFILE_CONCAT_IMPL(a, b) a##b
+#define RINVID_PROFILE_CONCAT(a, b) RINVID_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef RINVID_PROFILING
+/// Records time spent from this point until the end of the enclosing scope. Name must be a string
+/// literal (or otherwise outlive the profiler), it is stored as a pointer.
+#define RINVID_PROFILE_ZONE(name)                                                                  \
+    rinvid::profiler::Zone RINVID_PROFILE_CONCAT(rinvid_profile_zone_, __LINE__)                   \
+    {                                                                                              \
+        name                                                                                       \
+    }
+#else
+#define RINVID_PROFILE_ZONE(name) ((void)0)
+#endif
+
+namespace rinvid
+{
+namespace profiler
+{
+
+/// Number of zones each thread keeps, older zones are overwritten.
+constexpr std::uint32_t ZONES_PER_THREAD{65536U};
+
+/**************************************************************************************************
+ * @brief Time spent in all zones of the same name.
+ *
+ *************************************************************************************************/
+struct ZoneSummary
+{
+    /// Name of the zones.
+    const char* name;
+    /// Total duration of the zones in nanoseconds.
+    std::uint64_t total_duration;
+    /// Number of zones.
+    std::uint32_t count;
+};
+
+/**************************************************************************************************
+ * @brief Records a zone on destruction. Use RINVID_PROFILE_ZONE instead of using it directly.
+ *
+ *************************************************************************************************/
+class Zone
+{
+  public:
+    explicit Zone(const char* name);
+
+    ~Zone();
+
+    Zone(const Zone& other) = delete;
+
+    Zone& operator=(const Zone& other) = delete;
+
+    Zone(Zone&& other) = delete;
+
+    Zone& operator=(Zone&& other) = delete;
+
+  private:
+    const char*   name_;
+    std::uint64_t start_;
+};
+
+/**************************************************************************************************
+ * @brief Records a zone to the ring buffer of the calling thread. No locks are taken, except the
+ * first time a thread records a zone.
+ *
+ * @param name Name of the zone
+ * @param start Start of the zone, in nanoseconds since profiler start (see get_time)
+ * @param duration Duration of the zone in nanoseconds
+ *
+ *************************************************************************************************/
+void record_zone(const char* name, std::uint64_t start, std::uint64_t duration);
+
+/**************************************************************************************************
+ * @brief Returns time used to timestamp zones.
+ *
+ * @return Nanoseconds passed since profiler start.
+ *
+ *************************************************************************************************/
+std::uint64_t get_time();
+
+/**************************************************************************************************
+ * @brief Writes zones recorded by all threads as Chrome trace event JSON, which can be opened in
+ * chrome://tracing or Perfetto. Can be called at any time, from any thread. Zones recorded while
+ * writing may be left out.
+ *
+ * @param file_name Path to the file to write
+ *
+ * @return True if file was written, false otherwise
+ *
+ *************************************************************************************************/
+bool write_chrome_trace(const std::string& file_name);
+
+/**************************************************************************************************
+ * @brief Sums up zones of all threads by name.
+ *
+ * @param since Only zones starting at this time or later are included (see get_time)
+ *
+ * @return Summaries, longest total duration first
+ *
+ *************************************************************************************************/
+std::vector<ZoneSummary> summarize_zones(std::uint64_t since);
+
+/**************************************************************************************************
+ * @brief Discards zones recorded so far.
+ *
+ *************************************************************************************************/
+void clear();
+
+/**************************************************************************************************
+ * @brief Returns number of zones currently held by all threads.
+ *
+ * @return Number of zones
+ *
+ *************************************************************************************************/
+std::uint32_t get_zone_count();
+
+} // namespace profiler
+} // namespace rinvid
+
+#endif // UTIL_INCLUDE_PROFILER_H
@@ -0,0 +1,106 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifndef UTIL_INCLUDE_TRIPLE_BUFFER_H
+#define UTIL_INCLUDE_TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace rinvid
+{
+
+/**************************************************************************************************
+ * @brief Passes values from one writing thread to one reading thread without locking. Writer fills
+ * its buffer and publishes it, reader takes the latest published buffer. Neither ever waits for
+ * the other: writer always has a buffer the reader isn't using, and values the reader didn't get
+ * to are overwritten.
+ *
+ *************************************************************************************************/
+template <typename T>
+class TripleBuffer
+{
+  public:
+    TripleBuffer() : buffers_{}, write_index_{0U}, shared_index_{1U}, read_index_{2U}
+    {
+    }
+
+    TripleBuffer(const TripleBuffer& other) = delete;
+
+    TripleBuffer& operator=(const TripleBuffer& other) = delete;
+
+    /**************************************************************************************************
+     * @brief Returns the buffer writer fills. It keeps the contents it had when it was last read,
+     * which lets big values reuse their memory. Writer thread only.
+     *
+     * @return Buffer to write to
+     *
+     *************************************************************************************************/
+    T& get_write_buffer()
+    {
+        return buffers_[write_index_];
+    }
+
+    /**************************************************************************************************
+     * @brief Makes the write buffer the latest value and gives writer another buffer. Writer thread
+     * only.
+     *
+     *************************************************************************************************/
+    void publish()
+    {
+        write_index_ = shared_index_.exchange(write_index_ | FRESH, std::memory_order_acq_rel) &
+                       INDEX_MASK;
+    }
+
+    /**************************************************************************************************
+     * @brief Returns the latest published value. Value stays valid and unchanged until the next
+     * call. Reader thread only.
+     *
+     * @return Latest value, or the same value as last time if nothing was published since
+     *
+     *************************************************************************************************/
+    const T& acquire_latest()
+    {
+        if ((shared_index_.load(std::memory_order_relaxed) & FRESH) != 0U)
+        {
+            read_index_ =
+                shared_index_.exchange(read_index_, std::memory_order_acq_rel) & INDEX_MASK;
+        }
+
+        return buffers_[read_index_];
+    }
+
+    /**************************************************************************************************
+     * @brief Resets all buffers to default value. Must not be called while other threads use the
+     * buffer.
+     *
+     *************************************************************************************************/
+    void reset()
+    {
+        buffers_.fill(T{});
+        write_index_ = 0U;
+        shared_index_.store(1U, std::memory_order_relaxed);
+        read_index_ = 2U;
+    }
+
+  private:
+    // Marks that shared buffer holds a value the reader hasn't taken yet
+    static constexpr std::uint32_t FRESH{4U};
+    static constexpr std::uint32_t INDEX_MASK{3U};
+
+    std::array<T, 3>           buffers_;
+    std::uint32_t              write_index_;
+    std::atomic<std::uint32_t> shared_index_;
+    std::uint32_t              read_index_;
+};
+
+} // namespace rinvid
+
+#endif // UTIL_INCLUDE_TRIPLE_BUFFER_H
@@ -0,0 +1,194 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+#include <utility>
+
+#include "util/include/error_handler.h"
+#include "util/include/mapped_file.h"
+
+namespace rinvid
+{
+
+MappedFile::MappedFile(MappedFile&& other)
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    close();
+
+    data_       = other.data_;
+    size_       = other.size_;
+    other.data_ = nullptr;
+    other.size_ = 0U;
+#ifdef _WIN32
+    file_handle_          = other.file_handle_;
+    mapping_handle_       = other.mapping_handle_;
+    other.file_handle_    = nullptr;
+    other.mapping_handle_ = nullptr;
+#endif
+
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const char* file_name)
+{
+    close();
+
+    HANDLE file = CreateFileA(file_name, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        errors::put_error_to_log(std::string{"Could not open file for mapping: "} + file_name);
+        return false;
+    }
+
+    LARGE_INTEGER file_size{};
+    if ((GetFileSizeEx(file, &file_size) == 0) || (file_size.QuadPart == 0))
+    {
+        CloseHandle(file);
+        errors::put_error_to_log(std::string{"Could not map empty file: "} + file_name);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        errors::put_error_to_log(std::string{"Could not map file: "} + file_name);
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        errors::put_error_to_log(std::string{"Could not map file: "} + file_name);
+        return false;
+    }
+
+    file_handle_    = file;
+    mapping_handle_ = mapping;
+    data_           = static_cast<const std::uint8_t*>(data);
+    size_           = static_cast<std::size_t>(file_size.QuadPart);
+
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+        size_ = 0U;
+    }
+
+    if (mapping_handle_ != nullptr)
+    {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+
+    if (file_handle_ != nullptr)
+    {
+        CloseHandle(file_handle_);
+        file_handle_ = nullptr;
+    }
+}
+
+#else
+
+bool MappedFile::open(const char* file_name)
+{
+    close();
+
+    int file = ::open(file_name, O_RDONLY);
+    if (file == -1)
+    {
+        errors::put_error_to_log(std::string{"Could not open file for mapping: "} + file_name);
+        return false;
+    }
+
+    struct stat file_status{};
+    if ((fstat(file, &file_status) == -1) || (file_status.st_size == 0))
+    {
+        ::close(file);
+        errors::put_error_to_log(std::string{"Could not map empty file: "} + file_name);
+        return false;
+    }
+
+    auto  size = static_cast<std::size_t>(file_status.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    // Mapping stays valid after the descriptor is closed
+    ::close(file);
+
+    if (data == MAP_FAILED)
+    {
+        errors::put_error_to_log(std::string{"Could not map file: "} + file_name);
+        return false;
+    }
+
+    // Whole file is about to be read (e.g. uploaded to the GPU), start paging it in
+    madvise(data, size, MADV_WILLNEED);
+
+    data_ = static_cast<const std::uint8_t*>(data);
+    size_ = size;
+
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<std::uint8_t*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0U;
+    }
+}
+
+#endif // _WIN32
+
+const std::uint8_t* MappedFile::get_data() const
+{
+    return data_;
+}
+
+std::size_t MappedFile::get_size() const
+{
+    return size_;
+}
+
+} // namespace rinvid
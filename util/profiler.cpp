@@ -0,0 +1,273 @@
+/**********************************************************************
+ * Copyright (c) 2026, Filip Vasiljevic
+ * All rights reserved.
+ *
+ * This file is subject to the terms and conditions of the BSD 2-Clause
+ * License.  See the file LICENSE in the root directory of the Rinvid
+ * repository for more details.
+ **********************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "util/include/error_handler.h"
+#include "util/include/profiler.h"
+
+namespace rinvid
+{
+namespace profiler
+{
+
+namespace
+{
+
+// Fields are atomics only so that a trace can be written while zones are being recorded, relaxed
+// atomic loads and stores compile to plain moves
+struct Event
+{
+    std::atomic<const char*>   name{nullptr};
+    std::atomic<std::uint64_t> start{0U};
+    std::atomic<std::uint64_t> duration{0U};
+};
+
+struct ZoneCopy
+{
+    const char*   name;
+    std::uint64_t start;
+    std::uint64_t duration;
+};
+
+struct ThreadBuffer
+{
+    explicit ThreadBuffer(std::uint32_t id) : events{new Event[ZONES_PER_THREAD]}, thread_id{id}
+    {
+    }
+
+    std::unique_ptr<Event[]> events;
+    // Total number of zones recorded by the thread, only ever written by the owning thread
+    std::atomic<std::uint64_t> written{0U};
+    // Zones recorded before this index were discarded by clear()
+    std::atomic<std::uint64_t> cleared{0U};
+    std::uint32_t              thread_id;
+};
+
+const auto start_time = std::chrono::steady_clock::now();
+
+// Buffers are kept after their thread exits, so that its zones still end up in the trace
+std::vector<std::shared_ptr<ThreadBuffer>> buffers{};
+std::mutex                                 buffers_mutex{};
+
+std::shared_ptr<ThreadBuffer> register_thread()
+{
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+    buffers.push_back(std::make_shared<ThreadBuffer>(static_cast<std::uint32_t>(buffers.size())));
+
+    return buffers.back();
+}
+
+ThreadBuffer& get_thread_buffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> buffer{register_thread()};
+
+    return *buffer;
+}
+
+std::uint64_t get_first_valid(const ThreadBuffer& buffer, std::uint64_t written)
+{
+    const std::uint64_t oldest_kept =
+        (written > ZONES_PER_THREAD) ? (written - ZONES_PER_THREAD) : 0U;
+
+    return std::max(oldest_kept, buffer.cleared.load(std::memory_order_relaxed));
+}
+
+std::vector<ZoneCopy> copy_zones(const ThreadBuffer& buffer)
+{
+    const std::uint64_t written = buffer.written.load(std::memory_order_acquire);
+    const std::uint64_t first   = get_first_valid(buffer, written);
+
+    std::vector<ZoneCopy> zones{};
+    zones.reserve(static_cast<std::size_t>(written - first));
+    for (std::uint64_t i{first}; i < written; ++i)
+    {
+        const Event& event = buffer.events[i % ZONES_PER_THREAD];
+        zones.push_back(ZoneCopy{event.name.load(std::memory_order_relaxed),
+                                 event.start.load(std::memory_order_relaxed),
+                                 event.duration.load(std::memory_order_relaxed)});
+    }
+
+    // Zones the owning thread may have overwritten while they were copied are dropped, the one
+    // being recorded right now included
+    const std::uint64_t written_after = buffer.written.load(std::memory_order_acquire);
+    const std::uint64_t first_intact  = get_first_valid(buffer, written_after + 1U);
+    if (first_intact > first)
+    {
+        const auto overwritten = std::min(static_cast<std::size_t>(first_intact - first),
+                                          zones.size());
+        zones.erase(zones.begin(), zones.begin() + static_cast<std::ptrdiff_t>(overwritten));
+    }
+
+    return zones;
+}
+
+void write_escaped(std::ofstream& file, const char* text)
+{
+    for (const char* c = text; *c != '\0'; ++c)
+    {
+        if ((*c == '"') || (*c == '\\'))
+        {
+            file << '\\';
+        }
+        file << *c;
+    }
+}
+
+} // namespace
+
+Zone::Zone(const char* name) : name_{name}, start_{get_time()}
+{
+}
+
+Zone::~Zone()
+{
+    record_zone(name_, start_, get_time() - start_);
+}
+
+void record_zone(const char* name, std::uint64_t start, std::uint64_t duration)
+{
+    ThreadBuffer&       buffer = get_thread_buffer();
+    const std::uint64_t index  = buffer.written.load(std::memory_order_relaxed);
+
+    Event& event = buffer.events[index % ZONES_PER_THREAD];
+    event.name.store(name, std::memory_order_relaxed);
+    event.start.store(start, std::memory_order_relaxed);
+    event.duration.store(duration, std::memory_order_relaxed);
+
+    buffer.written.store(index + 1U, std::memory_order_release);
+}
+
+std::uint64_t get_time()
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now() - start_time)
+                                          .count());
+}
+
+bool write_chrome_trace(const std::string& file_name)
+{
+    std::ofstream file{file_name, std::ios::trunc};
+    if (!file.is_open())
+    {
+        rinvid::errors::put_error_to_log("Could not open trace file: " + file_name);
+        return false;
+    }
+
+    std::vector<std::shared_ptr<ThreadBuffer>> thread_buffers{};
+    {
+        std::lock_guard<std::mutex> lock{buffers_mutex};
+        thread_buffers = buffers;
+    }
+
+    // Chrome trace timestamps and durations are in microseconds
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first_event = true;
+    for (const auto& buffer : thread_buffers)
+    {
+        for (const auto& zone : copy_zones(*buffer))
+        {
+            file << (first_event ? "\n" : ",\n");
+            file << "{\"name\":\"";
+            write_escaped(file, zone.name);
+            file << "\",\"cat\":\"rinvid\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id
+                 << ",\"ts\":" << static_cast<double>(zone.start) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(zone.duration) / 1000.0 << '}';
+            first_event = false;
+        }
+    }
+
+    file << "\n]}\n";
+
+    if (!file)
+    {
+        rinvid::errors::put_error_to_log("Could not write trace file: " + file_name);
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<ZoneSummary> summarize_zones(std::uint64_t since)
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> thread_buffers{};
+    {
+        std::lock_guard<std::mutex> lock{buffers_mutex};
+        thread_buffers = buffers;
+    }
+
+    std::vector<ZoneSummary> summaries{};
+    for (const auto& buffer : thread_buffers)
+    {
+        for (const auto& zone : copy_zones(*buffer))
+        {
+            if (zone.start < since)
+            {
+                continue;
+            }
+
+            // Same literal used in different translation units may have different addresses
+            auto summary = std::find_if(summaries.begin(), summaries.end(), [&zone](const auto& s) {
+                return (s.name == zone.name) || (std::strcmp(s.name, zone.name) == 0);
+            });
+            if (summary == summaries.end())
+            {
+                summaries.push_back(ZoneSummary{zone.name, zone.duration, 1U});
+            }
+            else
+            {
+                summary->total_duration += zone.duration;
+                ++summary->count;
+            }
+        }
+    }
+
+    std::sort(summaries.begin(), summaries.end(), [](const auto& a, const auto& b) {
+        return a.total_duration > b.total_duration;
+    });
+
+    return summaries;
+}
+
+void clear()
+{
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+    for (auto& buffer : buffers)
+    {
+        buffer->cleared.store(buffer->written.load(std::memory_order_acquire),
+                              std::memory_order_relaxed);
+    }
+}
+
+std::uint32_t get_zone_count()
+{
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+
+    std::uint64_t count{0U};
+    for (const auto& buffer : buffers)
+    {
+        const std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        count += written - get_first_valid(*buffer, written);
+    }
+
+    return static_cast<std::uint32_t>(count);
+}
+
+} // namespace profiler
+} // namespace rinvid